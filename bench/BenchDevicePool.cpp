@@ -0,0 +1,77 @@
+#include <aspl/Context.hpp>
+#include <aspl/Device.hpp>
+#include <aspl/DevicePool.hpp>
+#include <aspl/Plugin.hpp>
+#include <aspl/Tracer.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+struct BenchObjects
+{
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+};
+
+aspl::DevicePoolParameters PoolParams()
+{
+    aspl::DevicePoolParameters params;
+    params.Streams.resize(2);
+    params.Streams[0].Direction = aspl::Direction::Input;
+    params.Streams[1].Direction = aspl::Direction::Output;
+    params.Size = 1;
+
+    return params;
+}
+
+// Build device from scratch, publish it, then remove and destroy it.
+void BM_CreateDestroyDevice(benchmark::State& state)
+{
+    BenchObjects objects;
+
+    const auto params = PoolParams();
+
+    for (auto _ : state) {
+        auto device = std::make_shared<aspl::Device>(objects.context, params.Device);
+        for (const auto& streamParams : params.Streams) {
+            device->AddStreamWithControlsAsync(streamParams);
+        }
+
+        objects.plugin->AddDevice(device);
+        objects.plugin->RemoveDevice(device);
+    }
+}
+
+BENCHMARK(BM_CreateDestroyDevice);
+
+// Take pre-built device from pool, publish it, then remove and release it.
+// Refilling the pool is excluded from measurement.
+void BM_CreateDestroyDevicePooled(benchmark::State& state)
+{
+    BenchObjects objects;
+
+    aspl::DevicePool pool(objects.context, PoolParams());
+    pool.Refill();
+
+    for (auto _ : state) {
+        auto device = pool.Acquire();
+
+        objects.plugin->AddDevice(device);
+        objects.plugin->RemoveDevice(device);
+
+        pool.Release(std::move(device));
+
+        state.PauseTiming();
+        pool.Refill();
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(BM_CreateDestroyDevicePooled);
+
+} // namespace
@@ -0,0 +1,82 @@
+#include <aspl/Context.hpp>
+#include <aspl/Dispatcher.hpp>
+#include <aspl/Object.hpp>
+#include <aspl/Tracer.hpp>
+
+#include "ObjectIDAllocator.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+// Look up objects in dispatcher with given number of registered objects.
+static void BM_DispatcherFindObject(benchmark::State& state)
+{
+    auto context = std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+
+    std::vector<std::shared_ptr<aspl::Object>> objects;
+
+    for (int64_t n = 0; n < state.range(0); n++) {
+        objects.push_back(std::make_shared<aspl::Object>(context));
+    }
+
+    size_t index = 0;
+
+    for (auto _ : state) {
+        auto object = context->Dispatcher->FindObject(objects[index]->GetID());
+        benchmark::DoNotOptimize(object.get());
+
+        if (++index == objects.size()) {
+            index = 0;
+        }
+    }
+}
+
+BENCHMARK(BM_DispatcherFindObject)->RangeMultiplier(10)->Range(10, 10000);
+
+// Look up object which is not registered.
+static void BM_DispatcherFindMissing(benchmark::State& state)
+{
+    auto context = std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+
+    std::vector<std::shared_ptr<aspl::Object>> objects;
+
+    for (int64_t n = 0; n < state.range(0); n++) {
+        objects.push_back(std::make_shared<aspl::Object>(context));
+    }
+
+    for (auto _ : state) {
+        auto object = context->Dispatcher->FindObject(kAudioObjectUnknown);
+        benchmark::DoNotOptimize(object.get());
+    }
+}
+
+BENCHMARK(BM_DispatcherFindMissing)->Arg(1000);
+
+// Free random identifier and allocate a new one, with given number of
+// identifiers in use. Runs one million free+allocate pairs.
+static void BM_DispatcherIDChurn(benchmark::State& state)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, 1000, nullptr);
+
+    std::vector<AudioObjectID> aliveIDs;
+
+    for (int64_t n = 0; n < state.range(0); n++) {
+        aliveIDs.push_back(allocator.Allocate());
+    }
+
+    std::minstd_rand rng;
+
+    for (auto _ : state) {
+        auto& objectID = aliveIDs[rng() % aliveIDs.size()];
+
+        allocator.Free(objectID);
+        objectID = allocator.Allocate();
+    }
+}
+
+BENCHMARK(BM_DispatcherIDChurn)->Arg(1000)->Arg(100000)->Iterations(1000000);
@@ -0,0 +1,68 @@
+#include <aspl/DoubleBuffer.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+constexpr size_t BenchValueSize = 64;
+
+aspl::DoubleBuffer<std::vector<UInt32>>& GetBuffer()
+{
+    static aspl::DoubleBuffer<std::vector<UInt32>> buffer {
+        std::vector<UInt32>(BenchValueSize)};
+
+    return buffer;
+}
+
+} // anonymous namespace
+
+// All threads read.
+static void BM_DoubleBufferRead(benchmark::State& state)
+{
+    auto& buffer = GetBuffer();
+
+    for (auto _ : state) {
+        auto readLock = buffer.GetReadLock();
+        benchmark::DoNotOptimize(readLock.GetReference().data());
+    }
+}
+
+BENCHMARK(BM_DoubleBufferRead)->ThreadRange(1, 8)->UseRealTime();
+
+// Single thread writes.
+static void BM_DoubleBufferWrite(benchmark::State& state)
+{
+    auto& buffer = GetBuffer();
+
+    std::vector<UInt32> value(BenchValueSize);
+
+    for (auto _ : state) {
+        buffer.Set(value);
+    }
+}
+
+BENCHMARK(BM_DoubleBufferWrite);
+
+// Thread 0 writes, other threads read.
+// Reported time is averaged between writer and readers.
+static void BM_DoubleBufferContention(benchmark::State& state)
+{
+    auto& buffer = GetBuffer();
+
+    if (state.thread_index() == 0) {
+        std::vector<UInt32> value(BenchValueSize);
+
+        for (auto _ : state) {
+            buffer.Set(value);
+        }
+    } else {
+        for (auto _ : state) {
+            auto readLock = buffer.GetReadLock();
+            benchmark::DoNotOptimize(readLock.GetReference().data());
+        }
+    }
+}
+
+BENCHMARK(BM_DoubleBufferContention)->ThreadRange(2, 8)->UseRealTime();
@@ -0,0 +1,73 @@
+#include <aspl/Clock.hpp>
+#include <aspl/Driver.hpp>
+
+#include "HostSimulator.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+constexpr UInt32 BenchSampleRate = 48000;
+
+} // anonymous namespace
+
+// Run full I/O cycle on device with input and output streams.
+// Arguments: number of clients, buffer size in frames.
+static void BM_IOCycle(benchmark::State& state)
+{
+    const auto numClients = UInt32(state.range(0));
+    const auto bufferFrameSize = UInt32(state.range(1));
+
+    auto tracer = std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop);
+    auto clock = std::make_shared<aspl::SimulatedClock>();
+
+    auto context = std::make_shared<aspl::Context>(tracer, nullptr, clock);
+
+    aspl::DeviceParameters deviceParams;
+    deviceParams.SampleRate = BenchSampleRate;
+    deviceParams.ZeroTimeStampPeriod = bufferFrameSize;
+    deviceParams.EnableMixing = true;
+
+    auto device = std::make_shared<aspl::Device>(context, deviceParams);
+
+    device->AddStreamWithControlsAsync(aspl::Direction::Input);
+    device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+    plugin->AddDevice(device);
+
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::HostSimulatorParameters simParams;
+    simParams.NumClients = numClients;
+    simParams.BufferFrameSize = bufferFrameSize;
+
+    aspl::HostSimulator simulator(driver, simParams);
+
+    if (simulator.Initialize() != kAudioHardwareNoError ||
+        simulator.Start(device->GetID()) != kAudioHardwareNoError) {
+        state.SkipWithError("can't start simulator");
+        return;
+    }
+
+    for (auto _ : state) {
+        if (simulator.RunCycles(1) != kAudioHardwareNoError) {
+            state.SkipWithError("RunCycles() failed");
+            break;
+        }
+    }
+
+    simulator.Stop();
+
+    const auto report = simulator.GetReport();
+
+    state.counters["allocs"] = benchmark::Counter(
+        double(report.NumAllocations), benchmark::Counter::kAvgIterations);
+    state.counters["failed"] = double(report.NumFailedCalls);
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * bufferFrameSize);
+}
+
+BENCHMARK(BM_IOCycle)->ArgsProduct({{1, 4}, {128, 512}});
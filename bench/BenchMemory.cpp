@@ -0,0 +1,90 @@
+#include <aspl/Context.hpp>
+#include <aspl/Device.hpp>
+#include <aspl/MuteControl.hpp>
+#include <aspl/Stream.hpp>
+#include <aspl/Tracer.hpp>
+#include <aspl/VolumeControl.hpp>
+
+#include "AllocationCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Objects are kept alive until the end of benchmark, so that the number of
+// iterations also defines memory consumption of the run.
+constexpr int BenchNumObjects = 1000;
+
+std::shared_ptr<aspl::Context> MakeContext()
+{
+    return std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+}
+
+// Report average footprint of objects created by the loop:
+//  - Bytes: heap bytes requested during construction, including the object
+//    itself, shared state, and growth of dispatcher tables
+//  - Size: size of the object itself
+template <typename T, typename Factory>
+void MeasureFootprint(benchmark::State& state, Factory&& factory)
+{
+    std::vector<std::shared_ptr<T>> objects;
+    objects.reserve(BenchNumObjects);
+
+    const UInt64 bytesBefore = aspl::GetThreadAllocationBytes();
+
+    for (auto _ : state) {
+        objects.push_back(factory());
+    }
+
+    const UInt64 bytesAfter = aspl::GetThreadAllocationBytes();
+
+    state.counters["Bytes"] = double(bytesAfter - bytesBefore) / double(objects.size());
+    state.counters["Size"] = double(sizeof(T));
+}
+
+} // anonymous namespace
+
+static void BM_MemoryDevice(benchmark::State& state)
+{
+    const auto context = MakeContext();
+
+    MeasureFootprint<aspl::Device>(
+        state, [&] { return std::make_shared<aspl::Device>(context); });
+}
+
+BENCHMARK(BM_MemoryDevice)->Iterations(BenchNumObjects);
+
+static void BM_MemoryStream(benchmark::State& state)
+{
+    const auto context = MakeContext();
+    const auto device = std::make_shared<aspl::Device>(context);
+
+    MeasureFootprint<aspl::Stream>(
+        state, [&] { return std::make_shared<aspl::Stream>(context, device); });
+}
+
+BENCHMARK(BM_MemoryStream)->Iterations(BenchNumObjects);
+
+static void BM_MemoryVolumeControl(benchmark::State& state)
+{
+    const auto context = MakeContext();
+
+    MeasureFootprint<aspl::VolumeControl>(
+        state, [&] { return std::make_shared<aspl::VolumeControl>(context); });
+}
+
+BENCHMARK(BM_MemoryVolumeControl)->Iterations(BenchNumObjects);
+
+static void BM_MemoryMuteControl(benchmark::State& state)
+{
+    const auto context = MakeContext();
+
+    MeasureFootprint<aspl::MuteControl>(
+        state, [&] { return std::make_shared<aspl::MuteControl>(context); });
+}
+
+BENCHMARK(BM_MemoryMuteControl)->Iterations(BenchNumObjects);
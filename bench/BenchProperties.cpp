@@ -0,0 +1,158 @@
+#include <aspl/Context.hpp>
+#include <aspl/Device.hpp>
+#include <aspl/Stream.hpp>
+#include <aspl/Tracer.hpp>
+#include <aspl/VolumeControl.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <memory>
+
+namespace {
+
+struct BenchObjects
+{
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+
+    std::shared_ptr<aspl::Device> device = std::make_shared<aspl::Device>(context);
+
+    std::shared_ptr<aspl::Stream> stream =
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    std::shared_ptr<aspl::VolumeControl> volumeControl =
+        device->GetVolumeControlByIndex(kAudioObjectPropertyScopeOutput, 0);
+};
+
+BenchObjects& GetObjects()
+{
+    static BenchObjects objects;
+
+    return objects;
+}
+
+void GetProperty(benchmark::State& state,
+    aspl::Object& object,
+    AudioObjectPropertySelector selector)
+{
+    const AudioObjectPropertyAddress address = {
+        selector,
+        kAudioObjectPropertyScopeGlobal,
+        kAudioObjectPropertyElementMain,
+    };
+
+    alignas(8) char buffer[256];
+
+    for (auto _ : state) {
+        UInt32 size = 0;
+
+        const OSStatus status = object.GetPropertyData(
+            object.GetID(), 0, &address, 0, nullptr, sizeof(buffer), &size, buffer);
+
+        if (status != kAudioHardwareNoError) {
+            state.SkipWithError("GetPropertyData() failed");
+            break;
+        }
+
+        if (selector == kAudioObjectPropertyName) {
+            CFRelease(*reinterpret_cast<CFStringRef*>(buffer));
+        }
+
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+} // anonymous namespace
+
+static void BM_DeviceGetProperty(benchmark::State& state,
+    AudioObjectPropertySelector selector)
+{
+    GetProperty(state, *GetObjects().device, selector);
+}
+
+BENCHMARK_CAPTURE(BM_DeviceGetProperty, Name, kAudioObjectPropertyName);
+BENCHMARK_CAPTURE(
+    BM_DeviceGetProperty, NominalSampleRate, kAudioDevicePropertyNominalSampleRate);
+BENCHMARK_CAPTURE(BM_DeviceGetProperty, Streams, kAudioDevicePropertyStreams);
+BENCHMARK_CAPTURE(BM_DeviceGetProperty, IsRunning, kAudioDevicePropertyDeviceIsRunning);
+
+static void BM_StreamGetProperty(benchmark::State& state,
+    AudioObjectPropertySelector selector)
+{
+    GetProperty(state, *GetObjects().stream, selector);
+}
+
+BENCHMARK_CAPTURE(BM_StreamGetProperty, VirtualFormat, kAudioStreamPropertyVirtualFormat);
+BENCHMARK_CAPTURE(BM_StreamGetProperty, Direction, kAudioStreamPropertyDirection);
+BENCHMARK_CAPTURE(BM_StreamGetProperty, Latency, kAudioStreamPropertyLatency);
+
+static void BM_VolumeControlGetProperty(benchmark::State& state,
+    AudioObjectPropertySelector selector)
+{
+    GetProperty(state, *GetObjects().volumeControl, selector);
+}
+
+BENCHMARK_CAPTURE(
+    BM_VolumeControlGetProperty, ScalarValue, kAudioLevelControlPropertyScalarValue);
+BENCHMARK_CAPTURE(
+    BM_VolumeControlGetProperty, DecibelValue, kAudioLevelControlPropertyDecibelValue);
+
+// Mixed workload similar to what HAL does when a client opens device.
+// Run with library built with and without ENABLE_TRACING to see the cost of
+// disabled tracing.
+static void BM_GetPropertyThroughput(benchmark::State& state)
+{
+    auto& objects = GetObjects();
+
+    const struct
+    {
+        aspl::Object* object;
+        AudioObjectPropertySelector selector;
+    } properties[] = {
+        {objects.device.get(), kAudioDevicePropertyNominalSampleRate},
+        {objects.device.get(), kAudioDevicePropertyStreams},
+        {objects.device.get(), kAudioDevicePropertyDeviceIsRunning},
+        {objects.device.get(), kAudioDevicePropertyLatency},
+        {objects.device.get(), kAudioDevicePropertySafetyOffset},
+        {objects.stream.get(), kAudioStreamPropertyVirtualFormat},
+        {objects.stream.get(), kAudioStreamPropertyDirection},
+        {objects.stream.get(), kAudioStreamPropertyLatency},
+        {objects.volumeControl.get(), kAudioLevelControlPropertyScalarValue},
+        {objects.volumeControl.get(), kAudioLevelControlPropertyDecibelValue},
+    };
+
+    alignas(8) char buffer[256];
+
+    for (auto _ : state) {
+        for (const auto& prop : properties) {
+            const AudioObjectPropertyAddress address = {
+                prop.selector,
+                kAudioObjectPropertyScopeGlobal,
+                kAudioObjectPropertyElementMain,
+            };
+
+            UInt32 size = 0;
+
+            const OSStatus status = prop.object->GetPropertyData(prop.object->GetID(),
+                0,
+                &address,
+                0,
+                nullptr,
+                sizeof(buffer),
+                &size,
+                buffer);
+
+            if (status != kAudioHardwareNoError) {
+                state.SkipWithError("GetPropertyData() failed");
+                return;
+            }
+
+            benchmark::DoNotOptimize(buffer);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(properties));
+}
+
+BENCHMARK(BM_GetPropertyThroughput);
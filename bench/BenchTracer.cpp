@@ -0,0 +1,53 @@
+#include <aspl/AsyncTracer.hpp>
+#include <aspl/Tracer.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void TraceOperation(benchmark::State& state, aspl::Tracer& tracer)
+{
+    aspl::Tracer::Operation op;
+    op.Name = "Device::GetPropertyData()";
+    op.ObjectID = 2;
+
+    for (auto _ : state) {
+        tracer.OperationBegin(op);
+        tracer.Message("selector=%s", "kAudioDevicePropertyNominalSampleRate");
+        tracer.OperationEnd(op, kAudioHardwareNoError);
+    }
+}
+
+} // anonymous namespace
+
+static void BM_TracerNoop(benchmark::State& state)
+{
+    aspl::Tracer tracer(aspl::Tracer::Mode::Noop);
+
+    TraceOperation(state, tracer);
+}
+
+BENCHMARK(BM_TracerNoop);
+
+static void BM_TracerSyslog(benchmark::State& state)
+{
+    aspl::Tracer tracer(aspl::Tracer::Mode::Syslog);
+
+    TraceOperation(state, tracer);
+}
+
+BENCHMARK(BM_TracerSyslog);
+
+static void BM_TracerAsyncSyslog(benchmark::State& state)
+{
+    // shared by benchmark threads
+    static aspl::AsyncTracer tracer([] {
+        aspl::AsyncTracerParameters params;
+        params.Mode = aspl::Tracer::Mode::Syslog;
+        return params;
+    }());
+
+    TraceOperation(state, tracer);
+}
+
+BENCHMARK(BM_TracerAsyncSyslog)->ThreadRange(1, 4);
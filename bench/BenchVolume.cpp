@@ -0,0 +1,98 @@
+#include <aspl/Context.hpp>
+#include <aspl/Tracer.hpp>
+#include <aspl/VolumeControl.hpp>
+
+#include "VolumeCurve.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr UInt32 BenchChannelCount = 2;
+
+aspl::VolumeCurve MakeCurve()
+{
+    aspl::VolumeCurve curve;
+    curve.AddRange(0, 96, -96.0f, 0.0f);
+
+    return curve;
+}
+
+} // anonymous namespace
+
+static void BM_VolumeCurveScalarToDB(benchmark::State& state)
+{
+    const auto curve = MakeCurve();
+
+    Float32 scalar = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curve.ConvertScalarToDB(scalar));
+
+        if ((scalar += 0.01f) > 1) {
+            scalar = 0;
+        }
+    }
+}
+
+BENCHMARK(BM_VolumeCurveScalarToDB);
+
+static void BM_VolumeCurveDBToScalar(benchmark::State& state)
+{
+    const auto curve = MakeCurve();
+
+    Float32 decibel = -96;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curve.ConvertDBToScalar(decibel));
+
+        if ((decibel += 1) > 0) {
+            decibel = -96;
+        }
+    }
+}
+
+BENCHMARK(BM_VolumeCurveDBToScalar);
+
+static void BM_VolumeCurveRawToDB(benchmark::State& state)
+{
+    const auto curve = MakeCurve();
+
+    SInt32 raw = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curve.ConvertRawToDB(raw));
+
+        if (++raw > 96) {
+            raw = 0;
+        }
+    }
+}
+
+BENCHMARK(BM_VolumeCurveRawToDB);
+
+// Apply volume to interleaved stereo buffer of given size in frames.
+static void BM_VolumeControlApplyProcessing(benchmark::State& state)
+{
+    auto context = std::make_shared<aspl::Context>(
+        std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop));
+
+    auto control = std::make_shared<aspl::VolumeControl>(context);
+    control->SetScalarValue(0.5f);
+
+    const auto frameCount = UInt32(state.range(0));
+
+    std::vector<Float32> frames(frameCount * BenchChannelCount, 0.25f);
+
+    for (auto _ : state) {
+        control->ApplyProcessing(frames.data(), frameCount, BenchChannelCount);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * frameCount);
+}
+
+BENCHMARK(BM_VolumeControlApplyProcessing)->RangeMultiplier(4)->Range(64, 4096);
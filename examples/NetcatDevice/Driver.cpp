@@ -2,20 +2,15 @@
 // Licensed under MIT
 
 #include <aspl/Driver.hpp>
+#include <aspl/NetworkSink.hpp>
 
 #include <CoreAudio/AudioServerPlugIn.h>
 
-#include <arpa/inet.h>
-#include <netinet/in.h>
-#include <sys/socket.h>
-#include <sys/types.h>
-#include <unistd.h>
-
 namespace {
 
 // Destination UDP address.
 constexpr const char* SocketAddr = "127.0.0.1";
-constexpr short SocketPort = 4444;
+constexpr UInt16 SocketPort = 4444;
 constexpr UInt32 SocketPacketSize = 512;
 
 // Stream format.
@@ -26,35 +21,23 @@ constexpr UInt32 ChannelCount = 2;
 class ExampleHandler : public aspl::ControlRequestHandler, public aspl::IORequestHandler
 {
 public:
+    explicit ExampleHandler(const aspl::NetworkSinkParameters& sinkParams)
+        : sink_(sinkParams)
+    {
+    }
+
     // Invoked on control thread before first I/O request.
     OSStatus OnStartIO() override
     {
-        socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-        if (socket_ == -1) {
-            return kAudioHardwareUnspecifiedError;
-        }
-
-        sockaddr_in addr;
-        addr.sin_family = AF_INET;
-        addr.sin_port = htons(SocketPort);
-        inet_pton(AF_INET, SocketAddr, &addr.sin_addr);
-
-        if (connect(socket_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1) {
-            close(socket_);
-            socket_ = -1;
-            return kAudioHardwareUnspecifiedError;
-        }
-
-        return kAudioHardwareNoError;
+        // Opens socket and starts sender thread.
+        return sink_.Start();
     }
 
     // Invoked on control thread after last I/O request.
     void OnStopIO() override
     {
-        if (socket_ != -1) {
-            close(socket_);
-            socket_ = -1;
-        }
+        // Sends remaining packets and stops sender thread.
+        sink_.Stop();
     }
 
     // Invoked on realtime I/O thread to write mixed data from clients.
@@ -64,18 +47,13 @@ public:
         const void* buff,
         UInt32 buffBytesSize) override
     {
-        while (buffBytesSize != 0) {
-            const UInt32 packetBytesSize = std::min(buffBytesSize, SocketPacketSize);
-
-            send(socket_, buff, packetBytesSize, MSG_DONTWAIT);
-
-            buff = reinterpret_cast<const UInt8*>(buff) + packetBytesSize;
-            buffBytesSize -= packetBytesSize;
-        }
+        // Splits buffer into RTP packets and enqueues them for sender thread.
+        // Doesn't block and doesn't make system calls.
+        sink_.Write(UInt64(timestamp), buff, buffBytesSize);
     }
 
 private:
-    int socket_ = -1;
+    aspl::NetworkSink sink_;
 };
 
 std::shared_ptr<aspl::Driver> CreateExampleDriver()
@@ -105,9 +83,18 @@ std::shared_ptr<aspl::Driver> CreateExampleDriver()
     // IORequestHandler will use stream to apply stored volume and mute settings.
     device->AddStreamWithControlsAsync(aspl::Direction::Output);
 
+    // Configure network sink used by handler.
+    // Packets will contain whole frames of the default stream format
+    // (16-bit signed integers).
+    aspl::NetworkSinkParameters sinkParams;
+    sinkParams.Address = SocketAddr;
+    sinkParams.Port = SocketPort;
+    sinkParams.BytesPerFrame = ChannelCount * sizeof(SInt16);
+    sinkParams.MaxPayloadSize = SocketPacketSize;
+
     // Create and set custom handler for both control and I/O requests.
     // You can use separate handlers, but here we use one.
-    auto handler = std::make_shared<ExampleHandler>();
+    auto handler = std::make_shared<ExampleHandler>(sinkParams);
 
     device->SetControlHandler(handler);
     device->SetIOHandler(handler);
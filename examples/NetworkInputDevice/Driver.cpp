@@ -0,0 +1,146 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/Driver.hpp>
+#include <aspl/NetworkSource.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+namespace {
+
+// Local UDP address.
+constexpr const char* SocketAddr = "127.0.0.1";
+constexpr UInt16 SocketPort = 4444;
+
+// RTP SSRC of the stream.
+constexpr UInt32 StreamID = 0;
+
+// Stream format.
+constexpr UInt32 SampleRate = 44100;
+constexpr UInt32 ChannelCount = 2;
+
+// Network latency, in frames.
+constexpr UInt32 Latency = SampleRate / 10;
+
+// Control and I/O request handler.
+class ExampleHandler : public aspl::ControlRequestHandler, public aspl::IORequestHandler
+{
+public:
+    ExampleHandler(const aspl::NetworkSourceParameters& sourceParams,
+        const aspl::NetworkSourceStreamParameters& streamParams)
+        : source_(sourceParams)
+    {
+        source_.AddStream(streamParams);
+    }
+
+    // Invoked on control thread before first I/O request.
+    OSStatus OnStartIO() override
+    {
+        // Opens socket and starts receiver thread.
+        return source_.Start();
+    }
+
+    // Invoked on control thread after last I/O request.
+    void OnStopIO() override
+    {
+        // Stops receiver thread.
+        source_.Stop();
+    }
+
+    // Invoked on realtime I/O thread to read data for clients.
+    void OnReadClientInput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        void* bytes,
+        UInt32 bytesCount) override
+    {
+        // Copies received samples for given sample time directly into
+        // client buffer, and fills gaps with silence.
+        // Doesn't block and doesn't make system calls.
+        source_.Read(StreamID, UInt64(timestamp), bytes, bytesCount);
+    }
+
+private:
+    aspl::NetworkSource source_;
+};
+
+std::shared_ptr<aspl::Driver> CreateExampleDriver()
+{
+    // Create context, shared between all other objects.
+    // You can provide custom tracer here.
+    auto context = std::make_shared<aspl::Context>();
+
+    // Create device object with some custom parameters.
+    aspl::DeviceParameters deviceParams;
+    deviceParams.Name = "Network Input Device (libASPL)";
+    deviceParams.SampleRate = SampleRate;
+    deviceParams.ChannelCount = ChannelCount;
+
+    auto device = std::make_shared<aspl::Device>(context, deviceParams);
+
+    // Add to device one stream, one volume control, and one mute control.
+    // Associate volume and mute control with the stream.
+    //
+    // If desired, you can provide parameters for streams and controls as well,
+    // but for simplicity we use defaults here.
+    //
+    // HAL will use stream and controls to determine how to work with our device
+    // and to store volume and mute settings.
+    //
+    // IORequestHandler will use stream to apply stored volume and mute settings.
+    device->AddStreamWithControlsAsync(aspl::Direction::Input);
+
+    // Configure network source used by handler.
+    // It can receive multiple streams on one socket, but here we use one.
+    // Packets should contain whole frames of the default stream format
+    // (16-bit signed integers).
+    aspl::NetworkSourceParameters sourceParams;
+    sourceParams.Address = SocketAddr;
+    sourceParams.Port = SocketPort;
+
+    aspl::NetworkSourceStreamParameters streamParams;
+    streamParams.StreamID = StreamID;
+    streamParams.Latency = Latency;
+    streamParams.Buffer.BytesPerFrame = ChannelCount * sizeof(SInt16);
+    streamParams.Buffer.Capacity = SampleRate;
+
+    // Create and set custom handler for both control and I/O requests.
+    // You can use separate handlers, but here we use one.
+    auto handler = std::make_shared<ExampleHandler>(sourceParams, streamParams);
+
+    device->SetControlHandler(handler);
+    device->SetIOHandler(handler);
+
+    // Create plugin object, the root of the object hierarchy, and add
+    // our device to it.
+    //
+    // The main purpose of plugin is to provide the list of devices to HAL.
+    //
+    // For simplicity we use default parameters.
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+
+    plugin->AddDevice(device);
+
+    // Create driver, the top-level entry point.
+    // Driver owns plugin object and thus the whole object hierarchy,
+    // and provides C interface for HAL.
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    return driver;
+}
+
+} // namespace
+
+extern "C" void* ExampleEntryPoint(CFAllocatorRef allocator, CFUUIDRef typeUUID)
+{
+    // The UUID of the plug-in type (443ABAB8-E7B3-491A-B985-BEB9187030DB).
+    if (!CFEqual(typeUUID, kAudioServerPlugInTypeUUID)) {
+        return nullptr;
+    }
+
+    // Store shared pointer to the driver to keep it alive.
+    static std::shared_ptr<aspl::Driver> driver = CreateExampleDriver();
+
+    return driver->GetReference();
+}
@@ -0,0 +1,153 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/AsyncTracer.hpp
+//! @brief Asynchronous operation tracer.
+
+#pragma once
+
+#include <aspl/Tracer.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace aspl {
+
+//! Asynchronous tracer parameters.
+struct AsyncTracerParameters
+{
+    //! Where to send messages.
+    //! Should be Tracer::Mode::Stderr or Tracer::Mode::Syslog.
+    //! Other modes drop all messages.
+    Tracer::Mode Mode = Tracer::Mode::Syslog;
+
+    //! How to format messages.
+    Tracer::Style Style = Tracer::Style::Hierarchical;
+
+    //! How many messages can be queued between producer threads and writer
+    //! thread. Rounded up to a power of two. If the queue is full, new messages
+    //! are dropped.
+    UInt32 QueueSize = 1024;
+
+    //! Maximum length of one message in bytes, including prefix.
+    //! Longer messages are truncated.
+    UInt32 MaxMessageLen = 512;
+
+    //! Maximum number of messages written by one system call.
+    UInt32 BatchSize = 64;
+
+    //! How long writer thread sleeps when the queue is empty, in microseconds.
+    UInt32 PollInterval = 10000;
+
+    //! File descriptor used in Tracer::Mode::Stderr.
+    int FileDescriptor = STDERR_FILENO;
+};
+
+//! Asynchronous tracer statistics.
+struct AsyncTracerStats
+{
+    //! Number of messages enqueued by producer threads.
+    UInt64 NumQueuedMessages = 0;
+
+    //! Number of messages dropped because queue was full.
+    UInt64 NumDroppedMessages = 0;
+
+    //! Number of messages passed to stderr or syslog.
+    UInt64 NumWrittenMessages = 0;
+
+    //! Number of write system calls, or syslog() calls.
+    UInt64 NumWriteCalls = 0;
+};
+
+//! Asynchronous operation tracer.
+//!
+//! Same as Tracer in Mode::Stderr or Mode::Syslog, but doesn't perform I/O
+//! on the thread that produced the message. Useful for verbose tracing, when
+//! synchronous syslog() or stderr writes would serialize HAL threads calling
+//! into the plugin.
+//!
+//! Messages are formatted on the calling thread and copied into a preallocated
+//! lock-free multi-producer queue. It never blocks and never allocates memory
+//! besides what formatting itself needs. If the queue is full, message is
+//! dropped and drop counter is incremented.
+//!
+//! A separate writer thread fetches messages from the queue and writes them
+//! in batches: using writev() in Mode::Stderr, or with a series of syslog()
+//! calls in Mode::Syslog. If some messages were dropped, writer thread reports
+//! it with an additional message. Writer thread is never woken up by producers;
+//! instead, it polls the queue when it's empty.
+//!
+//! Destructor writes all queued messages before returning.
+class AsyncTracer : public Tracer
+{
+public:
+    //! Allocate queue and start writer thread.
+    explicit AsyncTracer(const AsyncTracerParameters& params = {});
+
+    //! Write queued messages and stop writer thread.
+    ~AsyncTracer() override;
+
+    //! Get tracer parameters.
+    const AsyncTracerParameters& GetParameters() const;
+
+    //! Wait until all messages enqueued before this call are written.
+    //! Should not be called from realtime threads.
+    void Flush();
+
+    //! Get statistics.
+    //! Can be called from any thread.
+    AsyncTracerStats GetStats() const;
+
+protected:
+    //! Enqueue message for writer thread.
+    void Print(const char* message) override;
+
+private:
+    struct Cell
+    {
+        std::atomic<UInt64> Sequence = 0;
+        UInt32 Size = 0;
+    };
+
+    void WriterLoop();
+    void WriteBatch(UInt64 firstMessage, UInt32 numMessages);
+    void WriteDropReport(UInt64 numDropped);
+
+    char* GetData(UInt64 message);
+
+    const AsyncTracerParameters params_;
+    const UInt64 queueMask_;
+    const UInt32 messageLen_;
+
+    std::unique_ptr<Cell[]> cells_;
+    std::vector<char> data_;
+
+    // claimed by producer threads
+    alignas(64) std::atomic<UInt64> writeIndex_ = 0;
+
+    // advanced by writer thread
+    alignas(64) std::atomic<UInt64> readIndex_ = 0;
+
+    std::atomic<bool> stopRequested_ = false;
+    std::thread thread_;
+
+    // preallocated buffers for system calls, used by writer thread
+    struct Batch;
+    std::unique_ptr<Batch> batch_;
+
+    std::atomic<UInt64> numQueuedMessages_ = 0;
+    std::atomic<UInt64> numDroppedMessages_ = 0;
+    std::atomic<UInt64> numWrittenMessages_ = 0;
+    std::atomic<UInt64> numWriteCalls_ = 0;
+
+    // accessed only by writer thread
+    UInt64 numReportedDrops_ = 0;
+};
+
+} // namespace aspl
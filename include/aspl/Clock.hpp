@@ -0,0 +1,123 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/Clock.hpp
+//! @brief Host clock.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+
+namespace aspl {
+
+//! Host clock.
+//!
+//! Device uses clock to get current host time when I/O is started and when
+//! HAL requests zero timestamp. Host time is measured in abstract ticks,
+//! and clock reports how many ticks are in one second.
+//!
+//! HAL expects host time in mach_absolute_time() units, so on macOS you
+//! typically want to use MachClock, which is the default. Other
+//! implementations are useful to run timing logic in tests and benchmarks,
+//! including on non-Darwin build machines.
+//!
+//! You can provide your own implementation by subclassing Clock and passing
+//! it to Context.
+//!
+//! @note
+//!  Clock methods are called from realtime threads and should be
+//!  realtime-safe.
+class Clock
+{
+public:
+    Clock() = default;
+
+    Clock(const Clock&) = delete;
+    Clock& operator=(const Clock&) = delete;
+
+    virtual ~Clock() = default;
+
+    //! Get current host time, in ticks.
+    virtual UInt64 GetHostTime() const = 0;
+
+    //! Get number of ticks per second.
+    virtual Float64 GetHostClockFrequency() const = 0;
+};
+
+#if defined(__APPLE__)
+//! Darwin clock.
+//! Uses mach_absolute_time() and mach_timebase_info().
+//! This is the clock expected by HAL.
+class MachClock : public Clock
+{
+public:
+    //! Construct clock.
+    MachClock();
+
+    //! Get current host time, in mach absolute time units.
+    UInt64 GetHostTime() const override;
+
+    //! Get number of mach absolute time units per second.
+    Float64 GetHostClockFrequency() const override;
+
+private:
+    Float64 frequency_ = 0;
+};
+#endif
+
+//! Monotonic clock.
+//! Uses clock_gettime() with CLOCK_MONOTONIC, one tick is one nanosecond.
+class MonotonicClock : public Clock
+{
+public:
+    //! Get current host time, in nanoseconds.
+    UInt64 GetHostTime() const override;
+
+    //! Returns 1'000'000'000.
+    Float64 GetHostClockFrequency() const override;
+};
+
+//! Simulated clock.
+//! Host time is changed only when the user calls SetHostTime() or
+//! AdvanceHostTime(). Allows to drive timing logic deterministically,
+//! e.g. to fast-forward device I/O in tests and benchmarks.
+class SimulatedClock : public Clock
+{
+public:
+    //! Construct clock.
+    //! @p frequency defines number of ticks per second.
+    //! @p initialTime defines initial host time.
+    explicit SimulatedClock(Float64 frequency = 1000000000.0, UInt64 initialTime = 0);
+
+    //! Get current host time, in ticks.
+    UInt64 GetHostTime() const override;
+
+    //! Get number of ticks per second, as specified in constructor.
+    Float64 GetHostClockFrequency() const override;
+
+    //! Set current host time, in ticks.
+    void SetHostTime(UInt64 hostTime);
+
+    //! Advance current host time by given number of ticks.
+    void AdvanceHostTime(UInt64 ticks);
+
+    //! Advance current host time by given number of frames at given sample rate.
+    void AdvanceFrames(Float64 frames, Float64 sampleRate);
+
+private:
+    const Float64 frequency_;
+
+    std::atomic<UInt64> hostTime_;
+};
+
+#if defined(__APPLE__)
+//! Default clock type used by Context.
+using DefaultClock = MachClock;
+#else
+//! Default clock type used by Context.
+using DefaultClock = MonotonicClock;
+#endif
+
+} // namespace aspl
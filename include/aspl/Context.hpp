@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <aspl/Clock.hpp>
 #include <aspl/Dispatcher.hpp>
+#include <aspl/MemoryResource.hpp>
+#include <aspl/Profiler.hpp>
 #include <aspl/Tracer.hpp>
 
 #include <CoreAudio/AudioServerPlugIn.h>
@@ -29,19 +32,47 @@ struct Context
     //! All objects use it for logging.
     const std::shared_ptr<Tracer> Tracer;
 
+    //! Host clock.
+    //! Devices use it to calculate zero timestamps.
+    const std::shared_ptr<Clock> Clock;
+
+    //! I/O handler profiler.
+    //! Devices invoke it around I/O handler callbacks.
+    //! Null by default, which disables profiler hooks.
+    const std::shared_ptr<Profiler> Profiler;
+
+    //! Memory resource for internal containers.
+    //! Objects and default dispatcher allocate their internal maps and vectors,
+    //! and all copies made when they are updated, from this resource.
+    //! Null by default, which means global heap.
+    //! Should be thread-safe, e.g. std::pmr::synchronized_pool_resource, since
+    //! objects may be updated from different threads.
+    //! Ignored if std::pmr is not available (see ASPL_HAS_PMR).
+    const std::shared_ptr<MemoryResource> MemoryResource;
+
     //! Plugin host.
     //! Contains method table of HAL.
     //! Initially host is null. It is set during plugin initialization.
     std::atomic<AudioServerPlugInHostRef> Host = nullptr;
 
     //! Create context.
-    //! If dispatcher or tracer is not specified, default one is created.
+    //! If dispatcher, tracer, or clock is not specified, default one is created.
     //! Default tracer sends output to syslog.
+    //! Default clock is DefaultClock (MachClock on macOS).
+    //! Profiler and memory resource are optional and are not created by default.
+    //! If memory resource is specified, default dispatcher uses it too.
     explicit Context(std::shared_ptr<aspl::Tracer> tracer = {},
-        std::shared_ptr<aspl::Dispatcher> dispatcher = {})
-        : Dispatcher(
-              dispatcher ? std::move(dispatcher) : std::make_shared<aspl::Dispatcher>())
+        std::shared_ptr<aspl::Dispatcher> dispatcher = {},
+        std::shared_ptr<aspl::Clock> clock = {},
+        std::shared_ptr<aspl::Profiler> profiler = {},
+        std::shared_ptr<aspl::MemoryResource> memoryResource = {})
+        : Dispatcher(dispatcher ? std::move(dispatcher)
+                                : std::make_shared<aspl::Dispatcher>(
+                                      nullptr, 1000, memoryResource))
         , Tracer(tracer ? std::move(tracer) : std::make_shared<aspl::Tracer>())
+        , Clock(clock ? std::move(clock) : std::make_shared<aspl::DefaultClock>())
+        , Profiler(std::move(profiler))
+        , MemoryResource(std::move(memoryResource))
     {
     }
 };
@@ -10,8 +10,11 @@
 #include <aspl/ControlRequestHandler.hpp>
 #include <aspl/DoubleBuffer.hpp>
 #include <aspl/IORequestHandler.hpp>
+#include <aspl/IOStats.hpp>
+#include <aspl/MemoryResource.hpp>
 #include <aspl/MuteControl.hpp>
 #include <aspl/Object.hpp>
+#include <aspl/ScratchArena.hpp>
 #include <aspl/Stream.hpp>
 #include <aspl/VolumeControl.hpp>
 
@@ -19,6 +22,7 @@
 
 #include <array>
 #include <atomic>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -120,10 +124,47 @@ struct DeviceParameters
     //!   IORequestHandler is responsible for mixing in this case.
     bool EnableMixing = true;
 
+    //! Number of scratch buffers preallocated for IORequestHandler.
+    //! Used by Device::BorrowScratchBuffer().
+    //! If zero, scratch buffers are not allocated.
+    UInt32 ScratchBufferCount = 0;
+
+    //! Maximum number of frames that HAL may request in a single I/O operation.
+    //! Used to size scratch buffers, together with Device::GetZeroTimeStampPeriod();
+    //! the larger of the two is used.
+    UInt32 MaxIOBufferFrameSize = 0;
+
     //! If true, realtime calls are logged to tracer.
-    //! This is not suitable for production use because tracer is not realtime-safe
-    //! and because realtime operations are too frequent.
+    //! This is not suitable for production use because default tracer output
+    //! (syslog or stdio) is not realtime-safe and because realtime operations
+    //! are too frequent.
     bool EnableRealtimeTracing = false;
+
+    //! If true, realtime calls are wrapped into RealtimeScope.
+    //! This allows debugging tools to detect non-realtime-safe operations,
+    //! like allocations and mutex locks, performed by the library or by
+    //! IORequestHandler during I/O.
+    bool EnableRealtimeChecks = false;
+
+    //! If true, configuration change requests are coalesced.
+    //! While a request is already sent to HAL but is not yet performed, new
+    //! requests are appended to it instead of issuing new HAL requests, so
+    //! that HAL stops and restarts I/O only once. Note that if HAL aborts
+    //! such request, all appended changes are dropped together. See also
+    //! Device::BeginConfigurationBatch().
+    bool CoalesceConfigurationChanges = false;
+
+    //! If true, device collects I/O performance counters.
+    //! Handler time of each I/O operation is measured using host clock, and
+    //! counters are available via Device::GetIOStats() and via read-only custom
+    //! property IOStatsSelector, so that apps can poll them with
+    //! AudioObjectGetPropertyData(). Collecting is lock-free and realtime-safe.
+    bool EnableIOStats = false;
+
+    //! Selector of custom property with I/O performance counters.
+    //! Used if EnableIOStats is true. Property value is CFDictionary with
+    //! keys corresponding to IOStats fields.
+    AudioObjectPropertySelector IOStatsSelector = 'iost';
 };
 
 //! Audio device object.
@@ -300,7 +341,9 @@ public:
 
     //! Asynchronously set presentation latency.
     //! Requests HAL to asynchronously invoke SetLatencyImpl().
-    OSStatus SetLatencyAsync(UInt32 latency);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetLatencyAsync(UInt32 latency,
+        std::future<OSStatus>* completion = nullptr);
 
     //! How close to now it is allowed to read and write.
     //! Measured in number of frames.
@@ -312,7 +355,9 @@ public:
 
     //! Asynchronously set safety offset.
     //! Requests HAL to asynchronously invoke SetSafetyOffsetImpl().
-    OSStatus SetSafetyOffsetAsync(UInt32 offset);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetSafetyOffsetAsync(UInt32 offset,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Difference between successive timestamps returned from GetZeroTimeStamp().
     //! Measured in number of frames.
@@ -328,7 +373,9 @@ public:
 
     //! Asynchronously set zero timestamp period.
     //! Requests HAL to asynchronously invoke SetZeroTimeStampPeriodImpl().
-    OSStatus SetZeroTimeStampPeriodAsync(UInt32 period);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetZeroTimeStampPeriodAsync(UInt32 period,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get nominal sample rate.
     //! By default returns the last value set by SetNominalSampleRateAsync().
@@ -341,13 +388,15 @@ public:
 
     //! Asynchronously set nominal sample rate.
     //! Requests HAL to asynchronously invoke SetNominalSampleRateImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     //! Fails if rate is not present in GetAvailableSampleRates(), which by default
     //! returns only one rate, provided during initialization.
     //! If you want to make your device supporting multiple rates, you typically
     //! need to override both of these methods.
     //! @note
     //!  Backs @c kAudioDevicePropertyNominalSampleRate property.
-    OSStatus SetNominalSampleRateAsync(Float64 rate);
+    OSStatus SetNominalSampleRateAsync(Float64 rate,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get list of supported nominal sample rates.
     //! By default returns the list set by SetAvailableSampleRatesAsync().
@@ -364,7 +413,9 @@ public:
     //! Asynchronously set list of supported nominal sample rates.
     //! See comments for GetAvailableSampleRates().
     //! Requests HAL to asynchronously invoke SetAvailableSampleRatesImpl().
-    OSStatus SetAvailableSampleRatesAsync(std::vector<AudioValueRange> rates);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetAvailableSampleRatesAsync(std::vector<AudioValueRange> rates,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Return which two channels to use as left/right for stereo data by default.
     //! By default returns the last value set by SetPreferredChannelsForStereoAsync().
@@ -377,7 +428,9 @@ public:
     //! Asynchronously set channels for stereo.
     //! Channel numbers are 1-based.
     //! Requests HAL to asynchronously invoke SetPreferredChannelsForStereoImpl().
-    OSStatus SetPreferredChannelsForStereoAsync(std::array<UInt32, 2> channels);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetPreferredChannelsForStereoAsync(std::array<UInt32, 2> channels,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get preferred number of channels.
     //!
@@ -403,10 +456,12 @@ public:
     //! Asynchronously set preferred channel count.
     //! See comments for GetPreferredChannelCount().
     //! Requests HAL to asynchronously invoke SetPreferredChannelCountImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     //! @note
     //!  Indirectly backs @c kAudioDevicePropertyPreferredChannelLayout property
     //!  via GetPreferredChannels() / GetPreferredChannelLayout().
-    OSStatus SetPreferredChannelCountAsync(UInt32 channelCount);
+    OSStatus SetPreferredChannelCountAsync(UInt32 channelCount,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get preferred channels for device.
     //!
@@ -433,10 +488,12 @@ public:
     //! Asynchronously set preferred channels array.
     //! See comments for GetPreferredChannels().
     //! Requests HAL to asynchronously invoke SetPreferredChannelsImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     //! @note
     //!  Indirectly backs @c kAudioDevicePropertyPreferredChannelLayout property
     //!  via GetPreferredChannelLayout().
-    OSStatus SetPreferredChannelsAsync(std::vector<AudioChannelDescription> channels);
+    OSStatus SetPreferredChannelsAsync(std::vector<AudioChannelDescription> channels,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get preferred AudioChannelLayout to use for the device.
     //!
@@ -464,7 +521,9 @@ public:
     //! See comments for GetPreferredChannelLayout().
     //! The provided buffer should contain properly formatted AudioChannelLayout struct.
     //! Requests HAL to asynchronously invoke SetPreferredChannelLayoutImpl().
-    OSStatus SetPreferredChannelLayoutAsync(std::vector<UInt8> channelLayout);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetPreferredChannelLayoutAsync(std::vector<UInt8> channelLayout,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Check whether the device is doing I/O.
     //! By default, returns true if I/O was activated using StartIO().
@@ -831,6 +890,33 @@ public:
     //! For details about life-time, see SetIOHandler().
     IORequestHandler* GetIOHandler() const;
 
+    //! Borrow scratch buffer for temporary data.
+    //! Intended for IORequestHandler methods that need temporary memory for
+    //! effects, conversion, or resampling.
+    //! @remarks
+    //!  Buffers are preallocated, so borrowing is O(1) and realtime-safe.
+    //!  There are DeviceParameters::ScratchBufferCount buffers; each one holds
+    //!  max(GetZeroTimeStampPeriod(), DeviceParameters::MaxIOBufferFrameSize)
+    //!  frames of the largest channel count among device streams and
+    //!  GetPreferredChannelCount(), as 32-bit floats.
+    //! @remarks
+    //!  Returns empty handle if all buffers are borrowed.
+    //! @note
+    //!  Buffers are reallocated only when a configuration change affects their
+    //!  size, from PerformConfigurationChange() or when a change is applied in-place.
+    //! @note
+    //!  Should be called only from IORequestHandler methods, or other code
+    //!  that runs inside I/O operations. Returned buffer should be released
+    //!  before I/O is stopped.
+    ScratchBuffer BorrowScratchBuffer();
+
+    //! Get I/O performance counters.
+    //! Returns zero counters if DeviceParameters::EnableIOStats is false.
+    //! @remarks
+    //!  Can be called from any thread. Counters are read without locks and
+    //!  may be updated by concurrent I/O operation while being read.
+    IOStats GetIOStats() const;
+
     //! Get the current zero time stamp for the device.
     //! In default implementation, the zero time stamp and host time are increased
     //! every GetZeroTimeStampPeriod() frames.
@@ -929,8 +1015,50 @@ public:
     //!     is not added to the plugin hierarchy yet, and thus HAL doesn't use Device.
     //!   - If the method is invoked from PerformConfigurationChange(), it assumes
     //!     that we're already at the point where it's safe to change configuration.
+    //!  If DeviceParameters::CoalesceConfigurationChanges is true and there is
+    //!  a request sent to HAL but not yet performed, the function is appended
+    //!  to that request and will be invoked by the same PerformConfigurationChange()
+    //!  call, after previously appended functions.
+    //!  Between BeginConfigurationBatch() and EndConfigurationBatch(), the function
+    //!  is not invoked or enqueued, but is saved until the end of the batch.
     virtual void RequestConfigurationChange(std::function<void()> func = {});
 
+    //! Status reported for configuration changes that were never performed.
+    //! Used by RequestConfigurationChangeWithResult().
+    static constexpr OSStatus ConfigurationChangeAbortedError = 'cabt';
+
+    //! Request HAL to perform configuration update and report its result.
+    //! Same as RequestConfigurationChange(), but the function returns status,
+    //! and the returned future becomes ready with this status after the function
+    //! is invoked. This allows to wait until the change is actually applied
+    //! without polling properties.
+    //! @remarks
+    //!  If the change is never performed, e.g. because HAL invoked
+    //!  AbortConfigurationChange(), or because device was destroyed,
+    //!  the future becomes ready with ConfigurationChangeAbortedError.
+    //! @note
+    //!  Don't wait for the future while holding locks that may be needed to
+    //!  perform the change, e.g. from within another configuration change.
+    std::future<OSStatus> RequestConfigurationChangeWithResult(
+        std::function<OSStatus()> func);
+
+    //! Begin batch of configuration changes.
+    //! Until the matching EndConfigurationBatch(), functions passed to
+    //! RequestConfigurationChange(), including by *Async() setters, are
+    //! only saved. Batches may be nested.
+    //! @remarks
+    //!  Useful when changing many parameters at once, e.g. sample rate, latency,
+    //!  and stream formats. Every configuration change makes HAL stop and restart
+    //!  I/O, so merging them into one reduces audio dropouts.
+    void BeginConfigurationBatch();
+
+    //! End batch of configuration changes.
+    //! When the outermost batch ends, all functions saved during the batch are
+    //! passed to HAL as a single configuration change request, or invoked
+    //! in-place, following the same rules as RequestConfigurationChange().
+    //! Functions are invoked in the same order as they were requested.
+    void EndConfigurationBatch();
+
     //! Request device to change its owner.
     //! @remarks
     //!  This method is called by Device owner (Plugin object) when device is added
@@ -1191,6 +1319,13 @@ protected:
         void* ioMainBuffer,
         void* ioSecondaryBuffer);
 
+    //! Get zero timestamp returned by the last GetZeroTimeStamp() call.
+    //! The same value is passed as @c zeroTimestamp to IORequestHandler methods.
+    //! @note
+    //!  Intended for DoIOOperationImpl() overrides; should be called only
+    //!  from I/O operations.
+    Float64 GetCurrentZeroTimestamp() const;
+
     //! Called after performing I/O operation.
     //! Invoked by EndIOOperation().
     //! @remarks
@@ -1206,6 +1341,18 @@ private:
     // value checkers for async setters
     OSStatus CheckNominalSampleRate(Float64 rate) const;
 
+    // send functions to HAL as one configuration change, or invoke in-place
+    void SubmitConfigurationChange(std::vector<std::function<void()>> funcs);
+
+    // reallocate scratch buffers if their size changed
+    void UpdateScratchArena();
+
+    // free scratch buffers replaced by UpdateScratchArena()
+    void ReleaseRetiredScratchArenas();
+
+    // build value of IOStatsSelector property
+    CFPropertyListRef CopyIOStatsPropertyList() const;
+
     // these fields are immutable and can be accessed w/o lock
     const DeviceParameters params_;
     const std::string deviceUID_;
@@ -1227,6 +1374,10 @@ private:
 
     std::atomic<SInt32> startCount_ = 0;
 
+    // scratch buffers borrowed by I/O handler, points to last arena in
+    // scratchArenas_; replaced without locking ioMutex_
+    std::atomic<ScratchArena*> scratchArena_ = nullptr;
+
     // serializes writing to fields below
     mutable std::recursive_mutex writeMutex_;
 
@@ -1236,26 +1387,25 @@ private:
     DoubleBuffer<std::optional<std::vector<AudioChannelDescription>>> preferredChannels_;
     DoubleBuffer<std::optional<std::vector<UInt8>>> preferredChannelLayout_;
 
-    DoubleBuffer<std::unordered_map<Direction, std::vector<std::shared_ptr<Stream>>>>
-        streams_;
+    DoubleBuffer<UnorderedMap<Direction, Vector<std::shared_ptr<Stream>>>> streams_;
 
-    DoubleBuffer<std::unordered_map<AudioObjectID, std::shared_ptr<Stream>>> streamByID_;
+    DoubleBuffer<UnorderedMap<AudioObjectID, std::shared_ptr<Stream>>> streamByID_;
 
-    DoubleBuffer<std::unordered_map<AudioObjectPropertyScope,
-        std::vector<std::shared_ptr<VolumeControl>>>>
+    DoubleBuffer<
+        UnorderedMap<AudioObjectPropertyScope, Vector<std::shared_ptr<VolumeControl>>>>
         volumeControls_;
 
-    DoubleBuffer<std::unordered_map<AudioObjectID, std::shared_ptr<VolumeControl>>>
+    DoubleBuffer<UnorderedMap<AudioObjectID, std::shared_ptr<VolumeControl>>>
         volumeControlByID_;
 
-    DoubleBuffer<std::unordered_map<AudioObjectPropertyScope,
-        std::vector<std::shared_ptr<MuteControl>>>>
+    DoubleBuffer<
+        UnorderedMap<AudioObjectPropertyScope, Vector<std::shared_ptr<MuteControl>>>>
         muteControls_;
 
-    DoubleBuffer<std::unordered_map<AudioObjectID, std::shared_ptr<MuteControl>>>
+    DoubleBuffer<UnorderedMap<AudioObjectID, std::shared_ptr<MuteControl>>>
         muteControlByID_;
 
-    DoubleBuffer<std::unordered_map<UInt32, std::shared_ptr<Client>>> clientByID_;
+    DoubleBuffer<UnorderedMap<UInt32, std::shared_ptr<Client>>> clientByID_;
 
     DoubleBuffer<
         std::variant<std::shared_ptr<ControlRequestHandler>, ControlRequestHandler*>>
@@ -1263,11 +1413,21 @@ private:
     DoubleBuffer<std::variant<std::shared_ptr<IORequestHandler>, IORequestHandler*>>
         ioHandler_;
 
-    std::map<UInt64, std::function<void()>> pendingConfigurationRequests_;
+    // requests sent to HAL, each may hold multiple coalesced functions
+    std::map<UInt64, std::vector<std::function<void()>>> pendingConfigurationRequests_;
+    std::vector<std::function<void()>> batchedConfigurationRequests_;
+    UInt32 configurationBatchDepth_ = 0;
     UInt64 lastConfigurationRequestID_ = 0;
     UInt64 insideConfigurationHandler_ = 0;
 
+    // current scratch arena and arenas replaced while I/O was running,
+    // which may be still used by concurrent I/O operation
+    std::vector<std::unique_ptr<ScratchArena>> scratchArenas_;
+
     // serializes I/O operations and protects fields below
+    // on realtime threads, locked inside RealtimeScope using try-lock first;
+    // it's contended by StartIO() and StopIO(), and waiting for them is
+    // reported by realtime checks
     mutable std::recursive_mutex ioMutex_;
 
     // how much host clock ticks are per audio frame and what was the sample
@@ -1282,6 +1442,9 @@ private:
     // current zero timestamp, last values returned by GetZeroTimeStamp()
     Float64 currentPeriodTimestamp_ = 0;
     UInt64 currentPeriodHostTime_ = 0;
+
+    // I/O performance counters, null if disabled
+    std::unique_ptr<IOStatsCollector> ioStats_;
 };
 
 } // namespace aspl
@@ -0,0 +1,141 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/DevicePool.hpp
+//! @brief Pool of pre-built devices.
+
+#pragma once
+
+#include <aspl/Context.hpp>
+#include <aspl/Device.hpp>
+#include <aspl/Stream.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aspl {
+
+//! Device pool parameters.
+//! Defines the shape of devices built by the pool.
+struct DevicePoolParameters
+{
+    //! Parameters of every device.
+    //! DeviceParameters::DeviceUID is ignored: every device gets its own
+    //! unique UID, generated from DeviceParameters::ModelUID.
+    DeviceParameters Device;
+
+    //! Streams added to every device.
+    std::vector<StreamParameters> Streams;
+
+    //! If true, every stream gets volume and mute controls.
+    bool AddControls = true;
+
+    //! How many devices to keep ready.
+    UInt32 Size = 4;
+};
+
+//! Device pool statistics.
+struct DevicePoolStats
+{
+    //! Number of devices ready to be acquired.
+    UInt64 NumReady = 0;
+
+    //! Number of released devices waiting to be destroyed.
+    UInt64 NumReleased = 0;
+
+    //! Number of devices acquired from the pool.
+    UInt64 NumAcquired = 0;
+
+    //! Number of devices that had to be built on acquire because pool was empty.
+    UInt64 NumMisses = 0;
+};
+
+//! Pool of pre-built devices.
+//!
+//! Useful for drivers that create and destroy devices dynamically and often,
+//! e.g. from Driver::CreateDevice() and Driver::DestroyDevice(). Building
+//! a device involves constructing device, streams, and controls, registering
+//! every object in Dispatcher, and allocating their state. Pool does all that
+//! in advance, so that creating a device is reduced to taking a ready object
+//! graph and publishing it via Plugin::AddDevice().
+//!
+//! Acquire() returns a ready device, or builds a new one if the pool is empty.
+//! Release() takes a device that was removed from plugin and defers its
+//! destruction. Refill() destroys released devices and builds new ones until
+//! there are DevicePoolParameters::Size ready devices. It should be called
+//! when there is time for it, e.g. from a background thread after a device
+//! was created or destroyed.
+//!
+//! Released devices are never handed out again. Instead, every device built
+//! by the pool gets fresh object IDs and device UID, so HAL and apps never see
+//! a new device with identity of a destroyed one.
+//!
+//! All methods are thread-safe. They should not be called from realtime threads.
+class DevicePool
+{
+public:
+    //! Function that builds a device.
+    //! It's given parameters with unique UID and should construct and populate
+    //! the device, but not add it to plugin.
+    using Factory = std::function<std::shared_ptr<Device>(
+        const std::shared_ptr<const Context>& context,
+        const DeviceParameters& params)>;
+
+    //! Create pool.
+    //! If @p factory is not set, devices are built using DevicePoolParameters.
+    //! Pool is initially empty; call Refill() to fill it.
+    explicit DevicePool(std::shared_ptr<const Context> context,
+        const DevicePoolParameters& params = {},
+        Factory factory = {});
+
+    DevicePool(const DevicePool&) = delete;
+    DevicePool& operator=(const DevicePool&) = delete;
+
+    ~DevicePool();
+
+    //! Get pool parameters.
+    const DevicePoolParameters& GetParameters() const;
+
+    //! Take ready device from pool.
+    //! If there are no ready devices, builds a new one.
+    std::shared_ptr<Device> Acquire();
+
+    //! Return device to pool.
+    //! Device should be already removed from plugin. It will be destroyed
+    //! during next Refill() call, unless it's referenced elsewhere.
+    void Release(std::shared_ptr<Device> device);
+
+    //! Destroy released devices and build new ones.
+    //! Builds devices until there are DevicePoolParameters::Size ready devices.
+    //! Objects are built and destroyed without holding pool lock, so Acquire()
+    //! and Release() are not blocked meanwhile.
+    void Refill();
+
+    //! Get statistics.
+    DevicePoolStats GetStats() const;
+
+private:
+    std::shared_ptr<Device> Build();
+
+    const std::shared_ptr<const Context> context_;
+    const DevicePoolParameters params_;
+    const Factory factory_;
+
+    // serializes Refill() calls
+    std::mutex refillMutex_;
+
+    // protects fields below
+    mutable std::mutex mutex_;
+
+    std::vector<std::shared_ptr<Device>> readyDevices_;
+    std::vector<std::shared_ptr<Device>> releasedDevices_;
+
+    UInt64 numAcquired_ = 0;
+    UInt64 numMisses_ = 0;
+};
+
+} // namespace aspl
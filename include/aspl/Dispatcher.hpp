@@ -7,6 +7,7 @@
 #pragma once
 
 #include <aspl/DoubleBuffer.hpp>
+#include <aspl/MemoryResource.hpp>
 #include <aspl/Tracer.hpp>
 
 #include <CoreAudio/AudioServerPlugIn.h>
@@ -16,12 +17,11 @@
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
-#include <unordered_set>
-#include <vector>
 
 namespace aspl {
 
 class Object;
+class ObjectIDAllocator;
 
 //! Object dispatcher.
 //!
@@ -33,6 +33,8 @@ class Object;
 //!
 //! The allocation algorithm tries to delay identifier reuse for a while, to
 //! give you a chance to catch bugs with looking up recently freed objects.
+//! Allocated identifiers are tracked in a two-level bitmap, so allocation
+//! and freeing take constant amortized time even with many objects.
 //!
 //! Dispatcher stores weak references to objects and thus does not affect
 //! their reference counter.
@@ -41,7 +43,12 @@ class Dispatcher
 public:
     //! Construct dispatcher.
     //! Use tracer if you want to debug dispatcher itself, it is quite verbose.
-    Dispatcher(std::shared_ptr<Tracer> tracer = {}, AudioObjectID hintMaximumID = 1000);
+    //! If memory resource is specified, internal maps are allocated from it.
+    Dispatcher(std::shared_ptr<Tracer> tracer = {},
+        AudioObjectID hintMaximumID = 1000,
+        std::shared_ptr<MemoryResource> memoryResource = {});
+
+    ~Dispatcher();
 
     Dispatcher(const Dispatcher&) = delete;
     Dispatcher& operator=(const Dispatcher&) = delete;
@@ -79,48 +86,26 @@ private:
         std::shared_mutex mutex;
     };
 
-    AudioObjectID AllocateID();
-    void FreeID(AudioObjectID objectID);
-
-    AudioObjectID FindFreeID(AudioObjectID startID) const;
-    bool IsFree(AudioObjectID objectID) const;
-    void SetFree(AudioObjectID objectID, bool free);
-
-    using BitChunk = UInt64;
-    static constexpr size_t BitsPerChunk = sizeof(BitChunk) * 8;
-
     // Optional tracer.
     const std::shared_ptr<Tracer> tracer_;
 
-    // Identifiers that should not be auto-allocated.
-    const std::unordered_set<AudioObjectID> reservedIDs_ = {
-        kAudioObjectUnknown,
-        kAudioObjectPlugInObject,
-    };
+    // Optional memory resource.
+    // Declared before containers to outlive them.
+    const std::shared_ptr<MemoryResource> memoryResource_;
 
     // Registered objects.
     // We store raw pointers instead of shared_ptr to allow object registration
     // to happen in Object constructor. At that point, there is no shared_ptr
     // yet and shared_from_this() can't be used either. Thus, we delay
     // shared_from_this() call to the time when FindObject() is called.
-    DoubleBuffer<std::unordered_map<AudioObjectID, std::shared_ptr<Registration>>>
+    DoubleBuffer<UnorderedMap<AudioObjectID, std::shared_ptr<Registration>>>
         registeredObjects_;
 
     // Serializes (de)registration operations and protects fields below.
     std::mutex registrationMutex_;
 
-    // Bitset with allocated identifiers.
-    std::vector<BitChunk> allocatedBits_;
-
-    size_t numAllocatedIDs_ = 0;
-    AudioObjectID lastAllocatedID_ = 0;
-
-    // The maximum value below which we're currently trying to keep identifiers.
-    // If the next identifier exceeds this value, and there are quite a lot of
-    // free identifiers below the maximum, we'll reuse one of them. Otherwise,
-    // if there are too little free identifiers below the maximum, we'll increase
-    // the maximum instead.
-    AudioObjectID desiredMaximumID_;
+    // Allocated identifiers.
+    const std::unique_ptr<ObjectIDAllocator> idAllocator_;
 };
 
 } // namespace aspl
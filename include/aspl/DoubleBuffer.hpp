@@ -9,9 +9,11 @@
 #include <CoreFoundation/CoreFoundation.h>
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace aspl {
@@ -24,7 +26,8 @@ namespace aspl {
 //!  - getters are running concurrently, and setters are serialized
 //!
 //!  - setter is blocking; it may be blocked by both getters and setters,
-//!    but in the average case only by setters
+//!    but in the average case only by setters; when waiting for getters,
+//!    it spins and yields
 //!
 //!  - getter is non-blocking and lock-free; it does not block if a setter
 //!    thread is suspended in the middle
@@ -51,6 +54,13 @@ namespace aspl {
 //!  - the value is not very large and it's acceptable to make
 //!    extra copies
 //!
+//!  - read locks are held for a short time
+//!
+//! Instead of a reader-writer mutex, each copy has an atomic counter of
+//! getters using it, so that the buffer stays compact. This matters because
+//! every object has a few double buffers, and there may be thousands of
+//! objects.
+//!
 //! The value stored in the double buffer is immutable after it's set. To
 //! change the value, you need to call the getter, make a copy, modify it,
 //! and pass it to the setter.
@@ -62,6 +72,10 @@ namespace aspl {
 //! until the previously used value is not accessed by readers anymore and
 //! invokes destructor for the old value.
 //!
+//! If the value is an allocator-aware container, and the buffer was
+//! constructed with an allocator (see std::allocator_arg constructor), both
+//! buffers and all copies made by getter and setter use that allocator.
+//!
 //! Typical reader looks like the following:
 //! @code
 //!   DoubleBuffer<T> fooBuf;
@@ -96,11 +110,29 @@ class DoubleBuffer
 {
     using BufferIndex = SInt64;
 
+    template <typename U, typename = void>
+    struct AllocatorOf
+    {
+        struct type
+        {
+        };
+        static constexpr bool IsAware = false;
+    };
+
+    template <typename U>
+    struct AllocatorOf<U, std::void_t<typename U::allocator_type>>
+    {
+        using type = typename U::allocator_type;
+        static constexpr bool IsAware = true;
+    };
+
+    using AllocatorType = typename AllocatorOf<T>::type;
+
     struct Buffer
     {
         std::optional<T> value = {};
         std::atomic<BufferIndex> index = -1;
-        mutable std::shared_mutex mutex;
+        mutable std::atomic<UInt32> numReaders = 0;
     };
 
 public:
@@ -126,37 +158,36 @@ public:
                 // Get reference to the current buffer.
                 auto& currentBuffer = doubleBuffer.GetBufferAt(currentIndex);
 
-                // Try to lock buffer for reading.
+                // Register ourselves as a reader of the buffer.
+                currentBuffer.numReaders.fetch_add(1);
+
+                // Check that the buffer index still matches the our current index
+                // after registering.
                 //
-                // The lock can fail in the case when, after we loaded the current
-                // index, but before obtained the lock, the setter was called and
-                // finished once, and then was called another time and is currently
-                // in progress. Here we should retry and re-read current index.
+                // The check fails in the case when, after we loaded the current
+                // index, but before registered, the setter was called and finished
+                // once, and then was called another time and is either in progress
+                // or finished. Here we should retry and re-read current index.
+                //
+                // The setter first updates buffer index and then waits for readers,
+                // and we first register and then check buffer index. Hence, either
+                // we see the updated index, or the setter sees us.
                 //
                 // We're still lock-free because even if the ongoing setter is
                 // suspended, we wont block. Instead, on the next try we will
-                // switch to another buffer and will successfully obtain the lock.
+                // switch to another buffer and will successfully register.
                 //
                 // However, we're not wait-free because while this situation is
                 // repeating and new setters continue to come and preempt us, we'll
                 // have to retry. Fortunately, this is very unlikely to happen.
-                if (!currentBuffer.mutex.try_lock_shared()) {
-                    continue;
-                }
-
-                // Check that the buffer index still matches the our current index
-                // after obtaining the lock.
-                //
-                // This check catches the case similar to the above one, but when
-                // the second setter is already finished.
                 if (currentBuffer.index.load() != currentIndex) {
-                    currentBuffer.mutex.unlock_shared();
+                    currentBuffer.numReaders.fetch_sub(1);
                     continue;
                 }
 
                 // At this point, it is guaranteed that any setter will see that
-                // we're using the buffer and wont rewrite it until we release
-                // the lock in destructor.
+                // we're using the buffer and wont rewrite it until we unregister
+                // in destructor.
                 buffer_ = &currentBuffer;
                 return;
             }
@@ -166,7 +197,7 @@ public:
         ~ReadLock()
         {
             if (buffer_) {
-                buffer_->mutex.unlock_shared();
+                buffer_->numReaders.fetch_sub(1);
             }
         }
 
@@ -205,6 +236,18 @@ public:
         Set(std::move(value));
     }
 
+    //! Initialize buffer with empty value using given allocator.
+    //! Subsequent copies of the value will use the same allocator.
+    //! Available only if the value is allocator-aware.
+    template <typename Alloc>
+    DoubleBuffer(std::allocator_arg_t, const Alloc& alloc)
+        : allocator_(AllocatorType(alloc))
+    {
+        static_assert(AllocatorOf<T>::IsAware, "value should be allocator-aware");
+
+        Set(T(*allocator_));
+    }
+
     ~DoubleBuffer() = default;
 
     DoubleBuffer(const DoubleBuffer&) = delete;
@@ -223,6 +266,12 @@ public:
     {
         ReadLock readLock(*this);
 
+        if constexpr (AllocatorOf<T>::IsAware) {
+            if (allocator_) {
+                return T(readLock.GetReference(), *allocator_);
+            }
+        }
+
         return T(readLock.GetReference());
     }
 
@@ -265,17 +314,27 @@ public:
 
             // Wait until finishing of ongoing getters that are still using this buffer.
             //
-            // After we obtain the lock, we can be sure that old getters are either
+            // After there are no readers, we can be sure that old getters are either
             // finished or will see the index which we've updated above and wont use the
             // buffer.
             //
             // Note that since it is the other buffer, not the current one, chances are
-            // that there are no getters already, and most times we will acquire the lock
-            // immediately here.
-            std::unique_lock lock(newBuffer.mutex);
+            // that there are no getters already, and most times we won't wait here.
+            WaitReaders(newBuffer);
 
             // Forward the value to the buffer.
-            newBuffer.value = std::forward<TT>(value);
+            // If we have an allocator, construct the value in place, to ensure
+            // that it uses our allocator regardless of the allocator of the
+            // source value.
+            if constexpr (AllocatorOf<T>::IsAware) {
+                if (allocator_) {
+                    newBuffer.value.emplace(std::forward<TT>(value), *allocator_);
+                } else {
+                    newBuffer.value = std::forward<TT>(value);
+                }
+            } else {
+                newBuffer.value = std::forward<TT>(value);
+            }
         }
 
         // Switch current buffer index to the new buffer.
@@ -290,7 +349,7 @@ public:
 
             // Wait until finishing of ongoing getters that are still using the buffer.
             // Here we can block for a while.
-            std::unique_lock lock(oldBuffer.mutex);
+            WaitReaders(oldBuffer);
 
             // Destroy value.
             // This is needed to provide semantics of "replacing" value. We've written
@@ -312,6 +371,15 @@ private:
         return buffers_[index % 2];
     }
 
+    static void WaitReaders(const Buffer& buffer)
+    {
+        while (buffer.numReaders.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::optional<AllocatorType> allocator_;
+
     std::mutex writeMutex_;
 
     Buffer buffers_[2];
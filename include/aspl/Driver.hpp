@@ -20,6 +20,8 @@
 
 namespace aspl {
 
+class RunningDevices;
+
 //! Plugin driver.
 //!
 //! Driver is the top-level object of AudioServer plugin. It contains Plugin
@@ -36,6 +38,11 @@ namespace aspl {
 //! in Context::Dispatcher. Every object requires Context as constructor argument
 //! and automatically registers and unregisters itself in Dispatcher.
 //!
+//! Realtime I/O operations are an exception: when StartIO succeeds, driver pins
+//! the device in a small per-driver cache of running devices, and until matching
+//! StopIO, I/O operations resolve device from this cache using plain atomic loads,
+//! without locks and reference counting.
+//!
 //! Driver also provides Storage object, which provides API for persistent storage
 //! associated with plugin, and managed by CoreAudio daemon.
 //!
@@ -132,6 +139,8 @@ protected:
     virtual OSStatus DestroyDevice(AudioObjectID objectID);
 
 private:
+    friend class Bridge;
+
     // COM methods
     static HRESULT QueryInterface(void* driverRef, REFIID iid, LPVOID* outInterface);
 
@@ -154,6 +163,9 @@ private:
     const std::shared_ptr<Plugin> plugin_;
     const std::shared_ptr<Storage> storage_;
 
+    // Devices with running I/O, used by realtime trampolines
+    const std::unique_ptr<RunningDevices> runningDevices_;
+
     // User-provided handler
     DoubleBuffer<
         std::variant<std::shared_ptr<DriverRequestHandler>, DriverRequestHandler*>>
@@ -0,0 +1,169 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/IOStats.hpp
+//! @brief I/O performance counters.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <array>
+#include <atomic>
+
+namespace aspl {
+
+//! Timing statistics for one type of I/O operation.
+//! All times are in nanoseconds.
+struct IOOperationStats
+{
+    //! Number of invocations.
+    UInt64 NumCalls = 0;
+
+    //! Minimum handler time.
+    UInt64 MinTimeNs = 0;
+
+    //! Average handler time.
+    UInt64 AvgTimeNs = 0;
+
+    //! Maximum handler time.
+    UInt64 MaxTimeNs = 0;
+
+    //! 99th percentile of handler time.
+    //! Computed from fixed histogram buckets, so it is an upper bound
+    //! with about 25% precision.
+    UInt64 P99TimeNs = 0;
+};
+
+//! I/O performance counters of a device.
+//! All counters are cumulative since device creation.
+struct IOStats
+{
+    //! Number of I/O cycles.
+    UInt64 NumCycles = 0;
+
+    //! Number of cycles that started more than one zero timestamp period
+    //! after the last zero timestamp reported to HAL.
+    UInt64 NumLateCycles = 0;
+
+    //! Number of cycles in which total handler time exceeded cycle duration,
+    //! i.e. handlers did not keep up with realtime.
+    UInt64 NumOverruns = 0;
+
+    //! Number of cycles which were not contiguous with the previous one,
+    //! i.e. HAL skipped samples or restarted timeline.
+    UInt64 NumUnderruns = 0;
+
+    //! Number of clients that currently do I/O.
+    UInt32 NumActiveClients = 0;
+
+    //! Time spent in reading input.
+    //! Corresponds to kAudioServerPlugInIOOperationReadInput.
+    IOOperationStats ReadInput;
+
+    //! Time spent in processing input.
+    //! Corresponds to kAudioServerPlugInIOOperationProcessInput.
+    IOOperationStats ProcessInput;
+
+    //! Time spent in processing and writing client output.
+    //! Corresponds to kAudioServerPlugInIOOperationMixOutput.
+    IOOperationStats MixOutput;
+
+    //! Time spent in processing mixed output.
+    //! Corresponds to kAudioServerPlugInIOOperationProcessMix.
+    IOOperationStats ProcessMix;
+
+    //! Time spent in writing mixed output.
+    //! Corresponds to kAudioServerPlugInIOOperationWriteMix.
+    IOOperationStats WriteMix;
+};
+
+//! Collects I/O performance counters.
+//!
+//! Device creates collector if DeviceParameters::EnableIOStats is set and
+//! calls BeginOperation() and EndOperation() around DoIOOperationImpl().
+//!
+//! Begin and end methods never allocate or lock and are realtime-safe.
+//! They should be serialized, which is the case for Device I/O operations.
+//! GetStats() may be called concurrently from any thread; it reads counters
+//! without locks, so the returned snapshot may be slightly inconsistent
+//! (e.g. operation counters may be ahead of cycle counters by one cycle).
+class IOStatsCollector
+{
+public:
+    //! Construct collector.
+    //! @p hostClockFrequency defines number of host time ticks per second.
+    explicit IOStatsCollector(Float64 hostClockFrequency);
+
+    IOStatsCollector(const IOStatsCollector&) = delete;
+    IOStatsCollector& operator=(const IOStatsCollector&) = delete;
+
+    //! Called before I/O operation.
+    //! @p hostTime is current host time.
+    //! @p zeroHostTime is host time of the last zero timestamp.
+    //! @p hostTicksPerPeriod is duration of zero timestamp period, in ticks.
+    //! Detects start of a new cycle using @p cycleInfo and updates
+    //! cycle counters.
+    void BeginOperation(const AudioServerPlugInIOCycleInfo& cycleInfo,
+        UInt64 hostTime,
+        UInt64 zeroHostTime,
+        Float64 hostTicksPerPeriod);
+
+    //! Called after I/O operation.
+    //! @p hostTime is current host time.
+    //! Updates counters of given operation.
+    void EndOperation(UInt32 operationID, UInt64 hostTime);
+
+    //! Get snapshot of counters.
+    //! NumActiveClients is not tracked by collector and is left zero.
+    IOStats GetStats() const;
+
+private:
+    // 4 buckets per power of two
+    static constexpr UInt32 NumSubBucketBits = 2;
+    static constexpr UInt32 NumBuckets = 64 << NumSubBucketBits;
+
+    struct OperationCounters
+    {
+        std::atomic<UInt64> numCalls = 0;
+        std::atomic<UInt64> totalTimeNs = 0;
+        std::atomic<UInt64> minTimeNs = 0;
+        std::atomic<UInt64> maxTimeNs = 0;
+        std::array<std::atomic<UInt64>, NumBuckets> buckets;
+    };
+
+    static UInt32 BucketIndex(UInt64 timeNs);
+    static UInt64 BucketUpperBound(UInt32 index);
+
+    static IOOperationStats GetOperationStats(const OperationCounters& counters);
+
+    OperationCounters* FindOperation(UInt32 operationID);
+
+    // atomic increment by single writer
+    static void Increment(std::atomic<UInt64>& counter, UInt64 delta = 1);
+
+    const Float64 nsPerTick_;
+
+    std::atomic<UInt64> numCycles_ = 0;
+    std::atomic<UInt64> numLateCycles_ = 0;
+    std::atomic<UInt64> numOverruns_ = 0;
+    std::atomic<UInt64> numUnderruns_ = 0;
+
+    OperationCounters readInput_;
+    OperationCounters processInput_;
+    OperationCounters mixOutput_;
+    OperationCounters processMix_;
+    OperationCounters writeMix_;
+
+    // state of current cycle, accessed only by writer
+    bool hasCycle_ = false;
+    UInt64 cycleCounter_ = 0;
+    Float64 cycleSampleTime_ = 0;
+    UInt32 cycleFrameCount_ = 0;
+    UInt64 cycleBudgetTicks_ = 0;
+    UInt64 cycleTicks_ = 0;
+    bool cycleOverrun_ = false;
+    UInt64 operationStartTime_ = 0;
+};
+
+} // namespace aspl
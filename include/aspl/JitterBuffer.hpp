@@ -0,0 +1,158 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/JitterBuffer.hpp
+//! @brief Timestamp-aligned jitter buffer.
+
+#pragma once
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace aspl {
+
+//! How JitterBuffer fills frames that were not received in time.
+enum class ConcealmentMode
+{
+    //! Fill missing frames with zeros.
+    Silence,
+
+    //! Repeat frames from JitterBufferParameters::RepeatPeriod frames earlier,
+    //! if they're available; otherwise fill with zeros.
+    Repeat,
+};
+
+//! Jitter buffer parameters.
+struct JitterBufferParameters
+{
+    //! Size of one frame in bytes, i.e. number of channels multiplied by
+    //! sample size.
+    UInt32 BytesPerFrame = 8;
+
+    //! How many frames can be buffered.
+    //! Packets with sample time more than Capacity frames ahead of the
+    //! read position are dropped.
+    UInt32 Capacity = 16384;
+
+    //! How to fill frames that were not received in time.
+    ConcealmentMode Concealment = ConcealmentMode::Silence;
+
+    //! Distance in frames to the frames repeated by ConcealmentMode::Repeat.
+    //! Typically set to packet size.
+    UInt32 RepeatPeriod = 0;
+};
+
+//! Jitter buffer statistics.
+struct JitterBufferStats
+{
+    //! Number of packets passed to Write().
+    UInt64 NumPackets = 0;
+
+    //! Number of packets that were already fully present in buffer.
+    UInt64 NumDuplicatePackets = 0;
+
+    //! Number of packets that had frames with sample time that was already read.
+    UInt64 NumLatePackets = 0;
+
+    //! Number of packets that had frames too far ahead of the read position.
+    UInt64 NumOverflowPackets = 0;
+
+    //! Number of frames that were not received by the time when they were
+    //! read for the first time, and were concealed.
+    UInt64 NumLostFrames = 0;
+
+    //! Distance in frames from the read position to the end of the latest
+    //! received frame. Zero until the first Read().
+    UInt64 Depth = 0;
+};
+
+//! Timestamp-aligned jitter buffer.
+//!
+//! Stores frames by their sample time. Intended for devices that receive
+//! samples from network or another source with variable latency, and need
+//! to serve IORequestHandler::OnReadClientInput() by sample time.
+//!
+//! Packets are written by a single worker thread in any order, and the buffer
+//! takes care of reordering, deduplication, and dropping late packets. Frames
+//! are read by realtime thread using the requested sample time window; frames
+//! that are missing from the window are concealed according to
+//! JitterBufferParameters::Concealment.
+//!
+//! Every frame slot has an atomic tag with the sample time of the frame
+//! it holds. Write() invalidates the tag, copies the frame, and publishes the
+//! tag; Read() validates the tag before and after copying the frame. Thus
+//! Read() is lock-free and never waits for writer, and writer never waits
+//! for reader. Runs of present frames that are contiguous in storage are
+//! validated and copied at once.
+//!
+//! Multiple Read() calls for the same window are allowed, e.g. one per client.
+//! Read() and Write() may be called concurrently with each other, but not with
+//! themselves.
+class JitterBuffer
+{
+public:
+    //! Allocate buffer.
+    explicit JitterBuffer(const JitterBufferParameters& params = {});
+
+    JitterBuffer(const JitterBuffer&) = delete;
+    JitterBuffer& operator=(const JitterBuffer&) = delete;
+
+    //! Get buffer parameters.
+    const JitterBufferParameters& GetParameters() const;
+
+    //! Store packet with given sample time of the first frame.
+    //! @p bytesCount should be a multiple of BytesPerFrame.
+    //! Frames that are already present, already read, or too far ahead are
+    //! skipped. Returns number of frames that were stored.
+    //! @note
+    //!  Should be called from a single worker thread. Never allocates or blocks.
+    UInt32 Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount);
+
+    //! Copy frames of given sample time window into @p bytes.
+    //! @p bytesCount should be a multiple of BytesPerFrame.
+    //! Missing frames are concealed. Returns number of frames that were
+    //! present in buffer.
+    //! @note
+    //!  Lock-free and realtime-safe.
+    UInt32 Read(UInt64 sampleTime, void* bytes, UInt32 bytesCount);
+
+    //! Get statistics.
+    //! Can be called from any thread.
+    JitterBufferStats GetStats() const;
+
+    //! Drop all frames and reset statistics.
+    //! Should not be called concurrently with Read() and Write().
+    void Reset();
+
+private:
+    // tag value for slot that doesn't hold a frame
+    static constexpr UInt64 EmptyTag = 0;
+
+    static UInt64 MakeTag(UInt64 sampleTime);
+
+    UInt32 ReadFrames(UInt64 sampleTime, UInt32 frameCount, UInt8* frames) const;
+    bool ReadFrame(UInt64 sampleTime, UInt8* frame) const;
+
+    const JitterBufferParameters params_;
+
+    std::vector<UInt8> frames_;
+    std::unique_ptr<std::atomic<UInt64>[]> tags_;
+
+    // end of the latest window passed to Read(), or zero if there were
+    // no reads yet
+    std::atomic<UInt64> readPos_ = 0;
+
+    // end of the latest frame passed to Write()
+    std::atomic<UInt64> writePos_ = 0;
+
+    std::atomic<UInt64> numPackets_ = 0;
+    std::atomic<UInt64> numDuplicatePackets_ = 0;
+    std::atomic<UInt64> numLatePackets_ = 0;
+    std::atomic<UInt64> numOverflowPackets_ = 0;
+    std::atomic<UInt64> numLostFrames_ = 0;
+};
+
+} // namespace aspl
@@ -0,0 +1,94 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/MemoryResource.hpp
+//! @brief Memory resource for internal containers.
+
+#pragma once
+
+// libc++ provides std::pmr only since macOS 14.
+#if defined(__APPLE__) && defined(__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__) \
+    && __ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__ < 140000
+#define ASPL_HAS_PMR 0
+#elif defined(__has_include)
+#if __has_include(<memory_resource>)
+#define ASPL_HAS_PMR 1
+#else
+#define ASPL_HAS_PMR 0
+#endif
+#else
+#define ASPL_HAS_PMR 0
+#endif
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if ASPL_HAS_PMR
+#include <memory_resource>
+#endif
+
+namespace aspl {
+
+#if ASPL_HAS_PMR
+
+//! Memory resource.
+//! Same as std::pmr::memory_resource.
+using MemoryResource = std::pmr::memory_resource;
+
+//! Allocator used by internal containers.
+//! Same as std::pmr::polymorphic_allocator.
+template <typename T>
+using Allocator = std::pmr::polymorphic_allocator<T>;
+
+#else
+
+//! Memory resource.
+//! Placeholder used when std::pmr is not available. In this case internal
+//! containers always use global heap.
+class MemoryResource
+{
+public:
+    virtual ~MemoryResource() = default;
+};
+
+//! Allocator used by internal containers.
+//! Same as std::allocator when std::pmr is not available.
+template <typename T>
+using Allocator = std::allocator<T>;
+
+#endif
+
+//! Vector using Allocator.
+template <typename T>
+using Vector = std::vector<T, Allocator<T>>;
+
+//! Map using Allocator.
+template <typename K, typename V>
+using Map = std::map<K, V, std::less<K>, Allocator<std::pair<const K, V>>>;
+
+//! Unordered map using Allocator.
+template <typename K, typename V>
+using UnorderedMap = std::unordered_map<K,
+    V,
+    std::hash<K>,
+    std::equal_to<K>,
+    Allocator<std::pair<const K, V>>>;
+
+//! Create allocator using given memory resource.
+//! If resource is null, global heap is used.
+template <typename T = std::byte>
+Allocator<T> MakeAllocator(MemoryResource* resource)
+{
+#if ASPL_HAS_PMR
+    return Allocator<T>(resource ? resource : std::pmr::new_delete_resource());
+#else
+    return Allocator<T>();
+#endif
+}
+
+} // namespace aspl
@@ -0,0 +1,171 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/NetworkSink.hpp
+//! @brief UDP output sink.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aspl {
+
+//! Network sink parameters.
+struct NetworkSinkParameters
+{
+    //! Destination IPv4 address.
+    std::string Address = "127.0.0.1";
+
+    //! Destination UDP port.
+    UInt16 Port = 4444;
+
+    //! Size of one frame in bytes, i.e. number of channels multiplied by
+    //! sample size. Packets always contain whole frames.
+    UInt32 BytesPerFrame = 8;
+
+    //! Maximum size of packet payload in bytes, excluding RTP header.
+    //! Rounded down to a multiple of BytesPerFrame.
+    UInt32 MaxPayloadSize = 512;
+
+    //! How many packets can be queued between realtime thread and sender thread.
+    //! If the queue is full, new packets are dropped.
+    UInt32 QueueSize = 512;
+
+    //! Maximum number of packets sent by one system call.
+    UInt32 BatchSize = 32;
+
+    //! How long sender thread sleeps when the queue is empty, in microseconds.
+    UInt32 PollInterval = 1000;
+
+    //! RTP payload type.
+    UInt8 PayloadType = 96;
+
+    //! RTP synchronization source identifier.
+    UInt32 SSRC = 0;
+
+    //! Use UDP generic segmentation offload, if supported by platform.
+    bool EnableGSO = true;
+};
+
+//! Network sink statistics.
+struct NetworkSinkStats
+{
+    //! Number of packets enqueued by Write().
+    UInt64 NumQueuedPackets = 0;
+
+    //! Number of packets dropped by Write() because queue was full
+    //! or sink was not started.
+    UInt64 NumDroppedPackets = 0;
+
+    //! Number of packets passed to socket.
+    UInt64 NumSentPackets = 0;
+
+    //! Number of packets that socket failed to send.
+    UInt64 NumFailedPackets = 0;
+
+    //! Number of send system calls.
+    UInt64 NumSendCalls = 0;
+};
+
+//! UDP output sink.
+//!
+//! Sends samples to network as RTP packets. Intended for devices that
+//! forward output from IORequestHandler::OnWriteMixedOutput() to network.
+//!
+//! Write() is invoked on realtime thread. It splits samples into packets,
+//! adds RTP headers with sequence numbers and sample time, and enqueues
+//! packets into a preallocated lock-free ring. It never blocks, allocates,
+//! or makes system calls.
+//!
+//! A separate sender thread fetches packets from the ring and sends them
+//! in batches. On Linux, batches are sent using sendmmsg() and, if enabled
+//! and supported, UDP generic segmentation offload. On other platforms,
+//! packets are sent one by one. Sender thread is never woken up by realtime
+//! thread; instead, it polls the ring when it's empty.
+class NetworkSink
+{
+public:
+    //! Size of RTP header in bytes.
+    static constexpr UInt32 HeaderSize = 12;
+
+    //! Allocate queue.
+    explicit NetworkSink(const NetworkSinkParameters& params = {});
+
+    //! Stop sender thread.
+    ~NetworkSink();
+
+    NetworkSink(const NetworkSink&) = delete;
+    NetworkSink& operator=(const NetworkSink&) = delete;
+
+    //! Get sink parameters.
+    const NetworkSinkParameters& GetParameters() const;
+
+    //! Open socket and start sender thread.
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStartIO().
+    OSStatus Start();
+
+    //! Send queued packets, stop sender thread, and close socket.
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStopIO().
+    void Stop();
+
+    //! Enqueue samples.
+    //! @p sampleTime is the sample time of the first frame; it is used as
+    //! RTP timestamp. @p bytesCount should be a multiple of BytesPerFrame.
+    //! @note
+    //!  Realtime-safe. Should be called from a single thread.
+    void Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount);
+
+    //! Get statistics.
+    //! Can be called from any thread.
+    NetworkSinkStats GetStats() const;
+
+private:
+    void SenderLoop();
+    UInt32 SendBatch(UInt64 firstPacket, UInt32 numPackets);
+
+    UInt8* GetSlot(UInt64 packet);
+
+    const NetworkSinkParameters params_;
+    const UInt32 payloadSize_;
+    const UInt32 slotSize_;
+
+    // packet ring, each slot holds header and payload
+    std::vector<UInt8> slots_;
+    std::vector<UInt32> slotSizes_;
+
+    // written by realtime thread, read by sender thread
+    alignas(64) std::atomic<UInt64> writeIndex_ = 0;
+
+    // written by sender thread, read by realtime thread
+    alignas(64) std::atomic<UInt64> readIndex_ = 0;
+
+    // accessed only by realtime thread
+    alignas(64) UInt16 sequence_ = 0;
+
+    std::atomic<bool> running_ = false;
+    std::atomic<bool> stopRequested_ = false;
+
+    std::thread thread_;
+    int socket_ = -1;
+    bool enableGSO_ = false;
+
+    // preallocated buffers for system calls, used by sender thread
+    struct Batch;
+    std::unique_ptr<Batch> batch_;
+
+    std::atomic<UInt64> numQueuedPackets_ = 0;
+    std::atomic<UInt64> numDroppedPackets_ = 0;
+    std::atomic<UInt64> numSentPackets_ = 0;
+    std::atomic<UInt64> numFailedPackets_ = 0;
+    std::atomic<UInt64> numSendCalls_ = 0;
+};
+
+} // namespace aspl
@@ -0,0 +1,193 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/NetworkSource.hpp
+//! @brief UDP input source.
+
+#pragma once
+
+#include <aspl/JitterBuffer.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aspl {
+
+//! Network source parameters.
+struct NetworkSourceParameters
+{
+    //! Local IPv4 address to bind to.
+    std::string Address = "127.0.0.1";
+
+    //! Local UDP port to bind to.
+    //! If zero, a free port is selected, see NetworkSource::GetPort().
+    UInt16 Port = 4444;
+
+    //! Maximum size of received packet in bytes, including RTP header.
+    //! Larger packets are truncated and dropped.
+    UInt32 MaxPacketSize = 1500;
+
+    //! Maximum number of packets received by one system call.
+    //! This many packets are preallocated in the packet pool.
+    UInt32 BatchSize = 32;
+
+    //! How long receiver thread waits for packets before checking if it
+    //! should exit, in microseconds.
+    UInt32 PollInterval = 10000;
+
+    //! Size of socket receive buffer in bytes.
+    //! If zero, system default is used.
+    UInt32 SocketBufferSize = 0;
+};
+
+//! Network source stream parameters.
+struct NetworkSourceStreamParameters
+{
+    //! Stream identifier.
+    //! Packets are routed to the stream with RTP SSRC equal to this value.
+    UInt32 StreamID = 0;
+
+    //! Target latency in frames.
+    //! On the first read, the stream is aligned so that reads are performed
+    //! this many frames behind the latest received frame.
+    UInt32 Latency = 2048;
+
+    //! Parameters of the stream's jitter buffer.
+    //! Capacity should be larger than Latency.
+    JitterBufferParameters Buffer;
+};
+
+//! Network source statistics.
+struct NetworkSourceStats
+{
+    //! Number of packets returned by socket.
+    UInt64 NumReceivedPackets = 0;
+
+    //! Number of packets routed to streams.
+    UInt64 NumRoutedPackets = 0;
+
+    //! Number of packets without a matching stream.
+    UInt64 NumUnknownPackets = 0;
+
+    //! Number of packets with invalid or truncated header.
+    UInt64 NumInvalidPackets = 0;
+
+    //! Number of receive system calls that returned packets.
+    UInt64 NumRecvCalls = 0;
+};
+
+//! UDP input source.
+//!
+//! Receives RTP packets, e.g. sent by NetworkSink, and provides samples
+//! to realtime thread by sample time. Intended for devices that serve
+//! IORequestHandler::OnReadClientInput() from network.
+//!
+//! A single socket can carry multiple streams. Packets are routed to
+//! streams by RTP SSRC, and every stream has its own JitterBuffer indexed
+//! by RTP timestamp.
+//!
+//! A separate receiver thread receives packets in batches into a
+//! preallocated packet pool, using recvmmsg() on Linux and recv() on other
+//! platforms, and writes their payload to jitter buffers. RTP header and
+//! payload are received into separate buffers, so that payload is always
+//! suitably aligned for samples.
+//!
+//! Read() is invoked on realtime thread. It copies samples from jitter
+//! buffer directly into the provided buffer, without intermediate copies,
+//! and never blocks, allocates, or makes system calls.
+class NetworkSource
+{
+public:
+    //! Size of RTP header in bytes, without CSRC list and extension.
+    static constexpr UInt32 HeaderSize = 12;
+
+    //! Allocate packet pool.
+    explicit NetworkSource(const NetworkSourceParameters& params = {});
+
+    //! Stop receiver thread.
+    ~NetworkSource();
+
+    NetworkSource(const NetworkSource&) = delete;
+    NetworkSource& operator=(const NetworkSource&) = delete;
+
+    //! Get source parameters.
+    const NetworkSourceParameters& GetParameters() const;
+
+    //! Add stream and allocate its jitter buffer.
+    //! Fails if the source is started or stream with such ID already exists.
+    OSStatus AddStream(const NetworkSourceStreamParameters& params);
+
+    //! Get number of streams.
+    UInt32 GetStreamCount() const;
+
+    //! Get stream jitter buffer statistics.
+    //! Returns zero statistics if there is no such stream.
+    //! Can be called from any thread.
+    JitterBufferStats GetStreamStats(UInt32 streamID) const;
+
+    //! Open socket and start receiver thread.
+    //! Drops samples buffered before previous Stop().
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStartIO().
+    OSStatus Start();
+
+    //! Stop receiver thread and close socket.
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStopIO().
+    void Stop();
+
+    //! Get local UDP port.
+    //! If port in parameters was zero, returns selected port after Start().
+    UInt16 GetPort() const;
+
+    //! Read samples of given stream.
+    //! @p sampleTime is the device sample time of the first frame. The first
+    //! read after Start() maps it to stream's RTP timestamp according to
+    //! stream latency; subsequent reads use the same mapping.
+    //! Missing frames are concealed. Returns number of frames that were
+    //! received.
+    //! @note
+    //!  Realtime-safe. Should be called from a single thread.
+    UInt32 Read(UInt32 streamID, UInt64 sampleTime, void* bytes, UInt32 bytesCount);
+
+    //! Get statistics.
+    //! Can be called from any thread.
+    NetworkSourceStats GetStats() const;
+
+private:
+    struct Stream;
+    struct Pool;
+
+    Stream* FindStream(UInt32 streamID) const;
+
+    void ReceiverLoop();
+    UInt32 ReceiveBatch();
+    void RoutePacket(const UInt8* header, const UInt8* payload, UInt32 packetSize);
+
+    const NetworkSourceParameters params_;
+    const UInt32 payloadSize_;
+
+    std::vector<std::unique_ptr<Stream>> streams_;
+
+    // preallocated packets and buffers for system calls, used by receiver thread
+    std::unique_ptr<Pool> pool_;
+
+    std::atomic<bool> stopRequested_ = false;
+
+    std::thread thread_;
+    int socket_ = -1;
+    std::atomic<UInt16> port_ = 0;
+
+    std::atomic<UInt64> numReceivedPackets_ = 0;
+    std::atomic<UInt64> numRoutedPackets_ = 0;
+    std::atomic<UInt64> numUnknownPackets_ = 0;
+    std::atomic<UInt64> numInvalidPackets_ = 0;
+    std::atomic<UInt64> numRecvCalls_ = 0;
+};
+
+} // namespace aspl
@@ -9,6 +9,7 @@
 #include <aspl/Compat.hpp>
 #include <aspl/Context.hpp>
 #include <aspl/DoubleBuffer.hpp>
+#include <aspl/MemoryResource.hpp>
 
 #include <CoreAudio/AudioServerPlugIn.h>
 
@@ -16,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -70,6 +72,19 @@ public:
     //! Get object context.
     std::shared_ptr<const Context> GetContext() const;
 
+    //! Get tracer from object context.
+    //! Unlike GetContext(), doesn't copy shared pointer to context.
+    const std::shared_ptr<Tracer>& GetTracer() const;
+
+    //! Get clock from object context.
+    //! Unlike GetContext(), doesn't copy shared pointer to context, so it's
+    //! cheap enough for realtime operations.
+    const Clock& GetClock() const;
+
+    //! Get profiler from object context, or null if profiling is disabled.
+    //! Unlike GetContext(), doesn't copy shared pointer to context.
+    Profiler* GetProfiler() const;
+
     //! @name Class and ID
     //! @{
 
@@ -136,6 +151,17 @@ public:
     //! Also invokes SetOwner() on the removed object.
     void RemoveOwnedObject(AudioObjectID objectID);
 
+    //! Begin batch of owned object changes.
+    //! Until the matching EndOwnedObjectsUpdate(), changes made by
+    //! AddOwnedObject() and RemoveOwnedObject() are accumulated and are
+    //! not yet returned by GetOwnedObjectIDs(). Batches may be nested.
+    void BeginOwnedObjectsUpdate();
+
+    //! End batch of owned object changes.
+    //! When the outermost batch ends, accumulated changes are published
+    //! at once, instead of copying the list on every change.
+    void EndOwnedObjectsUpdate();
+
     //! @}
 
     //! @name Notification
@@ -326,9 +352,15 @@ public:
 private:
     struct CustomProperty;
 
+    using OwnedObjectMap =
+        Map<AudioObjectPropertyScope, Map<AudioObjectID, std::shared_ptr<Object>>>;
+
     void AttachOwner(Object& owner);
     void DetachOwner();
 
+    OwnedObjectMap& GetPendingOwnedObjects();
+    void PublishOwnedObjects();
+
     Boolean HasPropertyFallback(AudioObjectID objectID,
         pid_t clientPID,
         const AudioObjectPropertyAddress* address) const;
@@ -373,11 +405,13 @@ private:
     Object* ownerObject_ = nullptr;
     std::atomic<AudioObjectID> ownerObjectID_ = kAudioObjectUnknown;
 
-    DoubleBuffer<std::map<AudioObjectPropertyScope,
-        std::map<AudioObjectID, std::shared_ptr<Object>>>>
-        ownedObjects_;
+    DoubleBuffer<OwnedObjectMap> ownedObjects_;
+
+    // not yet published changes, guarded by writeMutex_
+    std::optional<OwnedObjectMap> pendingOwnedObjects_;
+    UInt32 ownedObjectsUpdateDepth_ = 0;
 
-    DoubleBuffer<std::map<AudioObjectPropertySelector, std::shared_ptr<CustomProperty>>>
+    DoubleBuffer<Map<AudioObjectPropertySelector, std::shared_ptr<CustomProperty>>>
         customProps_;
 };
 
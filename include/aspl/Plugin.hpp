@@ -12,8 +12,10 @@
 
 #include <CoreAudio/AudioServerPlugIn.h>
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -30,6 +32,14 @@ struct PluginParameters
     //! Used by default implementation of Plugin::GetResourceBundlePath().
     //! Empty string means use plug-in bundle itself.
     std::string ResourceBundlePath = "";
+
+    //! Register custom property for controlling tracer filter at runtime.
+    //! Property value is a string like "objects=2,5 selectors=nsrt,lnam depth=3",
+    //! see Tracer::SetFilter(). Empty string removes filter.
+    bool EnableTraceFilterProperty = false;
+
+    //! Selector of trace filter custom property.
+    AudioObjectPropertySelector TraceFilterSelector = 'atrf';
 };
 
 //! Plugin object.
@@ -112,6 +122,29 @@ public:
     //! Removes device from the owned object list.
     void RemoveDevice(std::shared_ptr<Device> device);
 
+    //! Add multiple devices to the plugin.
+    //! Same as calling AddDevice() for every device within a single batch.
+    void AddDevices(const std::vector<std::shared_ptr<Device>>& devices);
+
+    //! Remove multiple devices from the plugin.
+    //! Same as calling RemoveDevice() for every device within a single batch.
+    void RemoveDevices(const std::vector<std::shared_ptr<Device>>& devices);
+
+    //! Begin batch of device changes.
+    //! Until the matching EndDeviceBatch(), devices added and removed via
+    //! AddDevice() and RemoveDevice() are not yet visible to getters, and
+    //! HAL is not notified about them. Batches may be nested.
+    //! @remarks
+    //!  Useful when a plugin adds or removes many devices at once. Every
+    //!  change updates device registry in-place, and the registry snapshot
+    //!  used by getters is published only once, at the end of the batch.
+    void BeginDeviceBatch();
+
+    //! End batch of device changes.
+    //! When the outermost batch ends, publishes all changes made during
+    //! the batch and sends a single device list change notification to HAL.
+    void EndDeviceBatch();
+
     //! @}
 
     //! @name Property dispatch
@@ -167,13 +200,39 @@ public:
     //! @}
 
 private:
+    // UID is captured when device is added. It's shared between registry
+    // and its snapshots, so that publishing a snapshot doesn't copy strings.
+    struct DeviceEntry
+    {
+        std::shared_ptr<Device> device;
+        std::shared_ptr<const std::string> uid;
+    };
+
+    struct DeviceRegistry
+    {
+        std::vector<DeviceEntry> devices;
+        std::unordered_map<AudioObjectID, std::shared_ptr<Device>> deviceByID;
+        // keys point to strings owned by entries
+        std::unordered_map<std::string_view, AudioObjectID> deviceIDByUID;
+    };
+
+    CFStringRef GetTraceFilterProperty() const;
+    void SetTraceFilterProperty(CFStringRef value);
+
+    void AddDeviceToRegistry(std::shared_ptr<Device> device);
+    void RemoveDeviceFromRegistry(std::shared_ptr<Device> device);
+
     mutable std::recursive_mutex writeMutex_;
 
     const PluginParameters params_;
 
-    DoubleBuffer<std::vector<std::shared_ptr<Device>>> devices_;
-    DoubleBuffer<std::unordered_map<AudioObjectID, std::shared_ptr<Device>>> deviceByID_;
-    DoubleBuffer<std::unordered_map<std::string, std::shared_ptr<Device>>> deviceByUID_;
+    // updated in-place by writers, guarded by writeMutex_
+    DeviceRegistry deviceRegistry_;
+    UInt32 deviceBatchDepth_ = 0;
+    bool deviceBatchChanged_ = false;
+
+    // immutable copy of registry used by getters, published once per batch
+    DoubleBuffer<std::shared_ptr<const DeviceRegistry>> deviceSnapshot_;
 };
 
 } // namespace aspl
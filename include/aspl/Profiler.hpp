@@ -0,0 +1,181 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/Profiler.hpp
+//! @brief I/O handler profiler hooks.
+
+#pragma once
+
+#include <aspl/Clock.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+namespace aspl {
+
+//! I/O handler callback.
+//! Identifies IORequestHandler method (or StaticDevice hook) being invoked.
+enum class ProfilerCallback : UInt32
+{
+    //! IORequestHandler::OnReadClientInput().
+    ReadClientInput,
+
+    //! IORequestHandler::OnProcessClientInput().
+    ProcessClientInput,
+
+    //! IORequestHandler::OnProcessClientOutput().
+    ProcessClientOutput,
+
+    //! IORequestHandler::OnWriteClientOutput().
+    WriteClientOutput,
+
+    //! IORequestHandler::OnProcessMixedOutput().
+    ProcessMixedOutput,
+
+    //! IORequestHandler::OnWriteMixedOutput().
+    WriteMixedOutput,
+};
+
+//! Profiler event.
+//! Describes invocation of I/O handler callback.
+struct ProfilerEvent
+{
+    //! Invoked callback.
+    ProfilerCallback Callback = ProfilerCallback::ReadClientInput;
+
+    //! Host time when callback was entered or exited.
+    //! Measured by Context::Clock, in host clock ticks.
+    UInt64 HostTime = 0;
+
+    //! I/O cycle counter, as reported by HAL.
+    UInt64 CycleCounter = 0;
+
+    //! Device ID.
+    AudioObjectID DeviceID = kAudioObjectUnknown;
+
+    //! Stream ID.
+    AudioObjectID StreamID = kAudioObjectUnknown;
+
+    //! Client ID.
+    //! Zero for callbacks not bound to a specific client.
+    UInt32 ClientID = 0;
+
+    //! I/O operation ID, e.g. kAudioServerPlugInIOOperationWriteMix.
+    UInt32 OperationID = 0;
+
+    //! Number of frames passed to callback.
+    UInt32 FrameCount = 0;
+};
+
+//! Profiler hooks.
+//!
+//! If Context::Profiler is set, Device invokes HandlerBegin() right before
+//! and HandlerEnd() right after every I/O handler callback, i.e. every place
+//! where control passes from the library into user code on realtime thread.
+//! If Context::Profiler is null (the default), hooks are skipped and no
+//! timestamps are taken.
+//!
+//! You can provide your own implementation by subclassing Profiler and
+//! passing it to Context. See also UsdtProfiler.
+//!
+//! @note
+//!  Profiler methods are called from realtime threads, serialized per device,
+//!  and should be realtime-safe.
+class Profiler
+{
+public:
+    Profiler() = default;
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    virtual ~Profiler() = default;
+
+    //! Called before invoking callback.
+    //! Default implementation does nothing.
+    virtual void HandlerBegin(const ProfilerEvent& event);
+
+    //! Called after callback returned.
+    //! @p event is the same as passed to HandlerBegin(), except HostTime.
+    //! Default implementation does nothing.
+    virtual void HandlerEnd(const ProfilerEvent& event);
+};
+
+//! Profiler exporting events via USDT probes.
+//!
+//! On Linux, if <sys/sdt.h> was available at build time, each hook fires
+//! a statically defined tracing probe in provider "aspl":
+//!
+//!  - @c handler_begin(callback, stream_id, client_id, operation_id,
+//!    frame_count, host_time)
+//!  - @c handler_end(callback, stream_id, client_id, operation_id,
+//!    frame_count, host_time)
+//!
+//! A disabled probe is a single nop instruction, so profiler can be left
+//! installed in production. Probes can be enabled with perf:
+//! @code
+//!   perf buildid-cache --add libaspl.so
+//!   perf probe sdt_aspl:handler_begin
+//!   perf record -e sdt_aspl:handler_begin -e sdt_aspl:handler_end -p <pid>
+//! @endcode
+//! or with bpftrace, e.g. @c usdt:/path/to/binary:aspl:handler_begin.
+//!
+//! On other platforms, hooks do nothing and IsSupported() returns false.
+class UsdtProfiler : public Profiler
+{
+public:
+    //! Check if probes are compiled in.
+    static bool IsSupported();
+
+    //! Fire @c handler_begin probe.
+    void HandlerBegin(const ProfilerEvent& event) override;
+
+    //! Fire @c handler_end probe.
+    void HandlerEnd(const ProfilerEvent& event) override;
+};
+
+//! Profiler scope.
+//!
+//! Invokes Profiler::HandlerBegin() in constructor and Profiler::HandlerEnd()
+//! in destructor, if profiler is non-null. Used by Device and StaticDevice
+//! around I/O handler callbacks. Never allocates and is realtime-safe.
+class ProfilerScope
+{
+public:
+    //! Enter scope.
+    //! Does nothing if @p profiler is null.
+    ProfilerScope(Profiler* profiler,
+        const Clock& clock,
+        const ProfilerEvent& event,
+        ProfilerCallback callback) noexcept
+        : profiler_(profiler)
+        , clock_(clock)
+    {
+        if (profiler_) {
+            event_ = event;
+            event_.Callback = callback;
+            event_.HostTime = clock_.GetHostTime();
+
+            profiler_->HandlerBegin(event_);
+        }
+    }
+
+    //! Leave scope.
+    ~ProfilerScope() noexcept
+    {
+        if (profiler_) {
+            event_.HostTime = clock_.GetHostTime();
+
+            profiler_->HandlerEnd(event_);
+        }
+    }
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+    Profiler* const profiler_;
+    const Clock& clock_;
+    ProfilerEvent event_;
+};
+
+} // namespace aspl
@@ -0,0 +1,49 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/RealtimeScope.hpp
+//! @brief Realtime thread marker.
+
+#pragma once
+
+namespace aspl {
+
+//! Realtime thread marker.
+//!
+//! Marks calling thread as realtime while the object is alive. Scopes can be
+//! nested; thread remains realtime until the outermost scope is destroyed.
+//!
+//! If DeviceParameters::EnableRealtimeChecks is set, Device creates realtime
+//! scope in every method that HAL invokes on realtime I/O thread, i.e.
+//! GetZeroTimeStamp(), WillDoIOOperation(), BeginIOOperation(), DoIOOperation(),
+//! and EndIOOperation().
+//!
+//! Debugging tools, like realtime-safety checkers, can then use IsRealtimeThread()
+//! to detect operations which are not allowed on realtime threads, for example
+//! memory allocations or mutex locks.
+//!
+//! @note
+//!  Marker state is stored in pthread thread-specific data instead of C++
+//!  thread_local, so IsRealtimeThread() never allocates and can be safely
+//!  called from inside malloc() hooks.
+class RealtimeScope
+{
+public:
+    //! Enter realtime scope.
+    //! If @p enable is false, the object does nothing.
+    explicit RealtimeScope(bool enable = true) noexcept;
+
+    //! Leave realtime scope.
+    ~RealtimeScope() noexcept;
+
+    RealtimeScope(const RealtimeScope&) = delete;
+    RealtimeScope& operator=(const RealtimeScope&) = delete;
+
+    //! Check if calling thread is inside realtime scope.
+    static bool IsRealtimeThread() noexcept;
+
+private:
+    const bool enabled_;
+};
+
+} // namespace aspl
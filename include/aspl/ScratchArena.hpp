@@ -0,0 +1,135 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/ScratchArena.hpp
+//! @brief Preallocated scratch buffers.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace aspl {
+
+class ScratchArena;
+
+//! Scratch buffer borrowed from ScratchArena.
+//!
+//! Movable handle which returns buffer to the arena when destroyed.
+//! Handle may be empty if the arena has no free buffers.
+//!
+//! Buffer holds GetFrameCount() * GetChannelCount() samples in canonical
+//! format, i.e. native endian 32-bit interleaved floats. Buffer contents
+//! is not initialized and is not preserved between borrows.
+class ScratchBuffer
+{
+public:
+    //! Construct empty handle.
+    ScratchBuffer() noexcept = default;
+
+    //! Return buffer to the arena.
+    ~ScratchBuffer() noexcept;
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    //! Move buffer ownership from other handle.
+    ScratchBuffer(ScratchBuffer&& other) noexcept;
+
+    //! Return current buffer and move buffer ownership from other handle.
+    ScratchBuffer& operator=(ScratchBuffer&& other) noexcept;
+
+    //! Check if handle is non-empty.
+    explicit operator bool() const noexcept;
+
+    //! Get pointer to samples.
+    //! Returns null if handle is empty.
+    //! Pointer is aligned to ScratchArena::Alignment.
+    Float32* GetData() const noexcept;
+
+    //! Get number of frames that fit into buffer.
+    UInt32 GetFrameCount() const noexcept;
+
+    //! Get number of channels per frame.
+    UInt32 GetChannelCount() const noexcept;
+
+    //! Get buffer size in bytes.
+    UInt32 GetByteCount() const noexcept;
+
+    //! Return buffer to the arena before handle is destroyed.
+    void Reset() noexcept;
+
+private:
+    friend class ScratchArena;
+
+    ScratchBuffer(ScratchArena* arena, Float32* data) noexcept;
+
+    ScratchArena* arena_ = nullptr;
+    Float32* data_ = nullptr;
+};
+
+//! Pool of preallocated aligned scratch buffers.
+//!
+//! Holds a fixed number of equally sized buffers, allocated once in constructor.
+//! Borrowing and returning a buffer is O(1), never allocates or locks, and is
+//! realtime-safe.
+//!
+//! Arena is not thread-safe. Device owns an arena and uses it only from I/O
+//! operations, which are serialized; see Device::BorrowScratchBuffer().
+//!
+//! All borrowed buffers should be returned before the arena is destroyed.
+class ScratchArena
+{
+public:
+    //! Alignment of every buffer, in bytes.
+    static constexpr size_t Alignment = 64;
+
+    //! Allocate @p bufferCount buffers, each holding @p frameCount frames
+    //! of @p channelCount channels.
+    //! If any of the arguments is zero, or allocation fails, arena is empty.
+    ScratchArena(UInt32 bufferCount, UInt32 frameCount, UInt32 channelCount);
+
+    //! Free buffers.
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    //! Get total number of buffers.
+    UInt32 GetBufferCount() const noexcept;
+
+    //! Get number of buffers that are not borrowed.
+    UInt32 GetAvailableCount() const noexcept;
+
+    //! Get number of frames per buffer.
+    UInt32 GetFrameCount() const noexcept;
+
+    //! Get number of channels per frame.
+    UInt32 GetChannelCount() const noexcept;
+
+    //! Borrow a buffer.
+    //! Returns empty handle if all buffers are borrowed.
+    ScratchBuffer Borrow() noexcept;
+
+private:
+    friend class ScratchBuffer;
+
+    void Return(Float32* data) noexcept;
+
+    UInt32 bufferCount_ = 0;
+    UInt32 frameCount_ = 0;
+    UInt32 channelCount_ = 0;
+
+    // distance between buffers, number of samples
+    size_t stride_ = 0;
+
+    Float32* memory_ = nullptr;
+
+    // stack of indices of free buffers
+    std::vector<UInt32> freeList_;
+    UInt32 freeCount_ = 0;
+};
+
+} // namespace aspl
@@ -0,0 +1,116 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/SharedRingReader.hpp
+//! @brief Shared memory ring reader.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <string>
+
+#include <semaphore.h>
+
+namespace aspl {
+
+struct SharedRingLayout;
+
+//! Shared memory ring reader statistics.
+struct SharedRingReaderStats
+{
+    //! Number of frames returned by Read().
+    UInt64 NumReadFrames = 0;
+
+    //! Number of frames that were overwritten by writer before reader
+    //! could read them.
+    UInt64 NumLostFrames = 0;
+};
+
+//! Shared memory ring reader.
+//!
+//! Reads frames written by SharedRingWriter in another process, e.g.
+//! in a companion application of the driver. Doesn't depend on other
+//! parts of the library besides the ring layout.
+//!
+//! Reader maps shared memory read-only and never affects writer.
+//! It starts from the oldest frame still present in the ring, and then
+//! reads frames in order of their sample time. If it falls behind by more
+//! than ring capacity, it skips lost frames.
+//!
+//! There should be only one reader per ring, because wakeups are delivered
+//! via a single semaphore.
+//!
+//! Typical usage is a loop that calls Wait() and then Read() until it
+//! returns zero. When IsWriterActive() becomes false, reader should be
+//! closed and opened again to attach to the next writer.
+class SharedRingReader
+{
+public:
+    //! Initialize reader.
+    //! @p name should be the same as SharedRingParameters::Name of writer.
+    explicit SharedRingReader(const std::string& name = "/aspl-ring");
+
+    //! Close reader.
+    ~SharedRingReader();
+
+    SharedRingReader(const SharedRingReader&) = delete;
+    SharedRingReader& operator=(const SharedRingReader&) = delete;
+
+    //! Open and map shared memory object and open semaphore.
+    //! Fails if writer didn't create them or ring header is invalid.
+    OSStatus Open();
+
+    //! Unmap shared memory and close semaphore.
+    void Close();
+
+    //! Check if reader is opened.
+    bool IsOpen() const;
+
+    //! Check if writer of the opened ring is still open.
+    bool IsWriterActive() const;
+
+    //! Get format of frames, as specified by writer.
+    const AudioStreamBasicDescription& GetFormat() const;
+
+    //! Get ring size in frames.
+    UInt32 GetCapacity() const;
+
+    //! Get number of frames that can be read now.
+    UInt64 GetAvailableFrames() const;
+
+    //! Wait until there are frames to read, or until writer is closed,
+    //! or until timeout expires. Timeout is in microseconds.
+    //! Returns true if there are frames to read.
+    bool Wait(UInt32 timeout);
+
+    //! Read frames.
+    //! @p bytesCount should be a multiple of format's mBytesPerFrame.
+    //! Sets @p sampleTime to the sample time of the first returned frame.
+    //! Returns number of frames, which may be zero if there is nothing
+    //! to read. Never blocks.
+    UInt32 Read(void* bytes, UInt32 bytesCount, UInt64& sampleTime);
+
+    //! Get statistics.
+    SharedRingReaderStats GetStats() const;
+
+private:
+    bool GetReadRange(UInt64& readBegin, UInt64& readEnd) const;
+
+    const std::string name_;
+
+    const SharedRingLayout* layout_ = nullptr;
+    size_t layoutSize_ = 0;
+
+    sem_t* semaphore_ = SEM_FAILED;
+
+    AudioStreamBasicDescription format_ = {};
+
+    // set on the first read
+    bool started_ = false;
+    UInt64 readPos_ = 0;
+
+    SharedRingReaderStats stats_;
+};
+
+} // namespace aspl
@@ -0,0 +1,161 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/SharedRingWriter.hpp
+//! @brief Shared memory ring writer.
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <semaphore.h>
+
+namespace aspl {
+
+struct SharedRingLayout;
+
+//! Shared memory ring parameters.
+struct SharedRingParameters
+{
+    //! Name of POSIX shared memory object.
+    //! Should start with a slash. Name of the semaphore used for wakeups is
+    //! derived from it by adding ".sem" suffix. Keep it short, macOS limits
+    //! names to 31 characters.
+    std::string Name = "/aspl-ring";
+
+    //! Ring size in frames.
+    //! If reader is behind writer by more frames, it loses frames.
+    UInt32 Capacity = 16384;
+
+    //! Format of frames.
+    //! Stored in the ring header for reader. Default is the same as default
+    //! stream format.
+    AudioStreamBasicDescription Format = {
+        .mSampleRate = 44100,
+        .mFormatID = kAudioFormatLinearPCM,
+        .mFormatFlags = kAudioFormatFlagIsSignedInteger | kAudioFormatFlagsNativeEndian |
+                        kAudioFormatFlagIsPacked,
+        .mBitsPerChannel = 16,
+        .mChannelsPerFrame = 2,
+        .mBytesPerFrame = 4,
+        .mFramesPerPacket = 1,
+        .mBytesPerPacket = 4,
+    };
+
+    //! How often notifier thread checks for new frames and wakes up reader,
+    //! in microseconds. If zero, notifier thread is not started, and reader
+    //! should poll.
+    UInt32 NotifyInterval = 1000;
+};
+
+//! Shared memory ring writer statistics.
+struct SharedRingWriterStats
+{
+    //! Number of frames written to ring.
+    UInt64 NumWrittenFrames = 0;
+
+    //! Number of zero frames inserted because of gaps in sample time.
+    UInt64 NumGapFrames = 0;
+
+    //! Number of frames dropped because their sample time was already written.
+    UInt64 NumLateFrames = 0;
+
+    //! Number of reader wakeups.
+    UInt64 NumNotifications = 0;
+};
+
+//! Shared memory ring writer.
+//!
+//! Transfers samples from driver to another process without sockets and
+//! extra copies. Intended for devices that forward output from
+//! IORequestHandler::OnWriteMixedOutput() to a companion application,
+//! which uses SharedRingReader.
+//!
+//! The ring is a POSIX shared memory object. It starts with a header with
+//! stream format and write position, followed by frames indexed by sample
+//! time. Gaps in sample time are filled with silence.
+//!
+//! Write() is invoked on realtime thread. It copies frames into shared memory
+//! and publishes them using atomics; it never blocks, allocates, makes system
+//! calls, or waits for reader. If reader is too slow, old frames are
+//! overwritten, and reader detects it.
+//!
+//! Reader is woken up by a separate notifier thread, which periodically
+//! checks write position and posts a named POSIX semaphore. Realtime thread
+//! never touches the semaphore.
+class SharedRingWriter
+{
+public:
+    //! Initialize writer.
+    explicit SharedRingWriter(const SharedRingParameters& params = {});
+
+    //! Close writer.
+    ~SharedRingWriter();
+
+    SharedRingWriter(const SharedRingWriter&) = delete;
+    SharedRingWriter& operator=(const SharedRingWriter&) = delete;
+
+    //! Get ring parameters.
+    const SharedRingParameters& GetParameters() const;
+
+    //! Create shared memory object and semaphore, and start notifier thread.
+    //! Existing objects with the same name are replaced.
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStartIO().
+    OSStatus Open();
+
+    //! Stop notifier thread, mark ring as inactive, and remove shared memory
+    //! object and semaphore names. Readers that already opened them can
+    //! still read remaining frames.
+    //! Should be called from non-realtime thread, e.g. from
+    //! ControlRequestHandler::OnStopIO().
+    void Close();
+
+    //! Check if writer is opened.
+    bool IsOpen() const;
+
+    //! Write frames.
+    //! @p sampleTime is the sample time of the first frame.
+    //! @p bytesCount should be a multiple of format's mBytesPerFrame.
+    //! Does nothing if writer is not opened.
+    //! @note
+    //!  Realtime-safe. Should be called from a single thread, and not
+    //!  concurrently with Open() and Close().
+    void Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount);
+
+    //! Get statistics.
+    //! Can be called from any thread.
+    SharedRingWriterStats GetStats() const;
+
+private:
+    void NotifierLoop();
+
+    void CopyFrames(UInt64 sampleTime, const UInt8* frames, UInt32 frameCount);
+    void ZeroFrames(UInt64 sampleTime, UInt32 frameCount);
+
+    const SharedRingParameters params_;
+    const UInt32 bytesPerFrame_;
+
+    SharedRingLayout* layout_ = nullptr;
+    size_t layoutSize_ = 0;
+
+    sem_t* semaphore_ = SEM_FAILED;
+
+    std::atomic<bool> open_ = false;
+    std::atomic<bool> stopRequested_ = false;
+    std::thread thread_;
+
+    // accessed only by realtime thread
+    UInt64 writeEnd_ = 0;
+
+    std::atomic<UInt64> numWrittenFrames_ = 0;
+    std::atomic<UInt64> numGapFrames_ = 0;
+    std::atomic<UInt64> numLateFrames_ = 0;
+    std::atomic<UInt64> numNotifications_ = 0;
+};
+
+} // namespace aspl
@@ -0,0 +1,381 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/StaticDevice.hpp
+//! @brief Audio device with compile-time format and statically dispatched I/O.
+
+#pragma once
+
+#include <aspl/Device.hpp>
+#include <aspl/Profiler.hpp>
+#include <aspl/StaticStream.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace aspl {
+
+//! Audio device with compile-time format and statically dispatched I/O.
+//!
+//! Intended for devices that have a single fixed format which never changes.
+//! Sample type, number of channels, and sample rate are template parameters,
+//! and all streams of the device are StaticStream instances with that format.
+//! Device still answers the same HAL properties as Device, but nominal
+//! sample rate and stream formats can't be changed to other values.
+//!
+//! Instead of IORequestHandler, the device uses CRTP: @p Derived class
+//! inherits StaticDevice and defines (hides) any of the I/O hooks listed
+//! below. DoIOOperationImpl() calls them via static_cast to @p Derived,
+//! without virtual calls, and passes frames as typed pointers, while number
+//! of channels and frame size are constexpr. This allows the compiler to
+//! inline hooks into the I/O path and unroll or vectorize loops over samples.
+//!
+//! Example:
+//! @code
+//!   class MyDevice : public aspl::StaticDevice<MyDevice, Float32, 2, 48000>
+//!   {
+//!   public:
+//!       using StaticDevice::StaticDevice;
+//!
+//!       void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+//!           Float64 zeroTimestamp,
+//!           Float64 timestamp,
+//!           const Float32* frames,
+//!           UInt32 frameCount)
+//!       {
+//!           // frames contains frameCount * ChannelCount samples
+//!       }
+//!   };
+//!
+//!   auto device = std::make_shared<MyDevice>(context);
+//!   device->AddStaticStreamWithControlsAsync(aspl::Direction::Output);
+//! @endcode
+//!
+//! Hooks should be public, or Derived should befriend StaticDevice.
+//! Same as IORequestHandler methods, hooks are invoked on realtime thread.
+//!
+//! IORequestHandler set via SetIOHandler() is not used by this device.
+//! Streams should be added only via AddStaticStreamAsync() or
+//! AddStaticStreamWithControlsAsync(), or otherwise have the same format.
+template <class Derived, typename SampleType, UInt32 Channels, UInt32 Rate>
+class StaticDevice : public Device
+{
+public:
+    //! Device format.
+    using Format = StaticFormat<SampleType, Channels, Rate>;
+
+    //! Stream type.
+    using StreamType = StaticStream<SampleType, Channels, Rate>;
+
+    //! Construct device.
+    //! SampleRate and ChannelCount fields of @p params are ignored and replaced
+    //! with Format::SampleRate and Format::ChannelCount.
+    explicit StaticDevice(std::shared_ptr<const Context> context,
+        const DeviceParameters& params = {})
+        : Device(std::move(context), MakeParameters(params))
+    {
+    }
+
+    //! @name Getters and setters
+    //! @{
+
+    //! Get nominal sample rate.
+    //! Always returns Format::SampleRate.
+    Float64 GetNominalSampleRate() const override
+    {
+        return Format::SampleRate;
+    }
+
+    //! Get list of supported sample rates.
+    //! Always returns single rate, Format::SampleRate.
+    std::vector<AudioValueRange> GetAvailableSampleRates() const override
+    {
+        AudioValueRange range;
+        range.mMinimum = Format::SampleRate;
+        range.mMaximum = Format::SampleRate;
+
+        return {range};
+    }
+
+    //! @}
+
+    //! @name Streams
+    //! @{
+
+    //! Add stream + volume control + mute control.
+    //! Same as Device::AddStreamWithControlsAsync(), but constructs StreamType.
+    std::shared_ptr<StreamType> AddStaticStreamWithControlsAsync(Direction dir)
+    {
+        const auto scope = dir == Direction::Output ? kAudioObjectPropertyScopeOutput
+                                                    : kAudioObjectPropertyScopeInput;
+
+        auto stream = AddStaticStreamAsync(dir);
+
+        auto volumeControl = AddVolumeControlAsync(scope);
+        auto muteControl = AddMuteControlAsync(scope);
+
+        stream->AttachVolumeControl(volumeControl);
+        stream->AttachMuteControl(muteControl);
+
+        return stream;
+    }
+
+    //! Add stream to device.
+    //! Same as Device::AddStreamAsync(), but constructs StreamType.
+    std::shared_ptr<StreamType> AddStaticStreamAsync(Direction dir)
+    {
+        StreamParameters params;
+
+        params.Direction = dir;
+        params.StartingChannel = 1;
+
+        for (UInt32 idx = 0; idx < GetStreamCount(dir); idx++) {
+            if (auto stream = GetStreamByIndex(dir, idx)) {
+                params.StartingChannel = std::max(params.StartingChannel,
+                    stream->GetStartingChannel() + stream->GetChannelCount());
+            }
+        }
+
+        auto stream = std::make_shared<StreamType>(
+            GetContext(), std::static_pointer_cast<Device>(shared_from_this()), params);
+
+        AddStreamAsync(stream);
+
+        return stream;
+    }
+
+    //! @}
+
+    //! @name I/O hooks
+    //! Default implementations, hidden by same-named methods of @p Derived.
+    //! Same as corresponding IORequestHandler methods, but get typed frames
+    //! instead of bytes, and no channel count, which is Format::ChannelCount.
+    //! @{
+
+    //! Read data from device to client.
+    //! Default implementation fills frames with zeros.
+    void OnReadClientInput(const std::shared_ptr<Client>& client,
+        const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        SampleType* frames,
+        UInt32 frameCount)
+    {
+        memset(frames, 0, Format::FramesToBytes(frameCount));
+    }
+
+    //! Process data returned by OnReadClientInput() before passing it to client.
+    //! Default implementation invokes Stream::ApplyProcessing().
+    void OnProcessClientInput(const std::shared_ptr<Client>& client,
+        const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount)
+    {
+        stream->ApplyProcessing(frames, frameCount, Format::ChannelCount);
+    }
+
+    //! Process data from client before passing it to OnWriteClientOutput().
+    //! Default implementation invokes Stream::ApplyProcessing().
+    void OnProcessClientOutput(const std::shared_ptr<Client>& client,
+        const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount)
+    {
+        stream->ApplyProcessing(frames, frameCount, Format::ChannelCount);
+    }
+
+    //! Write data from client to device.
+    //! Used only if DeviceParameters::EnableMixing is false.
+    //! Default implementation does nothing.
+    void OnWriteClientOutput(const std::shared_ptr<Client>& client,
+        const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const Float32* frames,
+        UInt32 frameCount)
+    {
+    }
+
+    //! Process mixed data before passing it to OnWriteMixedOutput().
+    //! Default implementation invokes Stream::ApplyProcessing().
+    void OnProcessMixedOutput(const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount)
+    {
+        stream->ApplyProcessing(frames, frameCount, Format::ChannelCount);
+    }
+
+    //! Write mixed data to device.
+    //! Used only if DeviceParameters::EnableMixing is true.
+    //! Default implementation does nothing.
+    void OnWriteMixedOutput(const std::shared_ptr<Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const SampleType* frames,
+        UInt32 frameCount)
+    {
+    }
+
+    //! @}
+
+protected:
+    //! Does nothing, because sample rate is fixed.
+    //! Invoked only if @p rate equals to Format::SampleRate.
+    OSStatus SetNominalSampleRateImpl(Float64 rate) override
+    {
+        return kAudioHardwareNoError;
+    }
+
+    //! Rejects any changes, because sample rate is fixed.
+    OSStatus SetAvailableSampleRatesImpl(std::vector<AudioValueRange> rates) override
+    {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    //! Perform an IO operation for a particular stream.
+    //! Invokes corresponding hook of @p Derived, based on operation type.
+    OSStatus DoIOOperationImpl(AudioObjectID streamID,
+        UInt32 clientID,
+        UInt32 operationID,
+        UInt32 ioFrameCount,
+        const AudioServerPlugInIOCycleInfo* ioCycleInfo,
+        void* ioMainBuffer,
+        void* ioSecondaryBuffer) final
+    {
+        auto stream = GetStreamByID(streamID);
+
+        if (!stream) {
+            return kAudioHardwareIllegalOperationError;
+        }
+
+        auto& derived = static_cast<Derived&>(*this);
+
+        const Float64 zeroTimestamp = GetCurrentZeroTimestamp();
+
+        const auto profiler = GetProfiler();
+        const auto& clock = GetClock();
+
+        ProfilerEvent event;
+
+        if (profiler) {
+            event.CycleCounter = ioCycleInfo->mIOCycleCounter;
+            event.DeviceID = GetID();
+            event.StreamID = streamID;
+            event.ClientID = clientID;
+            event.OperationID = operationID;
+            event.FrameCount = ioFrameCount;
+        }
+
+        switch (operationID) {
+        case kAudioServerPlugInIOOperationReadInput:
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::ReadClientInput);
+
+            derived.OnReadClientInput(GetClientByID(clientID),
+                stream,
+                zeroTimestamp,
+                ioCycleInfo->mInputTime.mSampleTime,
+                static_cast<SampleType*>(ioMainBuffer),
+                ioFrameCount);
+            break;
+        }
+
+        case kAudioServerPlugInIOOperationProcessInput:
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::ProcessClientInput);
+
+            derived.OnProcessClientInput(GetClientByID(clientID),
+                stream,
+                zeroTimestamp,
+                ioCycleInfo->mInputTime.mSampleTime,
+                static_cast<Float32*>(ioMainBuffer),
+                ioFrameCount);
+            break;
+        }
+
+        case kAudioServerPlugInIOOperationMixOutput:
+        {
+            const auto client = GetClientByID(clientID);
+
+            {
+                ProfilerScope profilerScope(
+                    profiler, clock, event, ProfilerCallback::ProcessClientOutput);
+
+                derived.OnProcessClientOutput(client,
+                    stream,
+                    zeroTimestamp,
+                    ioCycleInfo->mOutputTime.mSampleTime,
+                    static_cast<Float32*>(ioMainBuffer),
+                    ioFrameCount);
+            }
+
+            {
+                ProfilerScope profilerScope(
+                    profiler, clock, event, ProfilerCallback::WriteClientOutput);
+
+                derived.OnWriteClientOutput(client,
+                    stream,
+                    zeroTimestamp,
+                    ioCycleInfo->mOutputTime.mSampleTime,
+                    static_cast<const Float32*>(ioMainBuffer),
+                    ioFrameCount);
+            }
+            break;
+        }
+
+        case kAudioServerPlugInIOOperationProcessMix:
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::ProcessMixedOutput);
+
+            derived.OnProcessMixedOutput(stream,
+                zeroTimestamp,
+                ioCycleInfo->mOutputTime.mSampleTime,
+                static_cast<Float32*>(ioMainBuffer),
+                ioFrameCount);
+            break;
+        }
+
+        case kAudioServerPlugInIOOperationWriteMix:
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::WriteMixedOutput);
+
+            derived.OnWriteMixedOutput(stream,
+                zeroTimestamp,
+                ioCycleInfo->mOutputTime.mSampleTime,
+                static_cast<const SampleType*>(ioMainBuffer),
+                ioFrameCount);
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        return kAudioHardwareNoError;
+    }
+
+private:
+    static DeviceParameters MakeParameters(DeviceParameters params)
+    {
+        params.SampleRate = Format::SampleRate;
+        params.ChannelCount = Format::ChannelCount;
+
+        return params;
+    }
+};
+
+} // namespace aspl
@@ -0,0 +1,201 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+//! @file aspl/StaticStream.hpp
+//! @brief Audio stream with compile-time format.
+
+#pragma once
+
+#include <aspl/Stream.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace aspl {
+
+//! Compile-time stream format.
+//!
+//! Describes interleaved native-endian linear PCM format with given sample
+//! type, number of channels, and sample rate. Supported sample types are
+//! Float32, SInt16, and SInt32.
+//!
+//! All members are constexpr, so that code using them, e.g. conversions
+//! between frames and bytes or loops over channels, can be computed or
+//! unrolled by the compiler.
+template <typename SampleType, UInt32 Channels, UInt32 Rate>
+struct StaticFormat
+{
+    static_assert(std::is_same_v<SampleType, Float32> ||
+                      std::is_same_v<SampleType, SInt16> ||
+                      std::is_same_v<SampleType, SInt32>,
+        "StaticFormat supports only Float32, SInt16, and SInt32 samples");
+
+    static_assert(Channels > 0, "StaticFormat should have at least one channel");
+    static_assert(Rate > 0, "StaticFormat should have non-zero sample rate");
+
+    //! Sample type.
+    using Sample = SampleType;
+
+    //! Number of channels.
+    static constexpr UInt32 ChannelCount = Channels;
+
+    //! Sample rate.
+    static constexpr UInt32 SampleRate = Rate;
+
+    //! Number of bytes per frame.
+    static constexpr UInt32 BytesPerFrame = UInt32(sizeof(SampleType)) * Channels;
+
+    //! Format description, as reported to HAL.
+    static constexpr AudioStreamBasicDescription Description = [] {
+        AudioStreamBasicDescription desc = {};
+
+        desc.mSampleRate = Rate;
+        desc.mFormatID = kAudioFormatLinearPCM;
+        desc.mFormatFlags = (std::is_floating_point_v<SampleType>
+                                    ? kAudioFormatFlagIsFloat
+                                    : kAudioFormatFlagIsSignedInteger) |
+                            kAudioFormatFlagsNativeEndian | kAudioFormatFlagIsPacked;
+        desc.mBitsPerChannel = UInt32(sizeof(SampleType)) * 8;
+        desc.mChannelsPerFrame = Channels;
+        desc.mBytesPerFrame = BytesPerFrame;
+        desc.mFramesPerPacket = 1;
+        desc.mBytesPerPacket = BytesPerFrame;
+
+        return desc;
+    }();
+
+    //! Convert number of frames to number of bytes.
+    static constexpr UInt32 FramesToBytes(UInt32 numFrames)
+    {
+        return numFrames * BytesPerFrame;
+    }
+
+    //! Convert number of bytes to number of frames.
+    static constexpr UInt32 BytesToFrames(UInt32 numBytes)
+    {
+        return numBytes / BytesPerFrame;
+    }
+};
+
+//! Audio stream with compile-time format.
+//!
+//! Unlike Stream, physical and virtual formats of this stream are fixed
+//! and are defined by template parameters. Getters return constexpr
+//! StaticFormat::Description instead of reading double buffers, and
+//! frame/byte conversions are computed from constexpr frame size.
+//!
+//! Stream still answers the same HAL properties. Setting physical or
+//! virtual format succeeds only if the new format equals the fixed one.
+//!
+//! Typically used together with StaticDevice, which creates such streams
+//! via StaticDevice::AddStaticStreamAsync().
+template <typename SampleType, UInt32 Channels, UInt32 Rate>
+class StaticStream : public Stream
+{
+public:
+    //! Stream format.
+    using Format = StaticFormat<SampleType, Channels, Rate>;
+
+    //! Construct stream.
+    //! Format field of @p params is ignored and replaced with Format::Description.
+    StaticStream(std::shared_ptr<const Context> context,
+        std::shared_ptr<Device> device,
+        const StreamParameters& params = {})
+        : Stream(std::move(context), std::move(device), MakeParameters(params))
+    {
+    }
+
+    //! Get the current physical format of the stream.
+    //! Always returns Format::Description.
+    AudioStreamBasicDescription GetPhysicalFormat() const override
+    {
+        return Format::Description;
+    }
+
+    //! Get list of supported physical formats.
+    //! Always returns single format, Format::Description.
+    std::vector<AudioStreamRangedDescription> GetAvailablePhysicalFormats()
+        const override
+    {
+        return {MakeRangedDescription()};
+    }
+
+    //! Get the current virtual format of the stream.
+    //! Always returns Format::Description.
+    AudioStreamBasicDescription GetVirtualFormat() const override
+    {
+        return Format::Description;
+    }
+
+    //! Get list of supported virtual formats.
+    //! Always returns single format, Format::Description.
+    std::vector<AudioStreamRangedDescription> GetAvailableVirtualFormats() const override
+    {
+        return {MakeRangedDescription()};
+    }
+
+    //! Convert number of frame to the number of bytes.
+    UInt32 ConvertFramesToBytes(UInt32 numFrames) const override
+    {
+        return Format::FramesToBytes(numFrames);
+    }
+
+    //! Convert number of bytes to the number of frames.
+    UInt32 ConvertBytesToFrames(UInt32 numBytes) const override
+    {
+        return Format::BytesToFrames(numBytes);
+    }
+
+protected:
+    //! Does nothing, because format is fixed.
+    //! Invoked only if @p format equals to Format::Description.
+    OSStatus SetPhysicalFormatImpl(const AudioStreamBasicDescription& format) override
+    {
+        return kAudioHardwareNoError;
+    }
+
+    //! Does nothing, because format is fixed.
+    //! Invoked only if @p format equals to Format::Description.
+    OSStatus SetVirtualFormatImpl(const AudioStreamBasicDescription& format) override
+    {
+        return kAudioHardwareNoError;
+    }
+
+    //! Rejects any changes, because format is fixed.
+    OSStatus SetAvailablePhysicalFormatsImpl(
+        std::vector<AudioStreamRangedDescription> formats) override
+    {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    //! Rejects any changes, because format is fixed.
+    OSStatus SetAvailableVirtualFormatsImpl(
+        std::vector<AudioStreamRangedDescription> formats) override
+    {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+private:
+    static StreamParameters MakeParameters(StreamParameters params)
+    {
+        params.Format = Format::Description;
+
+        return params;
+    }
+
+    static AudioStreamRangedDescription MakeRangedDescription()
+    {
+        AudioStreamRangedDescription format = {};
+
+        format.mFormat = Format::Description;
+        format.mSampleRateRange.mMinimum = Format::SampleRate;
+        format.mSampleRateRange.mMaximum = Format::SampleRate;
+
+        return format;
+    }
+};
+
+} // namespace aspl
@@ -15,6 +15,7 @@
 #include <CoreAudio/AudioServerPlugIn.h>
 
 #include <atomic>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -143,7 +144,9 @@ public:
 
     //! Asynchronously set stream presentation latency,
     //! Requests HAL to asynchronously invoke SetLatencyImpl().
-    OSStatus SetLatencyAsync(UInt32 latency);
+    //! If @p completion is non-null, it receives the result of the change.
+    OSStatus SetLatencyAsync(UInt32 latency,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get the current physical format of the stream.
     //! Physical format defines the underlying format supported natively by hardware.
@@ -155,13 +158,15 @@ public:
 
     //! Set current format of the stream.
     //! Requests HAL to asynchronously invoke SetPhysicalFormatImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     //! Fails if format is not present in GetAvailablePhysicalFormats(), which by
     //! default returns only one format, provided during initialization.
     //! If you want to make your stream supporting multiple formats, you typically
     //! need to override both of these methods.
     //! @note
     //!  Backs @c kAudioStreamPropertyPhysicalFormat property.
-    OSStatus SetPhysicalFormatAsync(AudioStreamBasicDescription format);
+    OSStatus SetPhysicalFormatAsync(AudioStreamBasicDescription format,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get list of supported physical formats.
     //! Empty list means that any format is allowed.
@@ -175,8 +180,10 @@ public:
     //! Asynchronously set list of supported physical formats.
     //! See comments for GetAvailablePhysicalFormats().
     //! Requests HAL to asynchronously invoke SetAvailablePhysicalFormatsImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     OSStatus SetAvailablePhysicalFormatsAsync(
-        std::vector<AudioStreamRangedDescription> formats);
+        std::vector<AudioStreamRangedDescription> formats,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get the current format of the stream.
     //! Virtual format defines the format used to present the device to the apps.
@@ -192,13 +199,15 @@ public:
 
     //! Set current virtual format of the stream.
     //! Requests HAL to asynchronously invoke SetVirtualFormatImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     //! Fails if format is not present in GetAvailableVirtualFormats(), which by
     //! default returns only one format, provided during initialization.
     //! If you want to make your stream supporting multiple formats, you typically
     //! need to override both of these methods.
     //! @note
     //!  Backs @c kAudioStreamPropertyVirtualFormat property.
-    OSStatus SetVirtualFormatAsync(AudioStreamBasicDescription format);
+    OSStatus SetVirtualFormatAsync(AudioStreamBasicDescription format,
+        std::future<OSStatus>* completion = nullptr);
 
     //! Get list of supported virtual formats.
     //! Empty list means that any format is allowed.
@@ -212,8 +221,10 @@ public:
     //! Asynchronously set list of supported virtual formats.
     //! See comments for GetAvailableVirtualFormats().
     //! Requests HAL to asynchronously invoke SetAvailableVirtualFormatsImpl().
+    //! If @p completion is non-null, it receives the result of the change.
     OSStatus SetAvailableVirtualFormatsAsync(
-        std::vector<AudioStreamRangedDescription> formats);
+        std::vector<AudioStreamRangedDescription> formats,
+        std::future<OSStatus>* completion = nullptr);
 
     //! @}
 
@@ -256,6 +267,13 @@ public:
     //! Similar to Device::RequestConfigurationChange().
     void RequestConfigurationChange(std::function<void()> func = {});
 
+    //! Request HAL to perform configuration update and report its result.
+    //! Similar to Device::RequestConfigurationChangeWithResult().
+    //! If stream is not added to device, the future becomes ready with
+    //! Device::ConfigurationChangeAbortedError.
+    std::future<OSStatus> RequestConfigurationChangeWithResult(
+        std::function<OSStatus()> func);
+
     //! @}
 
     //! @name Property dispatch
@@ -6,12 +6,17 @@
 
 #pragma once
 
+#include <aspl/DoubleBuffer.hpp>
+
 #include <CoreAudio/AudioServerPlugIn.h>
 
 #include <pthread.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace aspl {
 
@@ -30,7 +35,12 @@ namespace aspl {
 //! modes or override Print() method.
 //!
 //! If you want to exclude some operations from trace, you can override
-//! ShouldIgnore() method.
+//! ShouldIgnore() method, or install a filter using SetFilter(). Unlike
+//! ShouldIgnore(), filter can be changed at any time while tracer is in use.
+//!
+//! If you want to exclude all tracing code from the library, build it with
+//! ENABLE_TRACING CMake option disabled. In this case tracer methods are
+//! never invoked by library objects.
 class Tracer
 {
 public:
@@ -120,6 +130,22 @@ public:
         const void* OutData = nullptr;
     };
 
+    //! Operation filter.
+    //! Empty filter allows all operations.
+    struct Filter
+    {
+        //! If non-empty, only operations initiated for these objects are traced.
+        std::vector<AudioObjectID> ObjectIDs;
+
+        //! If non-empty, only operations with property address having one
+        //! of these selectors are traced.
+        std::vector<AudioObjectPropertySelector> Selectors;
+
+        //! If non-zero, operations nested deeper than this are not traced.
+        //! Top-level operations have depth 1.
+        UInt32 MaxDepth = 0;
+    };
+
     //! Initialize tracer.
     //! Mode defines where to send messages.
     //! Style defines how to format messages.
@@ -130,6 +156,27 @@ public:
 
     virtual ~Tracer() = default;
 
+    //! Check whether tracer is enabled.
+    //! Returns false if mode is Mode::Noop. In this case library objects
+    //! skip calls to OperationBegin(), Message(), and OperationEnd() and
+    //! don't evaluate message arguments, so derived classes that override
+    //! these methods should use Mode::Custom.
+    bool IsEnabled() const
+    {
+        return mode_ != Mode::Noop;
+    }
+
+    //! Set operation filter.
+    //! Operations not matching filter, as well as all nested operations and
+    //! messages, are not printed. Filter can be changed at any time from any
+    //! thread; the change affects operations started after the call.
+    //! Messages outside of any operation are printed only if filter doesn't
+    //! restrict objects and selectors.
+    void SetFilter(const Filter& filter);
+
+    //! Get operation filter.
+    Filter GetFilter() const;
+
     //! Called when an operations starts.
     //! Default implementation formats arguments and calls Print().
     virtual void OperationBegin(const Operation& operation);
@@ -144,16 +191,50 @@ public:
     virtual void OperationEnd(const Operation& operation, OSStatus status);
 
 protected:
-    //! Format operation begin message into string.
+    //! Format operation begin message into buffer.
     //! Called by default implementation of OperationBegin().
+    //! Result should be null-terminated and truncated to fit @p bufSize.
+    //! Default implementation does not allocate memory.
+    virtual void FormatOperationBegin(const Operation& operation,
+        UInt32 depth,
+        char* buf,
+        size_t bufSize);
+
+    //! Format message into buffer.
+    //! Called by default implementation of Message().
+    //! Result should be null-terminated and truncated to fit @p bufSize.
+    //! Default implementation does not allocate memory.
+    virtual void FormatMessage(const char* message,
+        UInt32 depth,
+        char* buf,
+        size_t bufSize);
+
+    //! Format operation end message into buffer.
+    //! Called by default implementation of OperationEnd().
+    //! Result should be null-terminated and truncated to fit @p bufSize.
+    //! Default implementation does not allocate memory.
+    virtual void FormatOperationEnd(const Operation& operation,
+        OSStatus status,
+        UInt32 depth,
+        char* buf,
+        size_t bufSize);
+
+    //! Format operation begin message into string.
+    //! @deprecated
+    //!  Override buffer variant instead, which doesn't allocate memory.
+    //!  If this method is overridden, tracer keeps calling it instead of
+    //!  buffer variant. Default implementation invokes buffer variant and
+    //!  switches tracer to it, hence overrides should not call it.
     virtual std::string FormatOperationBegin(const Operation& operation, UInt32 depth);
 
     //! Format message into string.
-    //! Called by default implementation of Message().
+    //! @deprecated
+    //!  Same as for FormatOperationBegin().
     virtual std::string FormatMessage(const char* message, UInt32 depth);
 
     //! Format operation end message into string.
-    //! Called by default implementation of OperationEnd().
+    //! @deprecated
+    //!  Same as for FormatOperationBegin().
     virtual std::string FormatOperationEnd(const Operation& operation,
         OSStatus status,
         UInt32 depth);
@@ -174,8 +255,28 @@ private:
     {
         UInt32 DepthCounter = 0;
         UInt32 IgnoreCounter = 0;
+        UInt32 MatchCounter = 0;
     };
 
+    // Filter in a form that is fast to check.
+    struct CompiledFilter
+    {
+        Filter Source;
+
+        // bitset over object IDs, empty if ObjectIDs is empty;
+        // IDs that don't fit into bitset are stored in hash set
+        std::vector<UInt64> ObjectBits;
+        std::unordered_set<AudioObjectID> LargeObjectIDs;
+
+        // hash set of selectors, empty if Selectors is empty
+        std::unordered_set<AudioObjectPropertySelector> Selectors;
+
+        bool Restricted = false;
+    };
+
+    bool IsFiltered(const Operation& operation, ThreadLocalState& threadState);
+    bool IsMessageFiltered(const ThreadLocalState& threadState);
+
     static void* CreateThreadLocalState();
     static void DestroyThreadLocalState(void*);
 
@@ -187,6 +288,21 @@ private:
     const Style style_;
 
     pthread_key_t threadKey_;
+
+    std::atomic<bool> hasFilter_ = false;
+
+    // Bitmask of deprecated string formatting hooks that may be overridden.
+    // Bits are cleared when default implementation of the hook is invoked.
+    enum : UInt32
+    {
+        LegacyFormatBegin = (1 << 0),
+        LegacyFormatMessage = (1 << 1),
+        LegacyFormatEnd = (1 << 2),
+    };
+
+    std::atomic<UInt32> legacyFormatHooks_ =
+        LegacyFormatBegin | LegacyFormatMessage | LegacyFormatEnd;
+    DoubleBuffer<CompiledFilter> filter_;
 };
 
 } // namespace aspl
@@ -61,6 +61,9 @@ struct VolumeControlParameters
 //! You can attach VolumeControl to Stream using Stream::AttachVolumeControl()
 //! method, and then stream will use it to process samples passed to stream.
 //! Alternatively, you can invoke VolumeControls manually the way you need.
+//!
+//! Volume curve is immutable and shared between all controls with the same
+//! raw and decibel ranges, so that creating many controls is cheap.
 class VolumeControl : public Object
 {
 public:
@@ -223,7 +226,7 @@ protected:
 
 private:
     const VolumeControlParameters params_;
-    const std::unique_ptr<VolumeCurve> volumeCurve_;
+    const std::shared_ptr<const VolumeCurve> volumeCurve_;
 
     std::mutex writeMutex_;
     std::atomic<SInt32> rawVolume_ = 0;
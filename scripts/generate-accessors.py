@@ -81,7 +81,9 @@ template = env.from_string('''
 #include <aspl/{{ class }}.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -113,7 +115,8 @@ bool {{ class }}::IsInstance(AudioClassID classID) const
 {% if (prop.is_settable or prop.is_user_settable) and not prop.hand_written_setter %}
 {% if prop.is_async %}
 
-OSStatus {{ class }}::Set{{ prop_name }}Async({{ prop.user_type or prop.type }} value)
+OSStatus {{ class }}::Set{{ prop_name }}Async({{ prop.user_type or prop.type }} value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock({{ setter_mutex }});
 
@@ -121,48 +124,64 @@ OSStatus {{ class }}::Set{{ prop_name }}Async({{ prop.user_type or prop.type }}
     op.Name = "{{ class }}::Set{{ prop_name }}Async()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == Get{{ prop_name }}()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 {% if prop.is_checked %}
 
     status = Check{{ prop_name }}(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("value is invalid");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value is invalid");
         goto end;
     }
 {% endif %}
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock({{ setter_mutex }});
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock({{ setter_mutex }});
 
-        Tracer::Operation op;
-        op.Name = "{{ class }}::Set{{ prop_name }}Impl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "{{ class }}::Set{{ prop_name }}Impl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == Get{{ prop_name }}()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == Get{{ prop_name }}()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = Set{{ prop_name }}Impl(std::move(value));
-        }
+                status = Set{{ prop_name }}Impl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -176,29 +195,29 @@ OSStatus {{ class }}::Set{{ prop_name }}({{ prop.user_type or prop.type }} value
     op.Name = "{{ class }}::Set{{ prop_name }}()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == Get{{ prop_name }}()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 {% if prop.is_checked %}
 
     status = Check{{ prop_name }}(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("value is invalid");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value is invalid");
         goto end;
     }
 {% endif %}
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = Set{{ prop_name }}Impl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
@@ -209,7 +228,7 @@ OSStatus {{ class }}::Set{{ prop_name }}({{ prop.user_type or prop.type }} value
 {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -230,10 +249,10 @@ Boolean {{ class }}::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -250,20 +269,20 @@ Boolean {{ class }}::HasProperty(AudioObjectID objectID,
                 case {{ scope }}:
                 {% endfor %}
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
                     break;
                 }
                 {% else %}
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
                 {% endif %}
             }
@@ -280,7 +299,7 @@ Boolean {{ class }}::HasProperty(AudioObjectID objectID,
     {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -298,10 +317,10 @@ OSStatus {{ class }}::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -314,10 +333,10 @@ OSStatus {{ class }}::IsPropertySettable(AudioObjectID objectID,
         case {{ prop.id }}:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable={{ settable }}");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable={{ settable }}");
                     *outIsSettable = {{ settable }};
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -333,7 +352,7 @@ OSStatus {{ class }}::IsPropertySettable(AudioObjectID objectID,
     {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -356,10 +375,10 @@ OSStatus {{ class }}::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -376,18 +395,18 @@ OSStatus {{ class }}::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = Get{{ prop_name }}({{ prop_args }});
                     *outDataSize = UInt32(values.size()
                         * sizeof({{ prop.type }}));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
                 {% else %}
                 if (outDataSize) {
                     *outDataSize = sizeof({{ prop.type }});
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
                 {% endif %}
             }
@@ -406,7 +425,7 @@ OSStatus {{ class }}::GetPropertyDataSize(AudioObjectID objectID,
     {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -433,10 +452,10 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -457,7 +476,7 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                 {% else %}
                 const size_t valuesCount = values.size();
                 if (inDataSize < valuesCount * sizeof({{ prop.type }})) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(valuesCount * sizeof({{ prop.type }})),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -468,7 +487,7 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof({{ prop.type }}));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -476,17 +495,17 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<{{ prop.type }}*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning {{ prop_name }}=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
                 {% else %}
                 if (inDataSize < sizeof({{ prop.type }})) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof({{ prop.type }})),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -495,7 +514,7 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof({{ prop.type }});
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     {% if prop.is_converter %}
@@ -504,13 +523,13 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                     Convert::FromFoundation(
                         *static_cast<const {{ prop.type }}*>(outData),
                         inputValue);
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "obtained input {{ prop_name }}=%s",
                         Convert::ToString(inputValue).c_str());
                     const auto value = Convert{{ prop_name }}(inputValue);
                     {% elif prop.is_qualified %}
                     if (qualifierDataSize != sizeof({{ prop.qualifier_type }})) {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "invalid qualifier size: should be %u, got %u",
                             unsigned(sizeof({{ prop.qualifier_type }})),
                             unsigned(qualifierDataSize));
@@ -522,7 +541,7 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                     Convert::FromFoundation(
                         *static_cast<const {{ prop.qualifier_type }}*>(qualifierData),
                         qualifierValue);
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "obtained qualifier {{ prop_name }}=%s",
                         Convert::ToString(qualifierValue).c_str());
                     const auto value = Get{{ prop_name }}(qualifierValue);
@@ -532,11 +551,11 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
                     Convert::ToFoundation(
                         value,
                         *static_cast<{{ prop.type }}*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning {{ prop_name }}=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
                 {% endif %}
             }
@@ -557,7 +576,7 @@ OSStatus {{ class }}::GetPropertyData(AudioObjectID objectID,
     {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -581,10 +600,10 @@ OSStatus {{ class }}::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -598,14 +617,14 @@ OSStatus {{ class }}::SetPropertyData(AudioObjectID objectID,
             {
                 {% if prop.is_array %}
                 if (inDataSize % sizeof({{ prop.type }}) != 0) {
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "invalid size: should be multiple of %u, got %u",
                         unsigned(sizeof({{ prop.type }})), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (inDataSize != 0 && !inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -617,23 +636,23 @@ OSStatus {{ class }}::SetPropertyData(AudioObjectID objectID,
                         static_cast<const {{ prop.type }}*>(inData)[i],
                         values[i]);
                 }
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting {{ prop_name }}=%s",
                     Convert::ToString(values).c_str());
                 status = Set{{ prop_name }}{{ prop_suffix }}(std::move(values));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
                 {% else %}
                 if (inDataSize != sizeof({{ prop.type }})) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof({{ prop.type }})), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -642,12 +661,12 @@ OSStatus {{ class }}::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const {{ prop.type }}*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting {{ prop_name }}=%s",
                     Convert::ToString(value).c_str());
                 status = Set{{ prop_name }}{{ prop_suffix }}(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
                 {% endif %}
@@ -667,7 +686,7 @@ OSStatus {{ class }}::SetPropertyData(AudioObjectID objectID,
     {% endif %}
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -12,6 +12,13 @@ func_fields = [
     'object_type',
     'return',
     'args',
+    'running_devices',
+]
+
+running_devices_roles = [
+    'pin',
+    'unpin',
+    'lookup',
 ]
 
 parser = argparse.ArgumentParser()
@@ -27,6 +34,11 @@ for func in funcs.values():
     for field in func.keys():
         if not field in func_fields:
             raise RuntimeError("unknown field %s" % field)
+    if 'running_devices' in func:
+        if not func['running_devices'] in running_devices_roles:
+            raise RuntimeError("unknown running_devices role %s" % func['running_devices'])
+        if func['object_type'] != 'Device':
+            raise RuntimeError("running_devices requires Device object_type")
 
 env = jinja2.Environment(
     trim_blocks=True,
@@ -44,9 +56,10 @@ template = env.from_string('''
 // Licensed under MIT
 
 #include <aspl/Driver.hpp>
-#include <aspl/Tracer.hpp>
 
 #include "Bridge.hpp"
+#include "RunningDevices.hpp"
+#include "Tracing.hpp"
 
 namespace aspl {
 
@@ -73,11 +86,28 @@ namespace aspl {
     }
 {% endif %}
 
+{% if func.running_devices is defined and func.running_devices == 'lookup' %}
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+{% for arg_num, arg_name in enumerate(func.args) %}
+{% if arg_num == 0 %}
+{% elif arg_num == 1 %}
+        return device->{{ func_name }}(
+            {{ arg_name }},
+{% elif arg_num != len(func.args) - 1 %}
+            {{ arg_name }},
+{% else %}
+            {{ arg_name }});
+{% endif %}
+{% endfor %}
+    }
+
+{% endif %}
     {{ func.return }} result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::{{ func_name }}() objectID=%u object not registered",
              unsigned(objectID));
 {% if func.return == 'OSStatus' %}
@@ -97,6 +127,18 @@ namespace aspl {
         {{ arg_name }});
 {% endif %}
 {% endfor %}
+{% if func.running_devices is defined and func.running_devices == 'pin' %}
+
+    if (result == kAudioHardwareNoError) {
+        driver->runningDevices_->Pin(
+            objectID, std::static_pointer_cast<{{ func.object_type }}>(object));
+    }
+{% elif func.running_devices is defined and func.running_devices == 'unpin' %}
+
+    if (result == kAudioHardwareNoError) {
+        driver->runningDevices_->Unpin(objectID);
+    }
+{% endif %}
 
 end:
     return result;
@@ -156,7 +156,7 @@ template = env.from_string('''
 
 namespace aspl {
 
-std::string ClassIDToString(AudioClassID classID)
+std::string_view ClassIDToString(AudioClassID classID, StringBuffer& buf)
 {
     switch (classID) {
     {% for name, code in sorted(class2code.items()) %}
@@ -164,11 +164,11 @@ std::string ClassIDToString(AudioClassID classID)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(classID);
+        return CodeToString(classID, buf);
     }
 }
 
-std::string PropertySelectorToString(AudioObjectPropertySelector selector)
+std::string_view PropertySelectorToString(AudioObjectPropertySelector selector, StringBuffer& buf)
 {
     switch (selector) {
     {% for name, code in sorted(selector2code.items()) %}
@@ -176,11 +176,11 @@ std::string PropertySelectorToString(AudioObjectPropertySelector selector)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(selector);
+        return CodeToString(selector, buf);
     }
 }
 
-std::string PropertyScopeToString(AudioObjectPropertyScope scope)
+std::string_view PropertyScopeToString(AudioObjectPropertyScope scope, StringBuffer& buf)
 {
     switch (scope) {
     {% for name, code in sorted(scope2code.items()) %}
@@ -188,11 +188,11 @@ std::string PropertyScopeToString(AudioObjectPropertyScope scope)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(scope);
+        return CodeToString(scope, buf);
     }
 }
 
-std::string OperationIDToString(UInt32 operationID)
+std::string_view OperationIDToString(UInt32 operationID, StringBuffer& buf)
 {
     switch (operationID) {
     {% for name, code in sorted(operation2code.items()) %}
@@ -200,11 +200,11 @@ std::string OperationIDToString(UInt32 operationID)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(operationID);
+        return CodeToString(operationID, buf);
     }
 }
 
-std::string StatusToString(OSStatus status)
+std::string_view StatusToString(OSStatus status, StringBuffer& buf)
 {
     switch (status) {
     case kAudioHardwareNoError:
@@ -214,11 +214,11 @@ std::string StatusToString(OSStatus status)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(UInt32(status));
+        return CodeToString(UInt32(status), buf);
     }
 }
 
-std::string FormatIDToString(AudioFormatID fmtid2code)
+std::string_view FormatIDToString(AudioFormatID fmtid2code, StringBuffer& buf)
 {
     switch (fmtid2code) {
     {% for name, code in sorted(fmtid2code.items()) %}
@@ -226,22 +226,20 @@ std::string FormatIDToString(AudioFormatID fmtid2code)
         return "{{ name }}";
     {% endfor %}
     default:
-        return CodeToString(fmtid2code);
+        return CodeToString(fmtid2code, buf);
     }
 }
 
-std::string FormatFlagsToString(AudioFormatFlags formatFlags)
+std::string_view FormatFlagsToString(AudioFormatFlags formatFlags, StringBuffer& buf)
 {
-    std::string ret;
+    buf[0] = '\0';
+    size_t len = 0;
     {% for name, code in sorted(fmtflag2code.items()) %}
     if (formatFlags & {{ code }}) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "{{ name }}";
+        len = AppendFlagName(buf, len, "{{ name }}");
     }
     {% endfor %}
-    return ret;
+    return std::string_view(buf.data(), len);
 }
 
 } // namespace aspl
@@ -0,0 +1,92 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace aspl {
+
+namespace {
+
+thread_local UInt64 threadAllocationCount = 0;
+thread_local UInt64 threadAllocationBytes = 0;
+
+void* CountingAllocate(std::size_t size) noexcept
+{
+    threadAllocationCount++;
+    threadAllocationBytes += size;
+
+    return std::malloc(size ? size : 1);
+}
+
+} // namespace
+
+UInt64 GetThreadAllocationCount()
+{
+    return threadAllocationCount;
+}
+
+UInt64 GetThreadAllocationBytes()
+{
+    return threadAllocationBytes;
+}
+
+} // namespace aspl
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = aspl::CountingAllocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = aspl::CountingAllocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return aspl::CountingAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return aspl::CountingAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
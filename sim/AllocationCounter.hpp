@@ -0,0 +1,18 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+namespace aspl {
+
+// Get number of allocations made by global operator new on calling thread.
+// Counting is enabled for any executable linked with host simulator, which
+// replaces global operator new and delete.
+UInt64 GetThreadAllocationCount();
+
+// Get number of bytes requested from global operator new on calling thread.
+UInt64 GetThreadAllocationBytes();
+
+} // namespace aspl
@@ -0,0 +1,209 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "AllocationTracer.hpp"
+#include "AllocationCounter.hpp"
+
+#include "Strings.hpp"
+
+#include <algorithm>
+#include <cstdarg>
+
+namespace aspl {
+
+namespace {
+
+constexpr size_t MessageBufferLen = 1024;
+
+struct Frame
+{
+    const char* Name = nullptr;
+    AudioObjectPropertySelector Selector = 0;
+    UInt64 NumAllocations = 0;
+    UInt64 NumBytes = 0;
+};
+
+// Per-thread stack of running operations.
+struct ThreadState
+{
+    std::vector<Frame> Frames;
+    UInt64 LastAllocations = 0;
+    UInt64 LastBytes = 0;
+};
+
+thread_local ThreadState threadState;
+
+} // namespace
+
+AllocationTracer::AllocationTracer(std::shared_ptr<Tracer> inner)
+    : Tracer(Mode::Custom)
+    , inner_(std::move(inner))
+{
+}
+
+void AllocationTracer::OperationBegin(const Operation& operation)
+{
+    Flush();
+
+    if (inner_) {
+        inner_->OperationBegin(operation);
+    }
+
+    Frame frame;
+    frame.Name = operation.Name;
+
+    if (operation.PropertyAddress) {
+        frame.Selector = operation.PropertyAddress->mSelector;
+    }
+
+    threadState.Frames.push_back(frame);
+
+    Mark();
+}
+
+void AllocationTracer::Message(const char* format, ...)
+{
+    if (!inner_) {
+        return;
+    }
+
+    Flush();
+
+    char message[MessageBufferLen] = {};
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    inner_->Message("%s", message);
+
+    Mark();
+}
+
+void AllocationTracer::OperationEnd(const Operation& operation, OSStatus status)
+{
+    Flush();
+
+    if (!threadState.Frames.empty()) {
+        const Frame frame = threadState.Frames.back();
+        threadState.Frames.pop_back();
+
+        std::lock_guard lock(mutex_);
+
+        auto& entry = entries_[Key(frame.Name ? frame.Name : "", frame.Selector)];
+
+        entry.OperationName = frame.Name ? frame.Name : "";
+        entry.Selector = frame.Selector;
+        entry.NumCalls++;
+        entry.NumAllocations += frame.NumAllocations;
+        entry.NumBytes += frame.NumBytes;
+    }
+
+    if (inner_) {
+        inner_->OperationEnd(operation, status);
+    }
+
+    Mark();
+}
+
+std::vector<AllocationReportEntry> AllocationTracer::GetReport() const
+{
+    std::vector<AllocationReportEntry> report;
+
+    {
+        std::lock_guard lock(mutex_);
+
+        for (const auto& [key, entry] : entries_) {
+            report.push_back(entry);
+        }
+    }
+
+    std::stable_sort(report.begin(),
+        report.end(),
+        [](const AllocationReportEntry& a, const AllocationReportEntry& b) {
+            return a.NumAllocations > b.NumAllocations;
+        });
+
+    return report;
+}
+
+AllocationReportEntry AllocationTracer::GetOperationReport(
+    const char* operationName) const
+{
+    AllocationReportEntry result;
+    result.OperationName = operationName;
+
+    std::lock_guard lock(mutex_);
+
+    for (const auto& [key, entry] : entries_) {
+        if (entry.OperationName == operationName) {
+            result.NumCalls += entry.NumCalls;
+            result.NumAllocations += entry.NumAllocations;
+            result.NumBytes += entry.NumBytes;
+        }
+    }
+
+    return result;
+}
+
+void AllocationTracer::Reset()
+{
+    std::lock_guard lock(mutex_);
+
+    entries_.clear();
+}
+
+void AllocationTracer::PrintReport(FILE* fp) const
+{
+    const auto report = GetReport();
+
+    fprintf(fp,
+        "%-40s %-48s %10s %10s %10s\n",
+        "operation",
+        "selector",
+        "calls",
+        "allocs",
+        "bytes");
+
+    for (const auto& entry : report) {
+        const std::string selector =
+            entry.Selector ? PropertySelectorToString(entry.Selector) : "-";
+
+        fprintf(fp,
+            "%-40s %-48s %10llu %10llu %10llu\n",
+            entry.OperationName.c_str(),
+            selector.c_str(),
+            (unsigned long long)entry.NumCalls,
+            (unsigned long long)entry.NumAllocations,
+            (unsigned long long)entry.NumBytes);
+    }
+
+    fflush(fp);
+}
+
+// Attribute allocations made since last Mark() to the innermost operation.
+void AllocationTracer::Flush()
+{
+    const UInt64 allocations = GetThreadAllocationCount();
+    const UInt64 bytes = GetThreadAllocationBytes();
+
+    if (!threadState.Frames.empty()) {
+        auto& frame = threadState.Frames.back();
+
+        frame.NumAllocations += allocations - threadState.LastAllocations;
+        frame.NumBytes += bytes - threadState.LastBytes;
+    }
+
+    threadState.LastAllocations = allocations;
+    threadState.LastBytes = bytes;
+}
+
+// Exclude allocations made by tracer itself.
+void AllocationTracer::Mark()
+{
+    threadState.LastAllocations = GetThreadAllocationCount();
+    threadState.LastBytes = GetThreadAllocationBytes();
+}
+
+} // namespace aspl
@@ -0,0 +1,90 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/Tracer.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aspl {
+
+// Allocations attributed to an operation.
+struct AllocationReportEntry
+{
+    // Operation name, e.g. "Device::GetPropertyData()".
+    std::string OperationName;
+
+    // Property selector, or zero if operation has no property address.
+    AudioObjectPropertySelector Selector = 0;
+
+    // Number of completed operations.
+    UInt64 NumCalls = 0;
+
+    // Number of operator new calls made inside operations.
+    UInt64 NumAllocations = 0;
+
+    // Number of bytes requested inside operations.
+    UInt64 NumBytes = 0;
+};
+
+// Tracer that accounts heap allocations per operation.
+//
+// Uses global operator new hook from AllocationCounter, so it works in any
+// executable linked with host simulator. Allocations are attributed to the
+// innermost operation that was running on the calling thread when they were
+// made, i.e. nested operations are not counted twice. Allocations made
+// outside of any operation are ignored.
+//
+// Entries are keyed by Tracer::Operation::Name and, if operation has
+// property address, by property selector.
+//
+// If inner tracer is provided, all calls are forwarded to it, but allocations
+// made by inner tracer itself are excluded from accounting.
+//
+// Note that realtime operations are reported to tracer only if
+// DeviceParameters::EnableRealtimeTracing is set.
+class AllocationTracer : public Tracer
+{
+public:
+    explicit AllocationTracer(std::shared_ptr<Tracer> inner = nullptr);
+
+    void OperationBegin(const Operation& operation) override;
+
+    void Message(const char* format, ...) override;
+
+    void OperationEnd(const Operation& operation, OSStatus status) override;
+
+    // Get all entries, sorted by number of allocations, from highest to lowest.
+    std::vector<AllocationReportEntry> GetReport() const;
+
+    // Get entry summed over all selectors of given operation.
+    AllocationReportEntry GetOperationReport(const char* operationName) const;
+
+    // Forget all entries.
+    void Reset();
+
+    // Print table with all entries.
+    void PrintReport(FILE* fp) const;
+
+private:
+    using Key = std::pair<std::string, AudioObjectPropertySelector>;
+
+    void Flush();
+    void Mark();
+
+    const std::shared_ptr<Tracer> inner_;
+
+    mutable std::mutex mutex_;
+    std::map<Key, AllocationReportEntry> entries_;
+};
+
+} // namespace aspl
@@ -0,0 +1,273 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+// Device registry benchmark.
+//
+// Creates plugin with many devices and repeatedly replaces random devices
+// with spare ones, first one by one, and then in batches. Reports time,
+// allocations, and HAL notifications per change, and latency of device
+// lookups by ID and UID.
+
+#include "AllocationCounter.hpp"
+#include "HostSimulator.hpp"
+
+#include <aspl/Driver.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+namespace {
+
+struct Options
+{
+    UInt32 NumDevices = 200;
+    UInt32 BatchSize = 16;
+    UInt64 NumRounds = 1000;
+    UInt64 NumLookups = 1000000;
+};
+
+struct ChurnReport
+{
+    double NsPerChange = 0;
+    double AllocationsPerChange = 0;
+    double NotificationsPerRound = 0;
+};
+
+void PrintUsage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -d, --devices N    number of devices (default: 200)\n"
+        "  -B, --batch N      number of replaced devices per round (default: 16)\n"
+        "  -n, --rounds N     number of rounds (default: 1000)\n"
+        "  -l, --lookups N    number of lookups (default: 1000000)\n"
+        "  -h, --help         print this message\n",
+        name);
+}
+
+bool ParseOptions(int argc, char** argv, Options& opts)
+{
+    const struct option longOpts[] = {
+        {"devices", required_argument, nullptr, 'd'},
+        {"batch", required_argument, nullptr, 'B'},
+        {"rounds", required_argument, nullptr, 'n'},
+        {"lookups", required_argument, nullptr, 'l'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    int ch;
+    while ((ch = getopt_long(argc, argv, "d:B:n:l:h", longOpts, nullptr)) != -1) {
+        switch (ch) {
+        case 'd':
+            opts.NumDevices = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'B':
+            opts.BatchSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'n':
+            opts.NumRounds = strtoull(optarg, nullptr, 10);
+            break;
+        case 'l':
+            opts.NumLookups = strtoull(optarg, nullptr, 10);
+            break;
+        default:
+            return false;
+        }
+    }
+
+    if (opts.NumDevices == 0 || opts.BatchSize == 0 || opts.NumRounds == 0) {
+        return false;
+    }
+
+    return true;
+}
+
+UInt64 Now()
+{
+    return UInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+                      .count());
+}
+
+std::string MakeUID(UInt32 index)
+{
+    return "com.example.aspl-devbench." + std::to_string(index);
+}
+
+// Every round replaces BatchSize random active devices with spare ones.
+// Replaced devices become spare and are reused by next rounds.
+ChurnReport RunChurn(const Options& opts,
+    aspl::Plugin& plugin,
+    aspl::HostSimulator& simulator,
+    std::vector<std::shared_ptr<aspl::Device>>& activeDevices,
+    std::vector<std::shared_ptr<aspl::Device>>& spareDevices,
+    bool batched)
+{
+    std::mt19937 rng(1);
+
+    size_t spareIndex = 0;
+
+    const UInt64 startNotifications = simulator.GetNotificationCount();
+    const UInt64 startAllocations = aspl::GetThreadAllocationCount();
+    const UInt64 startTime = Now();
+
+    for (UInt64 round = 0; round < opts.NumRounds; round++) {
+        if (batched) {
+            plugin.BeginDeviceBatch();
+        }
+
+        for (UInt32 n = 0; n < opts.BatchSize; n++) {
+            const size_t activeIndex = rng() % activeDevices.size();
+
+            plugin.RemoveDevice(activeDevices[activeIndex]);
+            plugin.AddDevice(spareDevices[spareIndex]);
+
+            std::swap(activeDevices[activeIndex], spareDevices[spareIndex]);
+            spareIndex = (spareIndex + 1) % spareDevices.size();
+        }
+
+        if (batched) {
+            plugin.EndDeviceBatch();
+        }
+    }
+
+    const UInt64 endTime = Now();
+    const UInt64 endAllocations = aspl::GetThreadAllocationCount();
+    const UInt64 endNotifications = simulator.GetNotificationCount();
+
+    const double numChanges = double(opts.NumRounds) * opts.BatchSize;
+
+    ChurnReport report;
+    report.NsPerChange = double(endTime - startTime) / numChanges;
+    report.AllocationsPerChange = double(endAllocations - startAllocations) / numChanges;
+    report.NotificationsPerRound =
+        double(endNotifications - startNotifications) / double(opts.NumRounds);
+
+    return report;
+}
+
+template <class Func>
+double MeasureLookups(const Options& opts, Func&& func)
+{
+    std::mt19937 rng(2);
+
+    const UInt64 startTime = Now();
+
+    for (UInt64 n = 0; n < opts.NumLookups; n++) {
+        func(rng());
+    }
+
+    const UInt64 endTime = Now();
+
+    return opts.NumLookups ? double(endTime - startTime) / double(opts.NumLookups)
+                           : 0.0;
+}
+
+void PrintChurn(const char* name, const ChurnReport& report)
+{
+    printf("%-20s%.3f us/change, %.1f allocations/change, %.2f notifications/round\n",
+        name,
+        report.NsPerChange / 1000.0,
+        report.AllocationsPerChange,
+        report.NotificationsPerRound);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    if (!ParseOptions(argc, argv, opts)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    auto tracer = std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop);
+    auto context = std::make_shared<aspl::Context>(tracer);
+
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::HostSimulator simulator(driver);
+
+    if (simulator.Initialize() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to initialize driver\n");
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<aspl::Device>> activeDevices;
+    std::vector<std::shared_ptr<aspl::Device>> spareDevices;
+    std::vector<std::string> uids;
+
+    for (UInt32 n = 0; n < opts.NumDevices + opts.BatchSize; n++) {
+        aspl::DeviceParameters deviceParams;
+        deviceParams.DeviceUID = MakeUID(n);
+
+        auto device = std::make_shared<aspl::Device>(context, deviceParams);
+
+        if (n < opts.NumDevices) {
+            activeDevices.push_back(device);
+        } else {
+            spareDevices.push_back(device);
+        }
+
+        uids.push_back(deviceParams.DeviceUID);
+    }
+
+    const UInt64 addStart = Now();
+
+    plugin->AddDevices(activeDevices);
+
+    const UInt64 addEnd = Now();
+
+    const auto singleReport =
+        RunChurn(opts, *plugin, simulator, activeDevices, spareDevices, false);
+
+    const auto batchedReport =
+        RunChurn(opts, *plugin, simulator, activeDevices, spareDevices, true);
+
+    std::vector<AudioObjectID> deviceIDs;
+    for (const auto& device : activeDevices) {
+        deviceIDs.push_back(device->GetID());
+    }
+
+    UInt64 numFound = 0;
+
+    const double uidLookupNs = MeasureLookups(opts, [&](UInt32 rnd) {
+        numFound += plugin->GetDeviceIDByUID(uids[rnd % uids.size()]) !=
+                    kAudioObjectUnknown;
+    });
+
+    const double idLookupNs = MeasureLookups(opts, [&](UInt32 rnd) {
+        numFound += plugin->GetDeviceByID(deviceIDs[rnd % deviceIDs.size()]) != nullptr;
+    });
+
+    printf("devices:            %u (+%u spare)\n",
+        unsigned(opts.NumDevices),
+        unsigned(opts.BatchSize));
+    printf("rounds:             %llu x %u changes\n",
+        (unsigned long long)opts.NumRounds,
+        unsigned(opts.BatchSize));
+    printf("initial add:        %.3f us\n", double(addEnd - addStart) / 1000.0);
+    PrintChurn("churn single:", singleReport);
+    PrintChurn("churn batched:", batchedReport);
+    printf("lookup by uid:      %.1f ns\n", uidLookupNs);
+    printf("lookup by id:       %.1f ns\n", idLookupNs);
+    printf("lookup hits:        %llu\n", (unsigned long long)numFound);
+
+    if (plugin->GetDeviceCount() != opts.NumDevices) {
+        fprintf(stderr, "unexpected device count\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,692 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "HostSimulator.hpp"
+#include "AllocationCounter.hpp"
+
+#include <aspl/Clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+
+#include <unistd.h>
+
+namespace aspl {
+
+namespace {
+
+struct OperationInfo
+{
+    UInt32 ID;
+    Direction Dir;
+    bool PerClient;
+};
+
+// Operations in the order in which HAL performs them during I/O cycle.
+// Per-client operations are performed for every client, other operations
+// are performed once per cycle for the whole device.
+const OperationInfo CycleOperations[] = {
+    {kAudioServerPlugInIOOperationReadInput, Direction::Input, false},
+    {kAudioServerPlugInIOOperationConvertInput, Direction::Input, false},
+    {kAudioServerPlugInIOOperationProcessInput, Direction::Input, true},
+    {kAudioServerPlugInIOOperationProcessOutput, Direction::Output, true},
+    {kAudioServerPlugInIOOperationMixOutput, Direction::Output, true},
+    {kAudioServerPlugInIOOperationProcessMix, Direction::Output, false},
+    {kAudioServerPlugInIOOperationConvertMix, Direction::Output, false},
+    {kAudioServerPlugInIOOperationWriteMix, Direction::Output, false},
+};
+
+struct PropertyInfo
+{
+    AudioObjectPropertySelector Selector;
+    // Property value is a CF object that should be released by caller.
+    bool IsCFType;
+};
+
+const PropertyInfo DeviceProperties[] = {
+    {kAudioObjectPropertyName, true},
+    {kAudioObjectPropertyManufacturer, true},
+    {kAudioDevicePropertyDeviceUID, true},
+    {kAudioDevicePropertyModelUID, true},
+    {kAudioObjectPropertyOwnedObjects, false},
+    {kAudioObjectPropertyControlList, false},
+    {kAudioDevicePropertyTransportType, false},
+    {kAudioDevicePropertyDeviceIsAlive, false},
+    {kAudioDevicePropertyDeviceIsRunning, false},
+    {kAudioDevicePropertyStreams, false},
+    {kAudioDevicePropertyNominalSampleRate, false},
+    {kAudioDevicePropertyAvailableNominalSampleRates, false},
+    {kAudioDevicePropertyLatency, false},
+    {kAudioDevicePropertySafetyOffset, false},
+    {kAudioDevicePropertyZeroTimeStampPeriod, false},
+    {kAudioDevicePropertyPreferredChannelsForStereo, false},
+};
+
+const PropertyInfo StreamProperties[] = {
+    {kAudioStreamPropertyIsActive, false},
+    {kAudioStreamPropertyDirection, false},
+    {kAudioStreamPropertyTerminalType, false},
+    {kAudioStreamPropertyStartingChannel, false},
+    {kAudioStreamPropertyLatency, false},
+    {kAudioStreamPropertyVirtualFormat, false},
+    {kAudioStreamPropertyPhysicalFormat, false},
+    {kAudioStreamPropertyAvailableVirtualFormats, false},
+    {kAudioStreamPropertyAvailablePhysicalFormats, false},
+};
+
+const PropertyInfo VolumeControlProperties[] = {
+    {kAudioControlPropertyScope, false},
+    {kAudioControlPropertyElement, false},
+    {kAudioLevelControlPropertyScalarValue, false},
+    {kAudioLevelControlPropertyDecibelValue, false},
+    {kAudioLevelControlPropertyDecibelRange, false},
+};
+
+const PropertyInfo MuteControlProperties[] = {
+    {kAudioControlPropertyScope, false},
+    {kAudioControlPropertyElement, false},
+    {kAudioBooleanControlPropertyValue, false},
+};
+
+UInt64 Percentile(const std::vector<UInt64>& sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+
+    const size_t idx = std::min(sorted.size() - 1, size_t(p * double(sorted.size())));
+
+    return sorted[idx];
+}
+
+} // namespace
+
+HostSimulator::HostSimulator(std::shared_ptr<Driver> driver,
+    const HostSimulatorParameters& params)
+    : driver_(std::move(driver))
+    , params_(params)
+{
+    host_.Interface = {};
+    host_.Interface.PropertiesChanged = &HostSimulator::PropertiesChanged;
+    host_.Interface.CopyFromStorage = &HostSimulator::CopyFromStorage;
+    host_.Interface.WriteToStorage = &HostSimulator::WriteToStorage;
+    host_.Interface.DeleteFromStorage = &HostSimulator::DeleteFromStorage;
+    host_.Interface.RequestDeviceConfigurationChange =
+        &HostSimulator::RequestDeviceConfigurationChange;
+    host_.Simulator = this;
+}
+
+HostSimulator::~HostSimulator()
+{
+    if (started_) {
+        Stop();
+    }
+}
+
+AudioServerPlugInHostRef HostSimulator::GetHost() const
+{
+    return &host_.Interface;
+}
+
+OSStatus HostSimulator::Initialize()
+{
+    const auto& iface = driver_->GetPluginInterface();
+
+    return iface.Initialize(driver_->GetReference(), GetHost());
+}
+
+OSStatus HostSimulator::ProcessConfigurationChanges()
+{
+    std::vector<ConfigurationRequest> requests;
+
+    {
+        std::lock_guard lock(configMutex_);
+        requests.swap(configRequests_);
+    }
+
+    const auto& iface = driver_->GetPluginInterface();
+
+    OSStatus status = kAudioHardwareNoError;
+
+    for (const auto& req : requests) {
+        const OSStatus reqStatus = iface.PerformDeviceConfigurationChange(
+            driver_->GetReference(), req.DeviceID, req.ChangeAction, req.ChangeInfo);
+
+        if (reqStatus != kAudioHardwareNoError && status == kAudioHardwareNoError) {
+            status = reqStatus;
+        }
+    }
+
+    return status;
+}
+
+OSStatus HostSimulator::QueryProperties(AudioObjectID deviceID)
+{
+    OSStatus status = ProcessConfigurationChanges();
+
+    if (status != kAudioHardwareNoError) {
+        return status;
+    }
+
+    const auto plugin = driver_->GetPlugin();
+
+    std::shared_ptr<Device> device;
+
+    if (deviceID == kAudioObjectUnknown) {
+        if (plugin->GetDeviceCount() != 0) {
+            device = plugin->GetDeviceByIndex(0);
+        }
+    } else {
+        device = plugin->GetDeviceByID(deviceID);
+    }
+
+    if (!device) {
+        return kAudioHardwareBadDeviceError;
+    }
+
+    auto query = [&](AudioObjectID objectID, const auto& properties) {
+        for (const auto& prop : properties) {
+            const OSStatus err = QueryProperty(objectID, prop.Selector, prop.IsCFType);
+
+            if (err != kAudioHardwareNoError && status == kAudioHardwareNoError) {
+                status = err;
+            }
+        }
+    };
+
+    query(device->GetID(), DeviceProperties);
+
+    for (auto dir : {Direction::Input, Direction::Output}) {
+        for (UInt32 idx = 0; idx < device->GetStreamCount(dir); idx++) {
+            query(device->GetStreamByIndex(dir, idx)->GetID(), StreamProperties);
+        }
+    }
+
+    for (auto scope : {kAudioObjectPropertyScopeInput, kAudioObjectPropertyScopeOutput}) {
+        for (UInt32 idx = 0; idx < device->GetVolumeControlCount(scope); idx++) {
+            query(device->GetVolumeControlByIndex(scope, idx)->GetID(),
+                VolumeControlProperties);
+        }
+
+        for (UInt32 idx = 0; idx < device->GetMuteControlCount(scope); idx++) {
+            query(device->GetMuteControlByIndex(scope, idx)->GetID(),
+                MuteControlProperties);
+        }
+    }
+
+    return status;
+}
+
+OSStatus HostSimulator::Start(AudioObjectID deviceID)
+{
+    if (started_) {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    OSStatus status = ProcessConfigurationChanges();
+
+    if (status != kAudioHardwareNoError) {
+        return status;
+    }
+
+    const auto plugin = driver_->GetPlugin();
+
+    if (deviceID == kAudioObjectUnknown) {
+        if (plugin->GetDeviceCount() == 0) {
+            return kAudioHardwareBadDeviceError;
+        }
+        device_ = plugin->GetDeviceByIndex(0);
+    } else {
+        device_ = plugin->GetDeviceByID(deviceID);
+    }
+
+    if (!device_) {
+        return kAudioHardwareBadDeviceError;
+    }
+
+    sampleRate_ = device_->GetNominalSampleRate();
+    sampleTime_ = 0;
+    cycleCounter_ = 0;
+
+    // Buffers are allocated here, so that cycles don't need to allocate.
+    streams_.clear();
+
+    for (auto dir : {Direction::Input, Direction::Output}) {
+        for (UInt32 idx = 0; idx < device_->GetStreamCount(dir); idx++) {
+            const auto stream = device_->GetStreamByIndex(dir, idx);
+
+            const UInt32 bytesPerFrame = std::max<UInt32>(
+                stream->GetPhysicalFormat().mBytesPerFrame,
+                stream->GetChannelCount() * sizeof(Float32));
+
+            StreamState state;
+            state.StreamID = stream->GetID();
+            state.Dir = dir;
+            state.Buffer.resize(size_t(bytesPerFrame) * params_.BufferFrameSize);
+
+            streams_.push_back(std::move(state));
+        }
+    }
+
+    report_ = {};
+    report_.DeadlineNs =
+        UInt64(Float64(params_.BufferFrameSize) * 1000000000.0 / sampleRate_);
+
+    latencies_.clear();
+
+    const auto& iface = driver_->GetPluginInterface();
+
+    clientIDs_.clear();
+
+    for (UInt32 n = 0; n < params_.NumClients; n++) {
+        AudioServerPlugInClientInfo clientInfo = {};
+        clientInfo.mClientID = n + 1;
+        clientInfo.mProcessID = getpid();
+        clientInfo.mIsNativeEndian = true;
+        clientInfo.mBundleID = CFSTR("com.github.gavv.aspl.sim");
+
+        status = iface.AddDeviceClient(
+            driver_->GetReference(), device_->GetID(), &clientInfo);
+
+        if (status != kAudioHardwareNoError) {
+            // undo clients added and started so far
+            StopClients(clientIDs_.size());
+            return status;
+        }
+
+        clientIDs_.push_back(clientInfo.mClientID);
+
+        status = iface.StartIO(
+            driver_->GetReference(), device_->GetID(), clientInfo.mClientID);
+
+        if (status != kAudioHardwareNoError) {
+            // last client is added but not started
+            StopClients(clientIDs_.size() - 1);
+            return status;
+        }
+    }
+
+    started_ = true;
+
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::Stop()
+{
+    if (!started_) {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    const OSStatus status = StopClients(clientIDs_.size());
+
+    started_ = false;
+
+    return status;
+}
+
+OSStatus HostSimulator::StopClients(size_t numStarted)
+{
+    const auto& iface = driver_->GetPluginInterface();
+
+    OSStatus status = kAudioHardwareNoError;
+
+    for (size_t n = 0; n < clientIDs_.size(); n++) {
+        const UInt32 clientID = clientIDs_[n];
+
+        if (n < numStarted) {
+            if (OSStatus err =
+                    iface.StopIO(driver_->GetReference(), device_->GetID(), clientID);
+                err != kAudioHardwareNoError) {
+                status = err;
+            }
+        }
+
+        AudioServerPlugInClientInfo clientInfo = {};
+        clientInfo.mClientID = clientID;
+        clientInfo.mProcessID = getpid();
+        clientInfo.mIsNativeEndian = true;
+        clientInfo.mBundleID = CFSTR("com.github.gavv.aspl.sim");
+
+        if (OSStatus err = iface.RemoveDeviceClient(
+                driver_->GetReference(), device_->GetID(), &clientInfo);
+            err != kAudioHardwareNoError) {
+            status = err;
+        }
+    }
+
+    clientIDs_.clear();
+
+    return status;
+}
+
+OSStatus HostSimulator::RunCycles(UInt64 numCycles)
+{
+    if (!started_) {
+        return kAudioHardwareNotRunningError;
+    }
+
+    OSStatus status = ProcessConfigurationChanges();
+
+    if (status != kAudioHardwareNoError) {
+        return status;
+    }
+
+    // Grow geometrically, so that running cycles one by one stays linear.
+    if (latencies_.capacity() < latencies_.size() + numCycles) {
+        latencies_.reserve(
+            std::max(latencies_.size() + numCycles, latencies_.capacity() * 2));
+    }
+
+    auto simulatedClock =
+        std::dynamic_pointer_cast<SimulatedClock>(driver_->GetContext()->Clock);
+
+    const auto period = std::chrono::nanoseconds(report_.DeadlineNs);
+    auto nextCycleTime = std::chrono::steady_clock::now();
+
+    for (UInt64 n = 0; n < numCycles; n++) {
+        if (params_.RealtimePacing) {
+            std::this_thread::sleep_until(nextCycleTime);
+            nextCycleTime += period;
+        }
+
+        const UInt64 allocsBefore = GetThreadAllocationCount();
+        const auto cycleBegin = std::chrono::steady_clock::now();
+
+        if (RunCycle() != kAudioHardwareNoError) {
+            status = kAudioHardwareUnspecifiedError;
+        }
+
+        const auto cycleEnd = std::chrono::steady_clock::now();
+        const UInt64 allocsAfter = GetThreadAllocationCount();
+
+        const UInt64 latency = UInt64(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(cycleEnd - cycleBegin)
+                .count());
+
+        latencies_.push_back(latency);
+
+        report_.NumCycles++;
+        report_.NumAllocations += allocsAfter - allocsBefore;
+
+        if (latency > report_.DeadlineNs) {
+            report_.NumMissedDeadlines++;
+        }
+
+        if (simulatedClock) {
+            simulatedClock->AdvanceFrames(params_.BufferFrameSize, sampleRate_);
+        }
+    }
+
+    return status;
+}
+
+HostSimulatorReport HostSimulator::GetReport() const
+{
+    HostSimulatorReport report = report_;
+
+    if (latencies_.empty()) {
+        return report;
+    }
+
+    std::vector<UInt64> sorted = latencies_;
+    std::sort(sorted.begin(), sorted.end());
+
+    UInt64 sum = 0;
+    for (auto latency : sorted) {
+        sum += latency;
+    }
+
+    report.MinLatencyNs = sorted.front();
+    report.AvgLatencyNs = sum / sorted.size();
+    report.P50LatencyNs = Percentile(sorted, 0.5);
+    report.P90LatencyNs = Percentile(sorted, 0.9);
+    report.P99LatencyNs = Percentile(sorted, 0.99);
+    report.P999LatencyNs = Percentile(sorted, 0.999);
+    report.MaxLatencyNs = sorted.back();
+
+    return report;
+}
+
+UInt64 HostSimulator::GetNotificationCount() const
+{
+    return notificationCount_;
+}
+
+UInt64 HostSimulator::GetConfigurationRequestCount() const
+{
+    return configRequestCount_;
+}
+
+OSStatus HostSimulator::QueryProperty(AudioObjectID objectID,
+    AudioObjectPropertySelector selector,
+    bool isCFType)
+{
+    const auto& iface = driver_->GetPluginInterface();
+
+    const AudioObjectPropertyAddress address = {
+        selector,
+        kAudioObjectPropertyScopeGlobal,
+        kAudioObjectPropertyElementMain,
+    };
+
+    UInt32 dataSize = 0;
+
+    OSStatus status = iface.GetPropertyDataSize(
+        driver_->GetReference(), objectID, getpid(), &address, 0, nullptr, &dataSize);
+
+    if (status != kAudioHardwareNoError) {
+        return status;
+    }
+
+    std::vector<UInt8> data(std::max<UInt32>(dataSize, 1));
+
+    status = iface.GetPropertyData(driver_->GetReference(),
+        objectID,
+        getpid(),
+        &address,
+        0,
+        nullptr,
+        dataSize,
+        &dataSize,
+        data.data());
+
+    if (status != kAudioHardwareNoError) {
+        return status;
+    }
+
+    if (isCFType && dataSize == sizeof(CFTypeRef)) {
+        CFTypeRef ref = nullptr;
+        memcpy(&ref, data.data(), sizeof(ref));
+
+        if (ref) {
+            CFRelease(ref);
+        }
+    }
+
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::RunCycle()
+{
+    const auto& iface = driver_->GetPluginInterface();
+
+    OSStatus status = kAudioHardwareNoError;
+
+    Float64 zeroSampleTime = 0;
+    UInt64 zeroHostTime = 0;
+    UInt64 zeroSeed = 0;
+
+    status = iface.GetZeroTimeStamp(driver_->GetReference(),
+        device_->GetID(),
+        clientIDs_.front(),
+        &zeroSampleTime,
+        &zeroHostTime,
+        &zeroSeed);
+
+    if (status != kAudioHardwareNoError) {
+        report_.NumFailedCalls++;
+    }
+
+    const auto clock = driver_->GetContext()->Clock;
+
+    AudioServerPlugInIOCycleInfo cycleInfo = {};
+    cycleInfo.mIOCycleCounter = cycleCounter_;
+    cycleInfo.mNominalIOBufferFrameSize = params_.BufferFrameSize;
+    cycleInfo.mMainHostTicksPerFrame = clock->GetHostClockFrequency() / sampleRate_;
+
+    cycleInfo.mCurrentTime.mSampleTime = sampleTime_;
+    cycleInfo.mCurrentTime.mHostTime = clock->GetHostTime();
+    cycleInfo.mCurrentTime.mFlags =
+        kAudioTimeStampSampleTimeValid | kAudioTimeStampHostTimeValid;
+
+    cycleInfo.mInputTime = cycleInfo.mCurrentTime;
+    cycleInfo.mInputTime.mSampleTime = sampleTime_ - params_.BufferFrameSize;
+
+    cycleInfo.mOutputTime = cycleInfo.mCurrentTime;
+    cycleInfo.mOutputTime.mSampleTime = sampleTime_ + params_.BufferFrameSize;
+
+    for (const auto& op : CycleOperations) {
+        if (RunOperation(op.ID, op.Dir, op.PerClient, cycleInfo) !=
+            kAudioHardwareNoError) {
+            status = kAudioHardwareUnspecifiedError;
+        }
+    }
+
+    sampleTime_ += params_.BufferFrameSize;
+    cycleCounter_++;
+
+    return status;
+}
+
+OSStatus HostSimulator::RunOperation(UInt32 operationID,
+    Direction dir,
+    bool perClient,
+    const AudioServerPlugInIOCycleInfo& cycleInfo)
+{
+    const auto& iface = driver_->GetPluginInterface();
+    const auto driverRef = driver_->GetReference();
+    const auto deviceID = device_->GetID();
+
+    const size_t numClients = perClient ? clientIDs_.size() : 1;
+
+    OSStatus status = kAudioHardwareNoError;
+
+    for (size_t clientIdx = 0; clientIdx < numClients; clientIdx++) {
+        const UInt32 clientID = clientIDs_[clientIdx];
+
+        Boolean willDo = false;
+        Boolean willDoInPlace = false;
+
+        if (iface.WillDoIOOperation(
+                driverRef, deviceID, clientID, operationID, &willDo, &willDoInPlace) !=
+            kAudioHardwareNoError) {
+            report_.NumFailedCalls++;
+            status = kAudioHardwareUnspecifiedError;
+            continue;
+        }
+
+        if (!willDo) {
+            continue;
+        }
+
+        if (iface.BeginIOOperation(driverRef,
+                deviceID,
+                clientID,
+                operationID,
+                params_.BufferFrameSize,
+                &cycleInfo) != kAudioHardwareNoError) {
+            report_.NumFailedCalls++;
+            status = kAudioHardwareUnspecifiedError;
+        }
+
+        for (auto& stream : streams_) {
+            if (stream.Dir != dir) {
+                continue;
+            }
+
+            if (iface.DoIOOperation(driverRef,
+                    deviceID,
+                    stream.StreamID,
+                    clientID,
+                    operationID,
+                    params_.BufferFrameSize,
+                    &cycleInfo,
+                    stream.Buffer.data(),
+                    nullptr) != kAudioHardwareNoError) {
+                report_.NumFailedCalls++;
+                status = kAudioHardwareUnspecifiedError;
+            }
+        }
+
+        if (iface.EndIOOperation(driverRef,
+                deviceID,
+                clientID,
+                operationID,
+                params_.BufferFrameSize,
+                &cycleInfo) != kAudioHardwareNoError) {
+            report_.NumFailedCalls++;
+            status = kAudioHardwareUnspecifiedError;
+        }
+    }
+
+    return status;
+}
+
+HostSimulator* HostSimulator::GetSimulator(AudioServerPlugInHostRef host)
+{
+    return reinterpret_cast<const HostState*>(
+        reinterpret_cast<const UInt8*>(host) - offsetof(HostState, Interface))
+        ->Simulator;
+}
+
+OSStatus HostSimulator::PropertiesChanged(AudioServerPlugInHostRef host,
+    AudioObjectID objectID,
+    UInt32 numberAddresses,
+    const AudioObjectPropertyAddress* addresses)
+{
+    GetSimulator(host)->notificationCount_++;
+
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::CopyFromStorage(AudioServerPlugInHostRef host,
+    CFStringRef key,
+    CFPropertyListRef* outData)
+{
+    // Storage is not persisted.
+    *outData = nullptr;
+
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::WriteToStorage(AudioServerPlugInHostRef host,
+    CFStringRef key,
+    CFPropertyListRef data)
+{
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::DeleteFromStorage(AudioServerPlugInHostRef host, CFStringRef key)
+{
+    return kAudioHardwareNoError;
+}
+
+OSStatus HostSimulator::RequestDeviceConfigurationChange(AudioServerPlugInHostRef host,
+    AudioObjectID deviceObjectID,
+    UInt64 changeAction,
+    void* changeInfo)
+{
+    const auto simulator = GetSimulator(host);
+
+    simulator->configRequestCount_++;
+
+    std::lock_guard lock(simulator->configMutex_);
+    simulator->configRequests_.push_back({deviceObjectID, changeAction, changeInfo});
+
+    return kAudioHardwareNoError;
+}
+
+} // namespace aspl
@@ -0,0 +1,212 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/Device.hpp>
+#include <aspl/Driver.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aspl {
+
+// Host simulator parameters.
+struct HostSimulatorParameters
+{
+    // Number of clients to attach to device.
+    UInt32 NumClients = 1;
+
+    // Number of frames per I/O cycle.
+    UInt32 BufferFrameSize = 512;
+
+    // If true, cycles are paced according to wall clock, i.e. simulator
+    // sleeps until the beginning of each next cycle.
+    // If false, cycles are run back-to-back.
+    bool RealtimePacing = false;
+};
+
+// Host simulator report.
+// Latencies are measured in nanoseconds of wall clock time.
+struct HostSimulatorReport
+{
+    // Number of performed cycles.
+    UInt64 NumCycles = 0;
+
+    // Number of cycles which took longer than one buffer duration.
+    UInt64 NumMissedDeadlines = 0;
+
+    // Number of driver calls that returned error.
+    UInt64 NumFailedCalls = 0;
+
+    // Number of allocations made during cycles.
+    UInt64 NumAllocations = 0;
+
+    // Buffer duration, i.e. time budget for a single cycle.
+    UInt64 DeadlineNs = 0;
+
+    // Cycle latency statistics.
+    UInt64 MinLatencyNs = 0;
+    UInt64 AvgLatencyNs = 0;
+    UInt64 P50LatencyNs = 0;
+    UInt64 P90LatencyNs = 0;
+    UInt64 P99LatencyNs = 0;
+    UInt64 P999LatencyNs = 0;
+    UInt64 MaxLatencyNs = 0;
+};
+
+// Headless HAL host simulator.
+//
+// Plays the role of coreaudiod for a single device: initializes driver with
+// a fake host interface, attaches clients, and drives I/O cycles through the
+// driver interface, in the same order as HAL does:
+//
+//   StartIO
+//   GetZeroTimeStamp
+//   WillDoIOOperation
+//   BeginIOOperation
+//   DoIOOperation (for every stream)
+//   EndIOOperation
+//   ...
+//   StopIO
+//
+// Device configuration change requests are queued and performed between
+// cycles, as HAL does.
+//
+// If context clock is SimulatedClock, it is advanced by one buffer after each
+// cycle, which allows running cycles in fast-forward mode.
+//
+// Simulator measures wall clock latency of every cycle and counts allocations
+// made on the calling thread during cycles.
+class HostSimulator
+{
+public:
+    HostSimulator(std::shared_ptr<Driver> driver,
+        const HostSimulatorParameters& params = {});
+
+    HostSimulator(const HostSimulator&) = delete;
+    HostSimulator& operator=(const HostSimulator&) = delete;
+
+    ~HostSimulator();
+
+    // Get fake host passed to driver.
+    AudioServerPlugInHostRef GetHost() const;
+
+    // Invoke driver initialization with fake host.
+    OSStatus Initialize();
+
+    // Perform queued device configuration changes.
+    OSStatus ProcessConfigurationChanges();
+
+    // Query common properties of device, its streams and controls, like HAL
+    // does when device is published.
+    // If deviceID is kAudioObjectUnknown, first device of plugin is used.
+    OSStatus QueryProperties(AudioObjectID deviceID = kAudioObjectUnknown);
+
+    // Attach clients to device and start I/O.
+    // If deviceID is kAudioObjectUnknown, first device of plugin is used.
+    OSStatus Start(AudioObjectID deviceID = kAudioObjectUnknown);
+
+    // Stop I/O and detach clients.
+    OSStatus Stop();
+
+    // Run given number of I/O cycles.
+    // Should be called between Start() and Stop().
+    OSStatus RunCycles(UInt64 numCycles);
+
+    // Get statistics for all cycles since Start().
+    HostSimulatorReport GetReport() const;
+
+    // Get number of property change notifications sent by driver to host.
+    UInt64 GetNotificationCount() const;
+
+    // Get number of configuration change requests sent by driver to host.
+    UInt64 GetConfigurationRequestCount() const;
+
+private:
+    struct HostState
+    {
+        AudioServerPlugInHostInterface Interface;
+        HostSimulator* Simulator;
+    };
+
+    struct ConfigurationRequest
+    {
+        AudioObjectID DeviceID;
+        UInt64 ChangeAction;
+        void* ChangeInfo;
+    };
+
+    struct StreamState
+    {
+        AudioObjectID StreamID;
+        Direction Dir;
+        std::vector<UInt8> Buffer;
+    };
+
+    static HostSimulator* GetSimulator(AudioServerPlugInHostRef host);
+
+    static OSStatus PropertiesChanged(AudioServerPlugInHostRef host,
+        AudioObjectID objectID,
+        UInt32 numberAddresses,
+        const AudioObjectPropertyAddress* addresses);
+
+    static OSStatus CopyFromStorage(AudioServerPlugInHostRef host,
+        CFStringRef key,
+        CFPropertyListRef* outData);
+
+    static OSStatus WriteToStorage(AudioServerPlugInHostRef host,
+        CFStringRef key,
+        CFPropertyListRef data);
+
+    static OSStatus DeleteFromStorage(AudioServerPlugInHostRef host, CFStringRef key);
+
+    static OSStatus RequestDeviceConfigurationChange(AudioServerPlugInHostRef host,
+        AudioObjectID deviceObjectID,
+        UInt64 changeAction,
+        void* changeInfo);
+
+    OSStatus QueryProperty(AudioObjectID objectID,
+        AudioObjectPropertySelector selector,
+        bool isCFType);
+
+    // stop first numStarted clients and remove all clients
+    OSStatus StopClients(size_t numStarted);
+
+    OSStatus RunCycle();
+
+    OSStatus RunOperation(UInt32 operationID,
+        Direction dir,
+        bool perClient,
+        const AudioServerPlugInIOCycleInfo& cycleInfo);
+
+    const std::shared_ptr<Driver> driver_;
+    const HostSimulatorParameters params_;
+
+    HostState host_;
+
+    std::atomic<UInt64> notificationCount_ = 0;
+    std::atomic<UInt64> configRequestCount_ = 0;
+
+    std::mutex configMutex_;
+    std::vector<ConfigurationRequest> configRequests_;
+
+    std::shared_ptr<Device> device_;
+    std::vector<UInt32> clientIDs_;
+    std::vector<StreamState> streams_;
+
+    bool started_ = false;
+
+    Float64 sampleRate_ = 0;
+    Float64 sampleTime_ = 0;
+    UInt64 cycleCounter_ = 0;
+
+    HostSimulatorReport report_;
+    std::vector<UInt64> latencies_;
+};
+
+} // namespace aspl
@@ -0,0 +1,265 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+// I/O cycle benchmark.
+//
+// Creates driver with a single device with input and output streams, and
+// runs I/O cycles using host simulator. Reports cycle latency percentiles,
+// missed deadlines, and allocations.
+//
+// With --allocs, also queries common device properties and reports heap
+// allocations per operation and property selector.
+
+#include "AllocationTracer.hpp"
+#include "HostSimulator.hpp"
+#include "RealtimeChecker.hpp"
+
+#include <aspl/Clock.hpp>
+#include <aspl/Driver.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include <getopt.h>
+
+namespace {
+
+struct Options
+{
+    UInt32 NumClients = 1;
+    UInt32 BufferFrameSize = 512;
+    UInt32 SampleRate = 48000;
+    UInt32 ChannelCount = 2;
+    UInt32 NumStreams = 1;
+    UInt64 NumCycles = 100000;
+    UInt64 NumWarmupCycles = 1000;
+    bool RealtimePacing = false;
+    bool RealtimeChecks = false;
+    bool AllocationReport = false;
+};
+
+void PrintUsage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -c, --clients N    number of clients (default: 1)\n"
+        "  -b, --buffer N     buffer size in frames (default: 512)\n"
+        "  -r, --rate N       sample rate (default: 48000)\n"
+        "  -C, --channels N   number of channels per stream (default: 2)\n"
+        "  -s, --streams N    number of streams per direction (default: 1)\n"
+        "  -n, --cycles N     number of measured cycles (default: 100000)\n"
+        "  -w, --warmup N     number of warmup cycles (default: 1000)\n"
+        "  -R, --realtime     pace cycles by wall clock instead of fast-forward\n"
+        "  -x, --rtcheck      report non-realtime-safe calls during cycles\n"
+        "  -a, --allocs       report allocations per operation and property\n"
+        "  -h, --help         print this message\n",
+        name);
+}
+
+bool ParseOptions(int argc, char** argv, Options& opts)
+{
+    const struct option longOpts[] = {
+        {"clients", required_argument, nullptr, 'c'},
+        {"buffer", required_argument, nullptr, 'b'},
+        {"rate", required_argument, nullptr, 'r'},
+        {"channels", required_argument, nullptr, 'C'},
+        {"streams", required_argument, nullptr, 's'},
+        {"cycles", required_argument, nullptr, 'n'},
+        {"warmup", required_argument, nullptr, 'w'},
+        {"realtime", no_argument, nullptr, 'R'},
+        {"rtcheck", no_argument, nullptr, 'x'},
+        {"allocs", no_argument, nullptr, 'a'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    int ch;
+    while ((ch = getopt_long(argc, argv, "c:b:r:C:s:n:w:Rxah", longOpts, nullptr)) !=
+           -1) {
+        switch (ch) {
+        case 'c':
+            opts.NumClients = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'b':
+            opts.BufferFrameSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'r':
+            opts.SampleRate = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'C':
+            opts.ChannelCount = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 's':
+            opts.NumStreams = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'n':
+            opts.NumCycles = strtoull(optarg, nullptr, 10);
+            break;
+        case 'w':
+            opts.NumWarmupCycles = strtoull(optarg, nullptr, 10);
+            break;
+        case 'R':
+            opts.RealtimePacing = true;
+            break;
+        case 'x':
+            opts.RealtimeChecks = true;
+            break;
+        case 'a':
+            opts.AllocationReport = true;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    if (opts.NumClients == 0 || opts.BufferFrameSize == 0 || opts.SampleRate == 0 ||
+        opts.ChannelCount == 0) {
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<aspl::Driver> CreateDriver(const Options& opts,
+    std::shared_ptr<aspl::Tracer> tracer)
+{
+    std::shared_ptr<aspl::Clock> clock;
+
+    if (opts.RealtimePacing) {
+        clock = std::make_shared<aspl::DefaultClock>();
+    } else {
+        clock = std::make_shared<aspl::SimulatedClock>();
+    }
+
+    auto context = std::make_shared<aspl::Context>(tracer, nullptr, clock);
+
+    aspl::DeviceParameters deviceParams;
+    deviceParams.SampleRate = opts.SampleRate;
+    deviceParams.ChannelCount = opts.ChannelCount;
+    deviceParams.ZeroTimeStampPeriod = opts.BufferFrameSize;
+    deviceParams.EnableRealtimeChecks = opts.RealtimeChecks;
+    deviceParams.EnableRealtimeTracing = opts.AllocationReport;
+
+    auto device = std::make_shared<aspl::Device>(context, deviceParams);
+
+    for (UInt32 n = 0; n < opts.NumStreams; n++) {
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+    }
+
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+    plugin->AddDevice(device);
+
+    return std::make_shared<aspl::Driver>(context, plugin);
+}
+
+void PrintReport(const Options& opts, const aspl::HostSimulatorReport& report)
+{
+    printf("clients:            %u\n", unsigned(opts.NumClients));
+    printf("buffer:             %u frames\n", unsigned(opts.BufferFrameSize));
+    printf("rate:               %u Hz\n", unsigned(opts.SampleRate));
+    printf("streams:            %u in, %u out\n",
+        unsigned(opts.NumStreams),
+        unsigned(opts.NumStreams));
+    printf("cycles:             %llu\n", (unsigned long long)report.NumCycles);
+    printf("deadline:           %.3f us\n", report.DeadlineNs / 1000.0);
+    printf("latency min:        %.3f us\n", report.MinLatencyNs / 1000.0);
+    printf("latency avg:        %.3f us\n", report.AvgLatencyNs / 1000.0);
+    printf("latency p50:        %.3f us\n", report.P50LatencyNs / 1000.0);
+    printf("latency p90:        %.3f us\n", report.P90LatencyNs / 1000.0);
+    printf("latency p99:        %.3f us\n", report.P99LatencyNs / 1000.0);
+    printf("latency p99.9:      %.3f us\n", report.P999LatencyNs / 1000.0);
+    printf("latency max:        %.3f us\n", report.MaxLatencyNs / 1000.0);
+    printf("missed deadlines:   %llu\n", (unsigned long long)report.NumMissedDeadlines);
+    printf("failed calls:       %llu\n", (unsigned long long)report.NumFailedCalls);
+    printf("allocations:        %llu (%.3f per cycle)\n",
+        (unsigned long long)report.NumAllocations,
+        report.NumCycles ? double(report.NumAllocations) / report.NumCycles : 0.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    if (!ParseOptions(argc, argv, opts)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::shared_ptr<aspl::AllocationTracer> allocTracer;
+    std::shared_ptr<aspl::Tracer> tracer;
+
+    if (opts.AllocationReport) {
+        allocTracer = std::make_shared<aspl::AllocationTracer>();
+        tracer = allocTracer;
+    } else {
+        tracer = std::make_shared<aspl::Tracer>(aspl::Tracer::Mode::Noop);
+    }
+
+    auto driver = CreateDriver(opts, tracer);
+
+    aspl::HostSimulatorParameters simParams;
+    simParams.NumClients = opts.NumClients;
+    simParams.BufferFrameSize = opts.BufferFrameSize;
+    simParams.RealtimePacing = opts.RealtimePacing;
+
+    aspl::HostSimulator simulator(driver, simParams);
+
+    if (simulator.Initialize() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to initialize driver\n");
+        return 1;
+    }
+
+    if (opts.AllocationReport &&
+        simulator.QueryProperties() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to query properties\n");
+        return 1;
+    }
+
+    // Warmup cycles are not included into the report.
+    if (opts.NumWarmupCycles != 0) {
+        if (simulator.Start() != kAudioHardwareNoError) {
+            fprintf(stderr, "failed to start I/O\n");
+            return 1;
+        }
+        simulator.RunCycles(opts.NumWarmupCycles);
+        simulator.Stop();
+    }
+
+    if (simulator.Start() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to start I/O\n");
+        return 1;
+    }
+
+    if (opts.RealtimeChecks) {
+        aspl::RealtimeChecker::SetMode(aspl::RealtimeChecker::Mode::Count);
+    }
+
+    const OSStatus status = simulator.RunCycles(opts.NumCycles);
+
+    aspl::RealtimeChecker::SetMode(aspl::RealtimeChecker::Mode::Disabled);
+
+    const auto report = simulator.GetReport();
+
+    simulator.Stop();
+
+    PrintReport(opts, report);
+
+    if (opts.RealtimeChecks) {
+        aspl::RealtimeChecker::PrintReport(stdout);
+    }
+
+    if (allocTracer) {
+        allocTracer->PrintReport(stdout);
+    }
+
+    if (status != kAudioHardwareNoError) {
+        fprintf(stderr, "some driver calls failed\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+// Network sink and source benchmark.
+//
+// Sends samples through NetworkSink to NetworkSource on localhost, pacing
+// writes like I/O cycles. Reports packet throughput, batching efficiency,
+// and time spent on realtime thread per cycle. Then sends single packets
+// and measures loopback latency.
+
+#include <aspl/NetworkSink.hpp>
+#include <aspl/NetworkSource.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <getopt.h>
+
+namespace {
+
+struct Options
+{
+    UInt32 BufferFrameSize = 512;
+    UInt32 SampleRate = 48000;
+    UInt32 ChannelCount = 2;
+    UInt32 PayloadSize = 1024;
+    UInt32 QueueSize = 1024;
+    UInt32 BatchSize = 32;
+    UInt32 PollInterval = 1000;
+    UInt64 NumCycles = 20000;
+    UInt64 NumPings = 1000;
+    double Speed = 20;
+    bool EnableGSO = true;
+};
+
+void PrintUsage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -b, --buffer N     buffer size in frames (default: 512)\n"
+        "  -r, --rate N       sample rate (default: 48000)\n"
+        "  -C, --channels N   number of channels (default: 2)\n"
+        "  -p, --payload N    max packet payload in bytes (default: 1024)\n"
+        "  -q, --queue N      queue size in packets (default: 1024)\n"
+        "  -B, --batch N      max packets per send or recv call (default: 32)\n"
+        "  -P, --poll N       sender poll interval in microseconds (default: 1000)\n"
+        "  -n, --cycles N     number of cycles (default: 20000)\n"
+        "  -l, --pings N      number of latency measurements (default: 1000)\n"
+        "  -s, --speed X      run X times faster than realtime, 0 for no pacing "
+        "(default: 20)\n"
+        "  -G, --no-gso       disable UDP segmentation offload\n"
+        "  -h, --help         print this message\n",
+        name);
+}
+
+bool ParseOptions(int argc, char** argv, Options& opts)
+{
+    const struct option longOpts[] = {
+        {"buffer", required_argument, nullptr, 'b'},
+        {"rate", required_argument, nullptr, 'r'},
+        {"channels", required_argument, nullptr, 'C'},
+        {"payload", required_argument, nullptr, 'p'},
+        {"queue", required_argument, nullptr, 'q'},
+        {"batch", required_argument, nullptr, 'B'},
+        {"poll", required_argument, nullptr, 'P'},
+        {"cycles", required_argument, nullptr, 'n'},
+        {"pings", required_argument, nullptr, 'l'},
+        {"speed", required_argument, nullptr, 's'},
+        {"no-gso", no_argument, nullptr, 'G'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    int ch;
+    while ((ch = getopt_long(argc, argv, "b:r:C:p:q:B:P:n:l:s:Gh", longOpts, nullptr)) !=
+           -1) {
+        switch (ch) {
+        case 'b':
+            opts.BufferFrameSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'r':
+            opts.SampleRate = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'C':
+            opts.ChannelCount = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'p':
+            opts.PayloadSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'q':
+            opts.QueueSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'B':
+            opts.BatchSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'P':
+            opts.PollInterval = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'n':
+            opts.NumCycles = strtoull(optarg, nullptr, 10);
+            break;
+        case 'l':
+            opts.NumPings = strtoull(optarg, nullptr, 10);
+            break;
+        case 's':
+            opts.Speed = strtod(optarg, nullptr);
+            break;
+        case 'G':
+            opts.EnableGSO = false;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    if (opts.BufferFrameSize == 0 || opts.SampleRate == 0 || opts.ChannelCount == 0 ||
+        opts.PayloadSize == 0 || opts.Speed < 0) {
+        return false;
+    }
+
+    return true;
+}
+
+double Average(const std::vector<UInt64>& values)
+{
+    if (values.empty()) {
+        return 0;
+    }
+
+    UInt64 sum = 0;
+    for (auto v : values) {
+        sum += v;
+    }
+
+    return double(sum) / values.size();
+}
+
+UInt64 Percentile(const std::vector<UInt64>& sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+
+    return sorted[std::min(sorted.size() - 1, size_t(p * double(sorted.size())))];
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    if (!ParseOptions(argc, argv, opts)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    const UInt32 bytesPerFrame = opts.ChannelCount * UInt32(sizeof(Float32));
+
+    aspl::NetworkSourceParameters sourceParams;
+    sourceParams.Port = 0;
+    sourceParams.MaxPacketSize = aspl::NetworkSource::HeaderSize + opts.PayloadSize;
+    sourceParams.BatchSize = opts.BatchSize;
+    sourceParams.SocketBufferSize = 8 * 1024 * 1024;
+
+    aspl::NetworkSourceStreamParameters streamParams;
+    streamParams.Buffer.BytesPerFrame = bytesPerFrame;
+
+    aspl::NetworkSource source(sourceParams);
+
+    if (source.AddStream(streamParams) != kAudioHardwareNoError ||
+        source.Start() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to start source\n");
+        return 1;
+    }
+
+    aspl::NetworkSinkParameters sinkParams;
+    sinkParams.Port = source.GetPort();
+    sinkParams.BytesPerFrame = bytesPerFrame;
+    sinkParams.MaxPayloadSize = opts.PayloadSize;
+    sinkParams.QueueSize = opts.QueueSize;
+    sinkParams.BatchSize = opts.BatchSize;
+    sinkParams.PollInterval = opts.PollInterval;
+    sinkParams.EnableGSO = opts.EnableGSO;
+
+    aspl::NetworkSink sink(sinkParams);
+
+    if (sink.Start() != kAudioHardwareNoError) {
+        fprintf(stderr, "failed to start sink\n");
+        return 1;
+    }
+
+    const auto numReceived = [&source] {
+        return source.GetStats().NumRoutedPackets;
+    };
+
+    // Wait until source receives all packets that were sent.
+    const auto waitReceived = [&](UInt64 count) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (numReceived() < count && std::chrono::steady_clock::now() < deadline) {
+        }
+        return numReceived() >= count;
+    };
+
+    std::vector<Float32> samples(opts.BufferFrameSize * opts.ChannelCount, 0.5f);
+    std::vector<UInt64> cycleTimes(opts.NumCycles);
+
+    const auto cyclePeriod = opts.Speed > 0
+                                 ? std::chrono::nanoseconds(UInt64(
+                                       1e9 * opts.BufferFrameSize / opts.SampleRate /
+                                       opts.Speed))
+                                 : std::chrono::nanoseconds(0);
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto nextCycle = startTime;
+
+    for (UInt64 cycle = 0; cycle < opts.NumCycles; cycle++) {
+        const auto cycleStart = std::chrono::steady_clock::now();
+
+        sink.Write(cycle * opts.BufferFrameSize,
+            samples.data(),
+            UInt32(samples.size() * sizeof(Float32)));
+
+        const auto cycleEnd = std::chrono::steady_clock::now();
+
+        cycleTimes[cycle] = UInt64(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(cycleEnd - cycleStart)
+                .count());
+
+        if (cyclePeriod.count() != 0) {
+            nextCycle += cyclePeriod;
+            std::this_thread::sleep_until(nextCycle);
+        }
+    }
+
+    // Wait until sender and receiver drain queues. End time is the time
+    // when the last packet was received.
+    auto endTime = std::chrono::steady_clock::now();
+
+    for (UInt64 lastReceived = numReceived();;) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if (numReceived() != lastReceived) {
+            lastReceived = numReceived();
+            endTime = now;
+        } else if (now - endTime > std::chrono::milliseconds(300)) {
+            break;
+        }
+    }
+
+    const auto stats = sink.GetStats();
+    const UInt64 totalReceived = numReceived();
+
+    // Send packets one by one and measure time until they're routed
+    // to jitter buffer.
+    std::vector<UInt64> pingTimes;
+    pingTimes.reserve(opts.NumPings);
+
+    const UInt32 pingBytes =
+        std::min(opts.PayloadSize / bytesPerFrame, opts.BufferFrameSize) * bytesPerFrame;
+
+    for (UInt64 ping = 0; ping < opts.NumPings; ping++) {
+        const UInt64 expected = numReceived() + 1;
+        const auto pingStart = std::chrono::steady_clock::now();
+
+        sink.Write((opts.NumCycles + ping) * opts.BufferFrameSize,
+            samples.data(),
+            pingBytes);
+
+        if (!waitReceived(expected)) {
+            continue;
+        }
+
+        pingTimes.push_back(
+            UInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - pingStart)
+                       .count()));
+    }
+
+    sink.Stop();
+    source.Stop();
+
+    const auto sourceStats = source.GetStats();
+
+    const double elapsed = std::chrono::duration<double>(endTime - startTime).count();
+
+    std::sort(cycleTimes.begin(), cycleTimes.end());
+    std::sort(pingTimes.begin(), pingTimes.end());
+
+    printf("cycles:             %llu\n", (unsigned long long)opts.NumCycles);
+    printf("elapsed:            %.3f s\n", elapsed);
+    printf("packets queued:     %llu\n", (unsigned long long)stats.NumQueuedPackets);
+    printf("packets dropped:    %llu\n", (unsigned long long)stats.NumDroppedPackets);
+    printf("packets sent:       %llu\n", (unsigned long long)stats.NumSentPackets);
+    printf("packets failed:     %llu\n", (unsigned long long)stats.NumFailedPackets);
+    printf("packets received:   %llu\n", (unsigned long long)totalReceived);
+    printf("send calls:         %llu (%.2f packets per call)\n",
+        (unsigned long long)stats.NumSendCalls,
+        stats.NumSendCalls ? double(stats.NumSentPackets) / stats.NumSendCalls : 0.0);
+    printf("recv calls:         %llu (%.2f packets per call)\n",
+        (unsigned long long)sourceStats.NumRecvCalls,
+        sourceStats.NumRecvCalls
+            ? double(sourceStats.NumReceivedPackets) / sourceStats.NumRecvCalls
+            : 0.0);
+    printf("throughput:         %.0f packets/s\n",
+        elapsed > 0 ? double(totalReceived) / elapsed : 0.0);
+    printf("rt time avg:        %.3f us\n", Average(cycleTimes) / 1000.0);
+    printf("rt time p99:        %.3f us\n", Percentile(cycleTimes, 0.99) / 1000.0);
+    printf("rt time max:        %.3f us\n", Percentile(cycleTimes, 1) / 1000.0);
+    printf("latency avg:        %.3f us (%zu/%llu pings)\n",
+        Average(pingTimes) / 1000.0,
+        pingTimes.size(),
+        (unsigned long long)opts.NumPings);
+    printf("latency p99:        %.3f us\n", Percentile(pingTimes, 0.99) / 1000.0);
+    printf("latency max:        %.3f us\n", Percentile(pingTimes, 1) / 1000.0);
+
+    return 0;
+}
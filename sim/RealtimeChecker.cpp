@@ -0,0 +1,316 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "RealtimeChecker.hpp"
+
+#include <aspl/RealtimeScope.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <unistd.h>
+
+namespace aspl {
+
+namespace {
+
+constexpr int MaxFrames = 16;
+
+struct CallSite
+{
+    RealtimeChecker::Violation Violation;
+    void* Frames[MaxFrames];
+    int NumFrames;
+};
+
+// Checker state is accessed from inside malloc() hooks, so it consists only
+// of atomics and fixed-size arrays, and never allocates or locks.
+std::atomic<RealtimeChecker::Mode> checkerMode = RealtimeChecker::Mode::Disabled;
+
+std::atomic<UInt64> violationCounters[RealtimeChecker::NumViolations];
+
+CallSite callSites[RealtimeChecker::MaxCallSites];
+std::atomic<size_t> numCallSites = 0;
+
+void WriteString(int fd, const char* str)
+{
+    size_t len = 0;
+    while (str[len]) {
+        len++;
+    }
+    (void)write(fd, str, len);
+}
+
+void ReportViolation(RealtimeChecker::Violation violation)
+{
+    const RealtimeChecker::Mode mode = checkerMode;
+
+    if (mode == RealtimeChecker::Mode::Abort) {
+        // Disable checks to allow backtrace and abort to allocate.
+        checkerMode = RealtimeChecker::Mode::Disabled;
+
+        void* frames[MaxFrames];
+        const int numFrames = backtrace(frames, MaxFrames);
+
+        WriteString(STDERR_FILENO, "[aspl] realtime violation: ");
+        WriteString(STDERR_FILENO, RealtimeChecker::ViolationToString(violation));
+        WriteString(STDERR_FILENO, " called on realtime thread\n");
+
+        backtrace_symbols_fd(frames, numFrames, STDERR_FILENO);
+
+        abort();
+    }
+
+    violationCounters[size_t(violation)]++;
+
+    const size_t siteIdx = numCallSites++;
+
+    if (siteIdx < RealtimeChecker::MaxCallSites) {
+        CallSite& site = callSites[siteIdx];
+
+        site.Violation = violation;
+        site.NumFrames = backtrace(site.Frames, MaxFrames);
+    }
+}
+
+void CheckCall(RealtimeChecker::Violation violation)
+{
+    if (checkerMode.load(std::memory_order_relaxed) == RealtimeChecker::Mode::Disabled) {
+        return;
+    }
+
+    if (!RealtimeScope::IsRealtimeThread()) {
+        return;
+    }
+
+    ReportViolation(violation);
+}
+
+} // namespace
+
+void RealtimeChecker::SetMode(Mode mode)
+{
+    if (mode != Mode::Disabled) {
+        // First call to backtrace() may load libraries and allocate,
+        // so make it before enabling checks.
+        void* frames[1];
+        backtrace(frames, 1);
+    }
+
+    checkerMode = mode;
+}
+
+RealtimeChecker::Mode RealtimeChecker::GetMode()
+{
+    return checkerMode;
+}
+
+bool RealtimeChecker::IsSupported()
+{
+#if defined(__APPLE__) || defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+UInt64 RealtimeChecker::GetViolationCount()
+{
+    UInt64 count = 0;
+
+    for (size_t n = 0; n < NumViolations; n++) {
+        count += violationCounters[n];
+    }
+
+    return count;
+}
+
+UInt64 RealtimeChecker::GetViolationCount(Violation violation)
+{
+    return violationCounters[size_t(violation)];
+}
+
+void RealtimeChecker::Reset()
+{
+    for (size_t n = 0; n < NumViolations; n++) {
+        violationCounters[n] = 0;
+    }
+
+    numCallSites = 0;
+}
+
+void RealtimeChecker::PrintReport(FILE* fp)
+{
+    fprintf(fp, "realtime violations: %llu\n", (unsigned long long)GetViolationCount());
+
+    for (size_t n = 0; n < NumViolations; n++) {
+        if (violationCounters[n] != 0) {
+            fprintf(fp,
+                "  %s: %llu\n",
+                ViolationToString(Violation(n)),
+                (unsigned long long)violationCounters[n]);
+        }
+    }
+
+    const size_t numSites = std::min<size_t>(numCallSites, MaxCallSites);
+
+    for (size_t n = 0; n < numSites; n++) {
+        const CallSite& site = callSites[n];
+
+        fprintf(fp, "violation #%zu: %s\n", n + 1, ViolationToString(site.Violation));
+        fflush(fp);
+
+        // Skip frames of the checker itself.
+        const int skipFrames = std::min(site.NumFrames, 3);
+
+        backtrace_symbols_fd(
+            site.Frames + skipFrames, site.NumFrames - skipFrames, fileno(fp));
+    }
+
+    fflush(fp);
+}
+
+const char* RealtimeChecker::ViolationToString(Violation violation)
+{
+    switch (violation) {
+    case Violation::Malloc:
+        return "malloc";
+    case Violation::Calloc:
+        return "calloc";
+    case Violation::Realloc:
+        return "realloc";
+    case Violation::Free:
+        return "free";
+    case Violation::MutexLock:
+        return "pthread_mutex_lock";
+    }
+
+    return "unknown";
+}
+
+} // namespace aspl
+
+#if defined(__APPLE__)
+
+// On macOS, functions are replaced using dyld interposing. Calls made from
+// this image itself are not interposed, so hooks can call original functions
+// directly.
+
+namespace {
+
+struct Interpose
+{
+    const void* Replacement;
+    const void* Replacee;
+};
+
+void* CheckedMalloc(size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Malloc);
+    return malloc(size);
+}
+
+void* CheckedCalloc(size_t count, size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Calloc);
+    return calloc(count, size);
+}
+
+void* CheckedRealloc(void* ptr, size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Realloc);
+    return realloc(ptr, size);
+}
+
+void CheckedFree(void* ptr)
+{
+    if (ptr) {
+        aspl::CheckCall(aspl::RealtimeChecker::Violation::Free);
+    }
+    free(ptr);
+}
+
+int CheckedMutexLock(pthread_mutex_t* mutex)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::MutexLock);
+    return pthread_mutex_lock(mutex);
+}
+
+__attribute__((used)) const Interpose interposers[]
+    __attribute__((section("__DATA,__interpose"))) = {
+        {reinterpret_cast<const void*>(&CheckedMalloc),
+            reinterpret_cast<const void*>(&malloc)},
+        {reinterpret_cast<const void*>(&CheckedCalloc),
+            reinterpret_cast<const void*>(&calloc)},
+        {reinterpret_cast<const void*>(&CheckedRealloc),
+            reinterpret_cast<const void*>(&realloc)},
+        {reinterpret_cast<const void*>(&CheckedFree),
+            reinterpret_cast<const void*>(&free)},
+        {reinterpret_cast<const void*>(&CheckedMutexLock),
+            reinterpret_cast<const void*>(&pthread_mutex_lock)},
+};
+
+} // namespace
+
+#elif defined(__GLIBC__)
+
+// On Linux, functions are replaced by defining them in the executable, which
+// takes precedence over shared libraries during symbol lookup. Hooks forward
+// calls to glibc internal entry points.
+
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Malloc);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Calloc);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::Realloc);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr)
+{
+    if (ptr) {
+        aspl::CheckCall(aspl::RealtimeChecker::Violation::Free);
+    }
+    __libc_free(ptr);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    using LockFunc = int (*)(pthread_mutex_t*);
+
+    static std::atomic<LockFunc> realLock = nullptr;
+
+    LockFunc lockFunc = realLock.load(std::memory_order_relaxed);
+    if (!lockFunc) {
+        lockFunc = reinterpret_cast<LockFunc>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+        realLock = lockFunc;
+    }
+
+    aspl::CheckCall(aspl::RealtimeChecker::Violation::MutexLock);
+    return lockFunc(mutex);
+}
+
+} // extern "C"
+
+#endif
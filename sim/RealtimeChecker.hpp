@@ -0,0 +1,77 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <cstdio>
+
+namespace aspl {
+
+// Realtime-safety checker.
+//
+// Interposes malloc(), calloc(), realloc(), free(), and pthread_mutex_lock(),
+// and detects when they're called from a thread that is marked as realtime
+// by RealtimeScope. Device marks I/O threads as realtime when
+// DeviceParameters::EnableRealtimeChecks is set.
+//
+// On Linux, functions are interposed by defining them in the executable and
+// forwarding to glibc. On macOS, dyld interposing is used.
+//
+// Checker is process-wide and is disabled by default.
+class RealtimeChecker
+{
+public:
+    // What to do on violation.
+    enum class Mode
+    {
+        // Don't check anything.
+        Disabled,
+
+        // Count violations and remember their call sites.
+        Count,
+
+        // Print violation and backtrace to stderr and abort.
+        Abort,
+    };
+
+    // Violation type.
+    enum class Violation
+    {
+        Malloc,
+        Calloc,
+        Realloc,
+        Free,
+        MutexLock,
+    };
+
+    static constexpr size_t NumViolations = 5;
+    static constexpr size_t MaxCallSites = 64;
+
+    // Set checker mode.
+    static void SetMode(Mode mode);
+
+    // Get checker mode.
+    static Mode GetMode();
+
+    // Check if interposing is supported on this platform.
+    static bool IsSupported();
+
+    // Get total number of violations.
+    static UInt64 GetViolationCount();
+
+    // Get number of violations of given type.
+    static UInt64 GetViolationCount(Violation violation);
+
+    // Reset counters and remembered call sites.
+    static void Reset();
+
+    // Print violation counters and remembered call sites.
+    static void PrintReport(FILE* fp);
+
+    // Get violation name.
+    static const char* ViolationToString(Violation violation);
+};
+
+} // namespace aspl
@@ -0,0 +1,341 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+// Shared memory ring benchmark.
+//
+// Forks a reader process, then writes samples through SharedRingWriter,
+// pacing writes like I/O cycles. Writer embeds the write time into every
+// cycle, and reader measures how much time passes until it reads it.
+// Reports latency, throughput, lost frames, and time spent on realtime
+// thread per cycle.
+
+#include <aspl/SharedRingReader.hpp>
+#include <aspl/SharedRingWriter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <getopt.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+struct Options
+{
+    UInt32 BufferFrameSize = 512;
+    UInt32 SampleRate = 48000;
+    UInt32 ChannelCount = 2;
+    UInt32 Capacity = 16384;
+    UInt64 NumCycles = 20000;
+    double Speed = 20;
+    UInt32 NotifyInterval = 1000;
+    std::string Name = "/aspl-shmbench";
+};
+
+void PrintUsage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -b, --buffer N     buffer size in frames (default: 512)\n"
+        "  -r, --rate N       sample rate (default: 48000)\n"
+        "  -C, --channels N   number of channels (default: 2)\n"
+        "  -c, --capacity N   ring size in frames (default: 16384)\n"
+        "  -n, --cycles N     number of cycles (default: 20000)\n"
+        "  -s, --speed X      run X times faster than realtime, 0 for no pacing "
+        "(default: 20)\n"
+        "  -w, --notify N     reader wakeup interval in microseconds (default: 1000)\n"
+        "  -N, --name NAME    shared memory object name (default: /aspl-shmbench)\n"
+        "  -h, --help         print this message\n",
+        name);
+}
+
+bool ParseOptions(int argc, char** argv, Options& opts)
+{
+    const struct option longOpts[] = {
+        {"buffer", required_argument, nullptr, 'b'},
+        {"rate", required_argument, nullptr, 'r'},
+        {"channels", required_argument, nullptr, 'C'},
+        {"capacity", required_argument, nullptr, 'c'},
+        {"cycles", required_argument, nullptr, 'n'},
+        {"speed", required_argument, nullptr, 's'},
+        {"notify", required_argument, nullptr, 'w'},
+        {"name", required_argument, nullptr, 'N'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    int ch;
+    while ((ch = getopt_long(argc, argv, "b:r:C:c:n:s:w:N:h", longOpts, nullptr)) != -1) {
+        switch (ch) {
+        case 'b':
+            opts.BufferFrameSize = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'r':
+            opts.SampleRate = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'C':
+            opts.ChannelCount = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'c':
+            opts.Capacity = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'n':
+            opts.NumCycles = strtoull(optarg, nullptr, 10);
+            break;
+        case 's':
+            opts.Speed = strtod(optarg, nullptr);
+            break;
+        case 'w':
+            opts.NotifyInterval = UInt32(strtoul(optarg, nullptr, 10));
+            break;
+        case 'N':
+            opts.Name = optarg;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    // Every cycle should have room for a timestamp.
+    if (opts.BufferFrameSize < 2 || opts.SampleRate == 0 || opts.ChannelCount == 0 ||
+        opts.Capacity < opts.BufferFrameSize || opts.Speed < 0) {
+        return false;
+    }
+
+    return true;
+}
+
+UInt64 Now()
+{
+    return UInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+                      .count());
+}
+
+double Average(const std::vector<UInt64>& values)
+{
+    if (values.empty()) {
+        return 0;
+    }
+
+    UInt64 sum = 0;
+    for (auto v : values) {
+        sum += v;
+    }
+
+    return double(sum) / values.size();
+}
+
+UInt64 Percentile(const std::vector<UInt64>& sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+
+    return sorted[std::min(sorted.size() - 1, size_t(p * double(sorted.size())))];
+}
+
+int RunReader(const Options& opts, int readyFd)
+{
+    aspl::SharedRingReader reader(opts.Name);
+
+    const OSStatus status = reader.Open();
+
+    // Tell writer that we're ready (or failed).
+    const char ready = status == kAudioHardwareNoError ? 1 : 0;
+    if (write(readyFd, &ready, 1) != 1 || !ready) {
+        fprintf(stderr, "reader: failed to open ring\n");
+        return 1;
+    }
+    close(readyFd);
+
+    const UInt32 bytesPerFrame = reader.GetFormat().mBytesPerFrame;
+
+    // Read whole cycles at once.
+    const UInt32 bufferFrames = opts.Capacity / opts.BufferFrameSize * opts.BufferFrameSize;
+
+    std::vector<UInt8> buffer(size_t(bufferFrames) * bytesPerFrame);
+
+    std::vector<UInt64> latencies;
+    latencies.reserve(opts.NumCycles);
+
+    UInt64 numWakeups = 0;
+    UInt64 firstTime = 0;
+    UInt64 lastTime = 0;
+
+    for (;;) {
+        if (!reader.Wait(100000)) {
+            if (!reader.IsWriterActive() && reader.GetAvailableFrames() == 0) {
+                break;
+            }
+            continue;
+        }
+
+        numWakeups++;
+
+        UInt64 sampleTime = 0;
+        UInt32 frameCount;
+
+        while ((frameCount = reader.Read(
+                    buffer.data(), UInt32(buffer.size()), sampleTime)) != 0) {
+            const UInt64 readTime = Now();
+
+            if (firstTime == 0) {
+                firstTime = readTime;
+            }
+            lastTime = readTime;
+
+            // Find beginnings of cycles and extract write times.
+            for (UInt32 n = 0; n + 2 <= frameCount; n++) {
+                if ((sampleTime + n) % opts.BufferFrameSize != 0) {
+                    continue;
+                }
+
+                UInt64 writeTime;
+                memcpy(&writeTime, &buffer[size_t(n) * bytesPerFrame], sizeof(writeTime));
+
+                latencies.push_back(readTime - writeTime);
+            }
+        }
+    }
+
+    const auto stats = reader.GetStats();
+
+    const double elapsed = double(lastTime - firstTime) / 1e9;
+
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("reader frames:      %llu\n", (unsigned long long)stats.NumReadFrames);
+    printf("reader lost frames: %llu\n", (unsigned long long)stats.NumLostFrames);
+    printf("reader wakeups:     %llu\n", (unsigned long long)numWakeups);
+    printf("throughput:         %.0f frames/s (%.1f MB/s)\n",
+        elapsed > 0 ? double(stats.NumReadFrames) / elapsed : 0.0,
+        elapsed > 0 ? double(stats.NumReadFrames) * bytesPerFrame / elapsed / 1e6
+                    : 0.0);
+    printf("latency avg:        %.3f us (%zu cycles)\n",
+        Average(latencies) / 1000.0,
+        latencies.size());
+    printf("latency p99:        %.3f us\n", Percentile(latencies, 0.99) / 1000.0);
+    printf("latency max:        %.3f us\n", Percentile(latencies, 1) / 1000.0);
+
+    fflush(stdout);
+
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    if (!ParseOptions(argc, argv, opts)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    const UInt32 bytesPerFrame = opts.ChannelCount * UInt32(sizeof(Float32));
+
+    aspl::SharedRingParameters params;
+    params.Name = opts.Name;
+    params.Capacity = opts.Capacity;
+    params.NotifyInterval = opts.NotifyInterval;
+    params.Format.mSampleRate = opts.SampleRate;
+    params.Format.mFormatFlags = kAudioFormatFlagIsFloat | kAudioFormatFlagsNativeEndian |
+                                 kAudioFormatFlagIsPacked;
+    params.Format.mBitsPerChannel = 32;
+    params.Format.mChannelsPerFrame = opts.ChannelCount;
+    params.Format.mBytesPerFrame = bytesPerFrame;
+    params.Format.mBytesPerPacket = bytesPerFrame;
+
+    aspl::SharedRingWriter writer(params);
+
+    if (writer.Open() != kAudioHardwareNoError) {
+        fprintf(stderr, "writer: failed to open ring\n");
+        return 1;
+    }
+
+    int readyPipe[2];
+    if (pipe(readyPipe) != 0) {
+        fprintf(stderr, "failed to create pipe\n");
+        return 1;
+    }
+
+    fflush(stdout);
+
+    const pid_t pid = fork();
+    if (pid == -1) {
+        fprintf(stderr, "failed to fork\n");
+        return 1;
+    }
+
+    if (pid == 0) {
+        close(readyPipe[0]);
+        _exit(RunReader(opts, readyPipe[1]));
+    }
+
+    close(readyPipe[1]);
+
+    char ready = 0;
+    if (read(readyPipe[0], &ready, 1) != 1 || !ready) {
+        waitpid(pid, nullptr, 0);
+        return 1;
+    }
+    close(readyPipe[0]);
+
+    std::vector<UInt8> samples(size_t(opts.BufferFrameSize) * bytesPerFrame);
+    std::vector<UInt64> cycleTimes(opts.NumCycles);
+
+    const auto cyclePeriod = opts.Speed > 0
+                                 ? std::chrono::nanoseconds(UInt64(
+                                       1e9 * opts.BufferFrameSize / opts.SampleRate /
+                                       opts.Speed))
+                                 : std::chrono::nanoseconds(0);
+
+    auto nextCycle = std::chrono::steady_clock::now();
+
+    for (UInt64 cycle = 0; cycle < opts.NumCycles; cycle++) {
+        const UInt64 cycleStart = Now();
+
+        // Embed write time into the first frames of the cycle.
+        memcpy(samples.data(), &cycleStart, sizeof(cycleStart));
+
+        writer.Write(
+            cycle * opts.BufferFrameSize, samples.data(), UInt32(samples.size()));
+
+        cycleTimes[cycle] = Now() - cycleStart;
+
+        if (cyclePeriod.count() != 0) {
+            nextCycle += cyclePeriod;
+            std::this_thread::sleep_until(nextCycle);
+        }
+    }
+
+    // Let reader catch up before closing the ring.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto stats = writer.GetStats();
+
+    writer.Close();
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    std::sort(cycleTimes.begin(), cycleTimes.end());
+
+    printf("cycles:             %llu\n", (unsigned long long)opts.NumCycles);
+    printf("writer frames:      %llu\n", (unsigned long long)stats.NumWrittenFrames);
+    printf("writer wakeups:     %llu\n", (unsigned long long)stats.NumNotifications);
+    printf("rt time avg:        %.3f us\n", Average(cycleTimes) / 1000.0);
+    printf("rt time p99:        %.3f us\n", Percentile(cycleTimes, 0.99) / 1000.0);
+    printf("rt time max:        %.3f us\n", Percentile(cycleTimes, 1) / 1000.0);
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
@@ -0,0 +1,289 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/AsyncTracer.hpp>
+
+#include "ThreadID.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <syslog.h>
+#include <unistd.h>
+
+namespace aspl {
+
+namespace {
+
+// Big enough for any prefix and drop report.
+constexpr UInt32 MinMessageLen = 64;
+
+UInt64 RoundUpToPowerOfTwo(UInt64 value)
+{
+    UInt64 result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+struct AsyncTracer::Batch
+{
+    std::vector<iovec> Vectors;
+};
+
+AsyncTracer::AsyncTracer(const AsyncTracerParameters& params)
+    : Tracer(params.Mode, params.Style)
+    , params_(params)
+    , queueMask_(RoundUpToPowerOfTwo(std::max(params.QueueSize, 1u)) - 1)
+    , messageLen_(std::max(params.MaxMessageLen, MinMessageLen))
+    , batch_(std::make_unique<Batch>())
+{
+    const UInt64 queueSize = queueMask_ + 1;
+
+    cells_.reset(new Cell[queueSize]);
+    for (UInt64 n = 0; n < queueSize; n++) {
+        cells_[n].Sequence.store(n, std::memory_order_relaxed);
+    }
+
+    data_.resize(size_t(queueSize) * messageLen_);
+
+    batch_->Vectors.resize(std::clamp<UInt32>(params_.BatchSize, 1u, IOV_MAX));
+
+    thread_ = std::thread(&AsyncTracer::WriterLoop, this);
+}
+
+AsyncTracer::~AsyncTracer()
+{
+    stopRequested_.store(true, std::memory_order_release);
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+const AsyncTracerParameters& AsyncTracer::GetParameters() const
+{
+    return params_;
+}
+
+void AsyncTracer::Flush()
+{
+    const UInt64 writeIndex = writeIndex_.load(std::memory_order_acquire);
+
+    while (readIndex_.load(std::memory_order_acquire) < writeIndex) {
+        usleep(std::min(params_.PollInterval, 1000u));
+    }
+}
+
+AsyncTracerStats AsyncTracer::GetStats() const
+{
+    AsyncTracerStats stats;
+
+    stats.NumQueuedMessages = numQueuedMessages_.load(std::memory_order_relaxed);
+    stats.NumDroppedMessages = numDroppedMessages_.load(std::memory_order_relaxed);
+    stats.NumWrittenMessages = numWrittenMessages_.load(std::memory_order_relaxed);
+    stats.NumWriteCalls = numWriteCalls_.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void AsyncTracer::Print(const char* message)
+{
+    if (params_.Mode != Mode::Stderr && params_.Mode != Mode::Syslog) {
+        return;
+    }
+
+    // Claim a free cell. Cell is free when its sequence equals to the index
+    // we're claiming; if it's behind, the queue is full.
+    UInt64 index = writeIndex_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+
+    for (;;) {
+        cell = &cells_[index & queueMask_];
+
+        const UInt64 sequence = cell->Sequence.load(std::memory_order_acquire);
+        const SInt64 diff = SInt64(sequence) - SInt64(index);
+
+        if (diff == 0) {
+            if (writeIndex_.compare_exchange_weak(
+                    index, index + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            numDroppedMessages_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            index = writeIndex_.load(std::memory_order_relaxed);
+        }
+    }
+
+    char* data = GetData(index);
+    int size = 0;
+
+    if (params_.Mode == Mode::Stderr) {
+        size = snprintf(data, messageLen_, "[aspl] %s\n", message);
+    } else {
+        size = snprintf(data, messageLen_, "[aspl] [tid:%lu] %s", GetThreadID(), message);
+    }
+
+    size = std::clamp(size, 0, int(messageLen_) - 1);
+
+    // keep line terminator if message was truncated
+    if (params_.Mode == Mode::Stderr && size > 0) {
+        data[size - 1] = '\n';
+    }
+
+    cell->Size = UInt32(size);
+
+    // Publish cell to writer thread.
+    cell->Sequence.store(index + 1, std::memory_order_release);
+
+    numQueuedMessages_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncTracer::WriterLoop()
+{
+    const UInt32 batchSize = UInt32(batch_->Vectors.size());
+
+    for (;;) {
+        // Check stop flag before reading the queue, so that after we see
+        // the flag, we also see all messages enqueued before it.
+        const bool stopRequested = stopRequested_.load(std::memory_order_acquire);
+
+        const UInt64 readIndex = readIndex_.load(std::memory_order_relaxed);
+
+        // Count consecutive published cells.
+        UInt32 numMessages = 0;
+        while (numMessages < batchSize) {
+            const Cell& cell = cells_[(readIndex + numMessages) & queueMask_];
+            if (cell.Sequence.load(std::memory_order_acquire) !=
+                readIndex + numMessages + 1) {
+                break;
+            }
+            numMessages++;
+        }
+
+        if (numMessages != 0) {
+            WriteBatch(readIndex, numMessages);
+
+            // Release cells to producers.
+            for (UInt32 n = 0; n < numMessages; n++) {
+                const UInt64 index = readIndex + n;
+                cells_[index & queueMask_].Sequence.store(
+                    index + queueMask_ + 1, std::memory_order_release);
+            }
+
+            readIndex_.store(readIndex + numMessages, std::memory_order_release);
+        }
+
+        const UInt64 numDropped = numDroppedMessages_.load(std::memory_order_relaxed);
+        if (numDropped != numReportedDrops_) {
+            WriteDropReport(numDropped - numReportedDrops_);
+            numReportedDrops_ = numDropped;
+        }
+
+        if (numMessages == 0) {
+            if (stopRequested) {
+                break;
+            }
+            usleep(params_.PollInterval);
+        }
+    }
+}
+
+void AsyncTracer::WriteBatch(UInt64 firstMessage, UInt32 numMessages)
+{
+    if (params_.Mode == Mode::Syslog) {
+        for (UInt32 n = 0; n < numMessages; n++) {
+            const UInt64 index = firstMessage + n;
+            const Cell& cell = cells_[index & queueMask_];
+
+            syslog(LOG_NOTICE, "%.*s", int(cell.Size), GetData(index));
+        }
+
+        numWriteCalls_.fetch_add(numMessages, std::memory_order_relaxed);
+        numWrittenMessages_.fetch_add(numMessages, std::memory_order_relaxed);
+
+        return;
+    }
+
+    auto& vectors = batch_->Vectors;
+
+    for (UInt32 n = 0; n < numMessages; n++) {
+        const UInt64 index = firstMessage + n;
+
+        vectors[n].iov_base = GetData(index);
+        vectors[n].iov_len = cells_[index & queueMask_].Size;
+    }
+
+    // Write all vectors, resuming after partial writes.
+    iovec* vec = vectors.data();
+    int vecCount = int(numMessages);
+
+    while (vecCount > 0) {
+        const ssize_t ret = writev(params_.FileDescriptor, vec, vecCount);
+
+        numWriteCalls_.fetch_add(1, std::memory_order_relaxed);
+
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        size_t written = size_t(ret);
+
+        while (vecCount > 0 && written >= vec->iov_len) {
+            written -= vec->iov_len;
+            vec++;
+            vecCount--;
+        }
+
+        if (vecCount > 0) {
+            vec->iov_base = static_cast<char*>(vec->iov_base) + written;
+            vec->iov_len -= written;
+        }
+    }
+
+    numWrittenMessages_.fetch_add(numMessages, std::memory_order_relaxed);
+}
+
+void AsyncTracer::WriteDropReport(UInt64 numDropped)
+{
+    char message[MinMessageLen] = {};
+
+    if (params_.Mode == Mode::Syslog) {
+        snprintf(message,
+            sizeof(message),
+            "[aspl] dropped %llu messages",
+            (unsigned long long)numDropped);
+
+        syslog(LOG_NOTICE, "%s", message);
+    } else {
+        const int size = snprintf(message,
+            sizeof(message),
+            "[aspl] dropped %llu messages\n",
+            (unsigned long long)numDropped);
+
+        const ssize_t ret =
+            write(params_.FileDescriptor, message, size_t(std::max(size, 0)));
+        (void)ret;
+    }
+
+    numWriteCalls_.fetch_add(1, std::memory_order_relaxed);
+}
+
+char* AsyncTracer::GetData(UInt64 message)
+{
+    return &data_[size_t(message & queueMask_) * messageLen_];
+}
+
+} // namespace aspl
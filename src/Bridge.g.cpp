@@ -2,15 +2,16 @@
 
 // Generator: generate-bridge.py
 // Source: Bridge.json
-// Timestamp: Sun Apr 13 14:12:49 2025 UTC
+// Timestamp: Mon Oct 19 07:56:38 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
 
 #include <aspl/Driver.hpp>
-#include <aspl/Tracer.hpp>
 
 #include "Bridge.hpp"
+#include "RunningDevices.hpp"
+#include "Tracing.hpp"
 
 namespace aspl {
 
@@ -28,7 +29,7 @@ Boolean Bridge::HasProperty(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::HasProperty() objectID=%u object not registered",
              unsigned(objectID));
         goto end;
@@ -58,7 +59,7 @@ OSStatus Bridge::IsPropertySettable(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::IsPropertySettable() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -92,7 +93,7 @@ OSStatus Bridge::GetPropertyDataSize(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::GetPropertyDataSize() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -130,7 +131,7 @@ OSStatus Bridge::GetPropertyData(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::GetPropertyData() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -169,7 +170,7 @@ OSStatus Bridge::SetPropertyData(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::SetPropertyData() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -202,7 +203,7 @@ OSStatus Bridge::AddClient(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::AddClient() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -230,7 +231,7 @@ OSStatus Bridge::RemoveClient(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::RemoveClient() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -258,7 +259,7 @@ OSStatus Bridge::StartIO(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::StartIO() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -269,6 +270,11 @@ OSStatus Bridge::StartIO(AudioServerPlugInDriverRef driverRef,
         objectID,
         clientID);
 
+    if (result == kAudioHardwareNoError) {
+        driver->runningDevices_->Pin(
+            objectID, std::static_pointer_cast<Device>(object));
+    }
+
 end:
     return result;
 }
@@ -286,7 +292,7 @@ OSStatus Bridge::StopIO(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::StopIO() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -297,6 +303,10 @@ OSStatus Bridge::StopIO(AudioServerPlugInDriverRef driverRef,
         objectID,
         clientID);
 
+    if (result == kAudioHardwareNoError) {
+        driver->runningDevices_->Unpin(objectID);
+    }
+
 end:
     return result;
 }
@@ -313,11 +323,21 @@ OSStatus Bridge::GetZeroTimeStamp(AudioServerPlugInDriverRef driverRef,
         return kAudioHardwareUnspecifiedError;
     }
 
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+        return device->GetZeroTimeStamp(
+            objectID,
+            clientID,
+            outSampleTime,
+            outHostTime,
+            outSeed);
+    }
+
     OSStatus result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::GetZeroTimeStamp() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -347,11 +367,21 @@ OSStatus Bridge::WillDoIOOperation(AudioServerPlugInDriverRef driverRef,
         return kAudioHardwareUnspecifiedError;
     }
 
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+        return device->WillDoIOOperation(
+            objectID,
+            clientID,
+            operationID,
+            outWillDo,
+            outWillDoInPlace);
+    }
+
     OSStatus result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::WillDoIOOperation() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -381,11 +411,21 @@ OSStatus Bridge::BeginIOOperation(AudioServerPlugInDriverRef driverRef,
         return kAudioHardwareUnspecifiedError;
     }
 
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+        return device->BeginIOOperation(
+            objectID,
+            clientID,
+            operationID,
+            ioBufferFrameSize,
+            ioCycleInfo);
+    }
+
     OSStatus result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::BeginIOOperation() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -418,11 +458,24 @@ OSStatus Bridge::DoIOOperation(AudioServerPlugInDriverRef driverRef,
         return kAudioHardwareUnspecifiedError;
     }
 
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+        return device->DoIOOperation(
+            objectID,
+            streamID,
+            clientID,
+            operationID,
+            ioBufferFrameSize,
+            ioCycleInfo,
+            ioMainBuffer,
+            ioSecondaryBuffer);
+    }
+
     OSStatus result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::DoIOOperation() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -455,11 +508,21 @@ OSStatus Bridge::EndIOOperation(AudioServerPlugInDriverRef driverRef,
         return kAudioHardwareUnspecifiedError;
     }
 
+    // fast path: device with running I/O, no lookup in dispatcher
+    if (const auto device = driver->runningDevices_->Find(objectID)) {
+        return device->EndIOOperation(
+            objectID,
+            clientID,
+            operationID,
+            ioBufferFrameSize,
+            ioCycleInfo);
+    }
+
     OSStatus result = {};
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::EndIOOperation() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -491,7 +554,7 @@ OSStatus Bridge::PerformConfigurationChange(AudioServerPlugInDriverRef driverRef
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::PerformConfigurationChange() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
@@ -521,7 +584,7 @@ OSStatus Bridge::AbortConfigurationChange(AudioServerPlugInDriverRef driverRef,
 
     const auto object = driver->GetContext()->Dispatcher->FindObject(objectID);
     if (!object) {
-        driver->GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
             "Bridge::AbortConfigurationChange() objectID=%u object not registered",
              unsigned(objectID));
         result = kAudioHardwareBadObjectError;
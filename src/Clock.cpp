@@ -0,0 +1,81 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/Clock.hpp>
+
+#include <time.h>
+
+#if defined(__APPLE__)
+#include <mach/mach_time.h>
+#endif
+
+namespace aspl {
+
+#if defined(__APPLE__)
+
+MachClock::MachClock()
+{
+    struct mach_timebase_info timeBase;
+    mach_timebase_info(&timeBase);
+
+    frequency_ = Float64(timeBase.denom) / timeBase.numer;
+    frequency_ *= 1000000000.0;
+}
+
+UInt64 MachClock::GetHostTime() const
+{
+    return mach_absolute_time();
+}
+
+Float64 MachClock::GetHostClockFrequency() const
+{
+    return frequency_;
+}
+
+#endif
+
+UInt64 MonotonicClock::GetHostTime() const
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return UInt64(ts.tv_sec) * 1000000000ull + UInt64(ts.tv_nsec);
+}
+
+Float64 MonotonicClock::GetHostClockFrequency() const
+{
+    return 1000000000.0;
+}
+
+SimulatedClock::SimulatedClock(Float64 frequency, UInt64 initialTime)
+    : frequency_(frequency)
+    , hostTime_(initialTime)
+{
+}
+
+UInt64 SimulatedClock::GetHostTime() const
+{
+    return hostTime_;
+}
+
+Float64 SimulatedClock::GetHostClockFrequency() const
+{
+    return frequency_;
+}
+
+void SimulatedClock::SetHostTime(UInt64 hostTime)
+{
+    hostTime_ = hostTime;
+}
+
+void SimulatedClock::AdvanceHostTime(UInt64 ticks)
+{
+    hostTime_ += ticks;
+}
+
+void SimulatedClock::AdvanceFrames(Float64 frames, Float64 sampleRate)
+{
+    hostTime_ += UInt64(frames * frequency_ / sampleRate);
+}
+
+} // namespace aspl
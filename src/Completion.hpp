@@ -0,0 +1,62 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <future>
+#include <memory>
+
+namespace aspl {
+
+// Result of deferred operation, shared between operation and its future.
+// If destroyed without result, e.g. because operation was dropped without
+// being invoked, reports fallback status.
+class Completion
+{
+public:
+    explicit Completion(OSStatus fallbackStatus)
+        : fallbackStatus_(fallbackStatus)
+    {
+    }
+
+    Completion(const Completion&) = delete;
+    Completion& operator=(const Completion&) = delete;
+
+    ~Completion()
+    {
+        if (!done_) {
+            promise_.set_value(fallbackStatus_);
+        }
+    }
+
+    std::future<OSStatus> GetFuture()
+    {
+        return promise_.get_future();
+    }
+
+    void Complete(OSStatus status)
+    {
+        if (!done_) {
+            done_ = true;
+            promise_.set_value(status);
+        }
+    }
+
+private:
+    std::promise<OSStatus> promise_;
+    OSStatus fallbackStatus_;
+    bool done_ = false;
+};
+
+// Make future which is already ready with given status.
+inline std::future<OSStatus> MakeReadyFuture(OSStatus status)
+{
+    std::promise<OSStatus> promise;
+    promise.set_value(status);
+
+    return promise.get_future();
+}
+
+} // namespace aspl
@@ -2,19 +2,79 @@
 // Licensed under MIT
 
 #include <aspl/Device.hpp>
+#include <aspl/Profiler.hpp>
+#include <aspl/RealtimeScope.hpp>
 
+#include "Completion.hpp"
 #include "Convert.hpp"
 #include "Strings.hpp"
+#include "Tracing.hpp"
 #include "Uid.hpp"
 #include "Variant.hpp"
 #include "VolumeCurve.hpp"
 
 #include <algorithm>
 
-#include <mach/mach_time.h>
-
 namespace aspl {
 
+namespace {
+
+void AddNumberToDictionary(CFMutableDictionaryRef dict, const char* key, UInt64 value)
+{
+    const SInt64 intValue = SInt64(value);
+
+    CFStringRef keyRef =
+        CFStringCreateWithCString(kCFAllocatorDefault, key, kCFStringEncodingUTF8);
+    CFNumberRef valueRef =
+        CFNumberCreate(kCFAllocatorDefault, kCFNumberSInt64Type, &intValue);
+
+    CFDictionarySetValue(dict, keyRef, valueRef);
+
+    CFRelease(valueRef);
+    CFRelease(keyRef);
+}
+
+void AddOperationStatsToDictionary(CFMutableDictionaryRef dict,
+    const char* key,
+    const IOOperationStats& stats)
+{
+    CFMutableDictionaryRef valueRef = CFDictionaryCreateMutable(kCFAllocatorDefault,
+        0,
+        &kCFTypeDictionaryKeyCallBacks,
+        &kCFTypeDictionaryValueCallBacks);
+
+    AddNumberToDictionary(valueRef, "NumCalls", stats.NumCalls);
+    AddNumberToDictionary(valueRef, "MinTimeNs", stats.MinTimeNs);
+    AddNumberToDictionary(valueRef, "AvgTimeNs", stats.AvgTimeNs);
+    AddNumberToDictionary(valueRef, "MaxTimeNs", stats.MaxTimeNs);
+    AddNumberToDictionary(valueRef, "P99TimeNs", stats.P99TimeNs);
+
+    CFStringRef keyRef =
+        CFStringCreateWithCString(kCFAllocatorDefault, key, kCFStringEncodingUTF8);
+
+    CFDictionarySetValue(dict, keyRef, valueRef);
+
+    CFRelease(valueRef);
+    CFRelease(keyRef);
+}
+
+// Lock I/O mutex on realtime thread.
+// Uncontended mutex is acquired without blocking. If it's held by a non-realtime
+// thread, we have to wait, and since the caller is already inside RealtimeScope,
+// realtime checker reports it.
+std::unique_lock<std::recursive_mutex> LockRealtime(std::recursive_mutex& mutex)
+{
+    std::unique_lock lock(mutex, std::try_to_lock);
+
+    if (!lock.owns_lock()) {
+        lock.lock();
+    }
+
+    return lock;
+}
+
+} // namespace
+
 Device::Device(std::shared_ptr<const Context> context, const DeviceParameters& params)
     : Object(std::move(context), "Device")
     , params_(params)
@@ -28,9 +88,29 @@ Device::Device(std::shared_ptr<const Context> context, const DeviceParameters& p
           params_.ZeroTimeStampPeriod ? params_.ZeroTimeStampPeriod : params_.SampleRate)
     , nominalSampleRate_(params.SampleRate)
     , preferredChannelsForStereo_({1, 2})
+    , streams_(std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , streamByID_(std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , volumeControls_(
+          std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , volumeControlByID_(
+          std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , muteControls_(std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , muteControlByID_(
+          std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
+    , clientByID_(std::allocator_arg, MakeAllocator(GetContext()->MemoryResource.get()))
 {
     SetControlHandler(nullptr);
     SetIOHandler(nullptr);
+
+    UpdateScratchArena();
+
+    if (params_.EnableIOStats) {
+        ioStats_ =
+            std::make_unique<IOStatsCollector>(GetClock().GetHostClockFrequency());
+
+        RegisterCustomProperty(
+            params_.IOStatsSelector, [this]() { return CopyIOStatsPropertyList(); });
+    }
 }
 
 std::string Device::GetName() const
@@ -153,7 +233,7 @@ OSStatus Device::CheckNominalSampleRate(Float64 rate) const
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("rate %f is not supported", rate);
+    ASPL_TRACE_MESSAGE(GetTracer(), "rate %f is not supported", rate);
 
     return kAudioHardwareUnsupportedOperationError;
 }
@@ -516,7 +596,7 @@ void Device::AddStreamAsync(std::shared_ptr<Stream> stream)
     op.Name = "Device::AddStreamAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (stream) {
         const auto dir = stream->GetDirection();
@@ -547,10 +627,10 @@ void Device::AddStreamAsync(std::shared_ptr<Stream> stream)
                                         : kAudioObjectPropertyScopeOutput);
         });
     } else {
-        GetContext()->Tracer->Message("stream is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "stream is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 void Device::RemoveStreamAsync(std::shared_ptr<Stream> stream)
@@ -561,7 +641,7 @@ void Device::RemoveStreamAsync(std::shared_ptr<Stream> stream)
     op.Name = "Device::RemoveStreamAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (stream) {
         const auto dir = stream->GetDirection();
@@ -593,10 +673,10 @@ void Device::RemoveStreamAsync(std::shared_ptr<Stream> stream)
             RemoveOwnedObject(stream->GetID());
         });
     } else {
-        GetContext()->Tracer->Message("stream is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "stream is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 UInt32 Device::GetVolumeControlCount(AudioObjectPropertyScope scope) const
@@ -672,7 +752,7 @@ void Device::AddVolumeControlAsync(std::shared_ptr<VolumeControl> control)
     op.Name = "Device::AddVolumeControlAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (control) {
         const auto scope = control->GetScope();
@@ -695,10 +775,10 @@ void Device::AddVolumeControlAsync(std::shared_ptr<VolumeControl> control)
             AddOwnedObject(control, scope);
         });
     } else {
-        GetContext()->Tracer->Message("control is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "control is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 void Device::RemoveVolumeControlAsync(std::shared_ptr<VolumeControl> control)
@@ -709,7 +789,7 @@ void Device::RemoveVolumeControlAsync(std::shared_ptr<VolumeControl> control)
     op.Name = "Device::RemoveVolumeControlAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (control) {
         const auto scope = control->GetScope();
@@ -735,10 +815,10 @@ void Device::RemoveVolumeControlAsync(std::shared_ptr<VolumeControl> control)
             RemoveOwnedObject(control->GetID());
         });
     } else {
-        GetContext()->Tracer->Message("control is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "control is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 UInt32 Device::GetMuteControlCount(AudioObjectPropertyScope scope) const
@@ -812,7 +892,7 @@ void Device::AddMuteControlAsync(std::shared_ptr<MuteControl> control)
     op.Name = "Device::AddMuteControlAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (control) {
         const auto scope = control->GetScope();
@@ -835,10 +915,10 @@ void Device::AddMuteControlAsync(std::shared_ptr<MuteControl> control)
             AddOwnedObject(control, scope);
         });
     } else {
-        GetContext()->Tracer->Message("control is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "control is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 void Device::RemoveMuteControlAsync(std::shared_ptr<MuteControl> control)
@@ -849,7 +929,7 @@ void Device::RemoveMuteControlAsync(std::shared_ptr<MuteControl> control)
     op.Name = "Device::RemoveMuteControlAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (control) {
         const auto scope = control->GetScope();
@@ -875,10 +955,10 @@ void Device::RemoveMuteControlAsync(std::shared_ptr<MuteControl> control)
             RemoveOwnedObject(control->GetID());
         });
     } else {
-        GetContext()->Tracer->Message("control is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "control is null");
     }
 
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 void Device::SetControlHandler(std::shared_ptr<ControlRequestHandler> handler)
@@ -919,7 +999,7 @@ OSStatus Device::AddClient(AudioObjectID objectID,
     op.Name = "Device::AddClient()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
     ClientInfo clientInfo;
@@ -927,13 +1007,13 @@ OSStatus Device::AddClient(AudioObjectID objectID,
     auto clientByID = clientByID_.Get();
 
     if (objectID != GetID()) {
-        GetContext()->Tracer->Message("object not found");
+        ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
         status = kAudioHardwareBadObjectError;
         goto end;
     }
 
     if (!rawClientInfo) {
-        GetContext()->Tracer->Message("client info is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "client info is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -943,7 +1023,7 @@ OSStatus Device::AddClient(AudioObjectID objectID,
     clientInfo.IsNativeEndian = rawClientInfo->mIsNativeEndian;
     Convert::FromFoundation(rawClientInfo->mBundleID, clientInfo.BundleID);
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "client info: clientID=%u processID=%u isNativeEndian=%d bundleID=%s",
         unsigned(clientInfo.ClientID),
         unsigned(clientInfo.ProcessID),
@@ -953,7 +1033,7 @@ OSStatus Device::AddClient(AudioObjectID objectID,
     {
         auto client = GetControlHandler()->OnAddClient(clientInfo);
         if (!client) {
-            GetContext()->Tracer->Message("control handler failed");
+            ASPL_TRACE_MESSAGE(GetTracer(), "control handler failed");
             status = kAudioHardwareUnspecifiedError;
             goto end;
         }
@@ -963,7 +1043,7 @@ OSStatus Device::AddClient(AudioObjectID objectID,
     }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -977,7 +1057,7 @@ OSStatus Device::RemoveClient(AudioObjectID objectID,
     op.Name = "Device::RemoveClient()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
     ClientInfo clientInfo;
@@ -985,13 +1065,13 @@ OSStatus Device::RemoveClient(AudioObjectID objectID,
     auto clientByID = clientByID_.Get();
 
     if (objectID != GetID()) {
-        GetContext()->Tracer->Message("object not found");
+        ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
         status = kAudioHardwareBadObjectError;
         goto end;
     }
 
     if (!rawClientInfo) {
-        GetContext()->Tracer->Message("client info is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "client info is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -1001,7 +1081,7 @@ OSStatus Device::RemoveClient(AudioObjectID objectID,
     clientInfo.IsNativeEndian = rawClientInfo->mIsNativeEndian;
     Convert::FromFoundation(rawClientInfo->mBundleID, clientInfo.BundleID);
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "client info: clientID=%u processID=%u isNativeEndian=%d bundleID=%s",
         unsigned(clientInfo.ClientID),
         unsigned(clientInfo.ProcessID),
@@ -1009,8 +1089,8 @@ OSStatus Device::RemoveClient(AudioObjectID objectID,
         clientInfo.BundleID.c_str());
 
     if (!clientByID.count(rawClientInfo->mClientID)) {
-        GetContext()->Tracer->Message(
-            "client %u not found", unsigned(rawClientInfo->mClientID));
+        ASPL_TRACE_MESSAGE(
+            GetTracer(), "client %u not found", unsigned(rawClientInfo->mClientID));
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -1025,7 +1105,7 @@ OSStatus Device::RemoveClient(AudioObjectID objectID,
     }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -1076,20 +1156,20 @@ OSStatus Device::StartIO(AudioObjectID objectID, UInt32 clientID)
     op.Name = "Device::StartIO()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     const bool isStarting = (startCount_ == 0);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (objectID != GetID()) {
-        GetContext()->Tracer->Message("object not found");
+        ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
         status = kAudioHardwareBadObjectError;
         goto end;
     }
 
     if (isStarting) {
-        GetContext()->Tracer->Message("starting io: clientID=%u", unsigned(clientID));
+        ASPL_TRACE_MESSAGE(GetTracer(), "starting io: clientID=%u", unsigned(clientID));
     }
 
     status = StartIOImpl(clientID, startCount_);
@@ -1105,7 +1185,7 @@ OSStatus Device::StartIO(AudioObjectID objectID, UInt32 clientID)
     }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -1121,7 +1201,7 @@ OSStatus Device::StartIOImpl(UInt32 clientID, UInt32 startCount)
             goto end;
         }
 
-        anchorHostTime_ = mach_absolute_time();
+        anchorHostTime_ = GetClock().GetHostTime();
         periodCounter_ = 0;
     }
 
@@ -1137,20 +1217,20 @@ OSStatus Device::StopIO(AudioObjectID objectID, UInt32 clientID)
     op.Name = "Device::StopIO()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     const bool isStopping = (startCount_ == 1);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (objectID != GetID()) {
-        GetContext()->Tracer->Message("object not found");
+        ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
         status = kAudioHardwareBadObjectError;
         goto end;
     }
 
     if (isStopping) {
-        GetContext()->Tracer->Message("stopping io: clientID=%u", unsigned(clientID));
+        ASPL_TRACE_MESSAGE(GetTracer(), "stopping io: clientID=%u", unsigned(clientID));
     }
 
     status = StopIOImpl(clientID, startCount_ - 1);
@@ -1161,12 +1241,16 @@ OSStatus Device::StopIO(AudioObjectID objectID, UInt32 clientID)
 
     startCount_--;
 
+    // We're holding ioMutex_, so no I/O operation is running and scratch
+    // arenas replaced during I/O are not used anymore.
+    ReleaseRetiredScratchArenas();
+
     if (isStopping) {
         NotifyPropertyChanged(kAudioDevicePropertyDeviceIsRunning);
     }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -1209,13 +1293,57 @@ IORequestHandler* Device::GetIOHandler() const
     return GetVariantPtr(ioHandler_.Get());
 }
 
+ScratchBuffer Device::BorrowScratchBuffer()
+{
+    // No locking here, caller is expected to be inside I/O operation,
+    // which already holds ioMutex_.
+    return scratchArena_.load()->Borrow();
+}
+
+IOStats Device::GetIOStats() const
+{
+    IOStats stats;
+
+    if (ioStats_) {
+        stats = ioStats_->GetStats();
+        stats.NumActiveClients = UInt32(std::max(SInt32(startCount_), 0));
+    }
+
+    return stats;
+}
+
+CFPropertyListRef Device::CopyIOStatsPropertyList() const
+{
+    const auto stats = GetIOStats();
+
+    CFMutableDictionaryRef dict = CFDictionaryCreateMutable(kCFAllocatorDefault,
+        0,
+        &kCFTypeDictionaryKeyCallBacks,
+        &kCFTypeDictionaryValueCallBacks);
+
+    AddNumberToDictionary(dict, "NumCycles", stats.NumCycles);
+    AddNumberToDictionary(dict, "NumLateCycles", stats.NumLateCycles);
+    AddNumberToDictionary(dict, "NumOverruns", stats.NumOverruns);
+    AddNumberToDictionary(dict, "NumUnderruns", stats.NumUnderruns);
+    AddNumberToDictionary(dict, "NumActiveClients", stats.NumActiveClients);
+
+    AddOperationStatsToDictionary(dict, "ReadInput", stats.ReadInput);
+    AddOperationStatsToDictionary(dict, "ProcessInput", stats.ProcessInput);
+    AddOperationStatsToDictionary(dict, "MixOutput", stats.MixOutput);
+    AddOperationStatsToDictionary(dict, "ProcessMix", stats.ProcessMix);
+    AddOperationStatsToDictionary(dict, "WriteMix", stats.WriteMix);
+
+    return dict;
+}
+
 OSStatus Device::GetZeroTimeStamp(AudioObjectID objectID,
     UInt32 clientID,
     Float64* outSampleTime,
     UInt64* outHostTime,
     UInt64* outSeed)
 {
-    std::lock_guard ioLock(ioMutex_);
+    RealtimeScope realtimeScope(params_.EnableRealtimeChecks);
+    const auto ioLock = LockRealtime(ioMutex_);
 
     Tracer::Operation op;
     op.Name = "Device::GetZeroTimeStamp()";
@@ -1223,7 +1351,7 @@ OSStatus Device::GetZeroTimeStamp(AudioObjectID objectID,
     op.ObjectID = GetID();
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationBegin(op);
+        ASPL_TRACE_BEGIN(GetTracer(), op);
     }
 
     OSStatus status = kAudioHardwareNoError;
@@ -1240,7 +1368,7 @@ OSStatus Device::GetZeroTimeStamp(AudioObjectID objectID,
     }
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "returning"
             " outSampleTime=%f"
             " outHostTime=%lu"
@@ -1252,7 +1380,7 @@ OSStatus Device::GetZeroTimeStamp(AudioObjectID objectID,
 
 end:
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationEnd(op, status);
+        ASPL_TRACE_END(GetTracer(), op, status);
     }
 
     return status;
@@ -1266,17 +1394,13 @@ OSStatus Device::GetZeroTimeStampImpl(UInt32 clientID,
     if (const Float64 newSampleRate = GetNominalSampleRate();
         newSampleRate != lastSampleRate_) {
         // Handle sample rate change.
-        struct mach_timebase_info timeBase;
-        mach_timebase_info(&timeBase);
-
-        Float64 hostClockFrequency = Float64(timeBase.denom) / timeBase.numer;
-        hostClockFrequency *= 1000000000.0;
+        const Float64 hostClockFrequency = GetClock().GetHostClockFrequency();
 
         hostTicksPerFrame_ = hostClockFrequency / newSampleRate;
         lastSampleRate_ = newSampleRate;
     }
 
-    const UInt64 currentHostTime = mach_absolute_time();
+    const UInt64 currentHostTime = GetClock().GetHostTime();
 
     const Float64 framesPerPeriod = GetZeroTimeStampPeriod();
     const Float64 hostTicksPerPeriod = hostTicksPerFrame_ * framesPerPeriod;
@@ -1307,7 +1431,8 @@ OSStatus Device::WillDoIOOperation(AudioObjectID objectID,
     Boolean* outWillDo,
     Boolean* outWillDoInPlace)
 {
-    std::lock_guard ioLock(ioMutex_);
+    RealtimeScope realtimeScope(params_.EnableRealtimeChecks);
+    const auto ioLock = LockRealtime(ioMutex_);
 
     Tracer::Operation op;
     op.Name = "Device::WillDoIOOperation()";
@@ -1315,7 +1440,7 @@ OSStatus Device::WillDoIOOperation(AudioObjectID objectID,
     op.ObjectID = GetID();
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationBegin(op);
+        ASPL_TRACE_BEGIN(GetTracer(), op);
     }
 
     OSStatus status = kAudioHardwareNoError;
@@ -1335,15 +1460,17 @@ OSStatus Device::WillDoIOOperation(AudioObjectID objectID,
     }
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->Message("%s WillDo=%d WillDoInPlace=%d",
-            OperationIDToString(operationID).c_str(),
+        StringBuffer buf;
+        ASPL_TRACE_MESSAGE(GetTracer(),
+            "%s WillDo=%d WillDoInPlace=%d",
+            OperationIDToString(operationID, buf).data(),
             int(*outWillDo),
             int(*outWillDoInPlace));
     }
 
 end:
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationEnd(op, status);
+        ASPL_TRACE_END(GetTracer(), op, status);
     }
 
     return status;
@@ -1391,10 +1518,11 @@ OSStatus Device::BeginIOOperation(AudioObjectID objectID,
     UInt32 ioFrameCount,
     const AudioServerPlugInIOCycleInfo* ioCycleInfo)
 {
-    std::lock_guard ioLock(ioMutex_);
+    RealtimeScope realtimeScope(params_.EnableRealtimeChecks);
+    const auto ioLock = LockRealtime(ioMutex_);
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->Message("Device::BeginIOOperation()");
+        ASPL_TRACE_MESSAGE(GetTracer(), "Device::BeginIOOperation()");
     }
 
     OSStatus status = kAudioHardwareNoError;
@@ -1427,7 +1555,8 @@ OSStatus Device::DoIOOperation(AudioObjectID objectID,
     void* ioMainBuffer,
     void* ioSecondaryBuffer)
 {
-    std::lock_guard ioLock(ioMutex_);
+    RealtimeScope realtimeScope(params_.EnableRealtimeChecks);
+    const auto ioLock = LockRealtime(ioMutex_);
 
     Tracer::Operation op;
     op.Name = "Device::DoIOOperation()";
@@ -1435,11 +1564,12 @@ OSStatus Device::DoIOOperation(AudioObjectID objectID,
     op.ObjectID = GetID();
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationBegin(op);
+        ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        GetContext()->Tracer->Message(
+        StringBuffer buf;
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "%s StreamID=%u ClientID=%u NumFrames=%u InTs=%f OutTs=%f ZeroTs=%f",
-            OperationIDToString(operationID).c_str(),
+            OperationIDToString(operationID, buf).data(),
             unsigned(streamID),
             unsigned(clientID),
             unsigned(ioFrameCount),
@@ -1455,6 +1585,13 @@ OSStatus Device::DoIOOperation(AudioObjectID objectID,
         goto end;
     }
 
+    if (ioStats_) {
+        ioStats_->BeginOperation(*ioCycleInfo,
+            GetClock().GetHostTime(),
+            currentPeriodHostTime_,
+            hostTicksPerFrame_ * GetZeroTimeStampPeriod());
+    }
+
     status = DoIOOperationImpl(streamID,
         clientID,
         operationID,
@@ -1463,9 +1600,13 @@ OSStatus Device::DoIOOperation(AudioObjectID objectID,
         ioMainBuffer,
         ioSecondaryBuffer);
 
+    if (ioStats_) {
+        ioStats_->EndOperation(operationID, GetClock().GetHostTime());
+    }
+
 end:
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->OperationEnd(op, status);
+        ASPL_TRACE_END(GetTracer(), op, status);
     }
 
     return status;
@@ -1491,8 +1632,26 @@ OSStatus Device::DoIOOperationImpl(AudioObjectID streamID,
 
     const auto ioHandler = GetIOHandler();
 
+    const auto profiler = GetProfiler();
+    const auto& clock = GetClock();
+
+    ProfilerEvent event;
+
+    if (profiler) {
+        event.CycleCounter = ioCycleInfo->mIOCycleCounter;
+        event.DeviceID = GetID();
+        event.StreamID = streamID;
+        event.ClientID = clientID;
+        event.OperationID = operationID;
+        event.FrameCount = ioFrameCount;
+    }
+
     switch (operationID) {
     case kAudioServerPlugInIOOperationReadInput:
+    {
+        ProfilerScope profilerScope(
+            profiler, clock, event, ProfilerCallback::ReadClientInput);
+
         ioHandler->OnReadClientInput(client,
             stream,
             currentPeriodTimestamp_,
@@ -1500,8 +1659,13 @@ OSStatus Device::DoIOOperationImpl(AudioObjectID streamID,
             ioMainBuffer,
             ioBytesCount);
         break;
+    }
 
     case kAudioServerPlugInIOOperationProcessInput:
+    {
+        ProfilerScope profilerScope(
+            profiler, clock, event, ProfilerCallback::ProcessClientInput);
+
         ioHandler->OnProcessClientInput(client,
             stream,
             currentPeriodTimestamp_,
@@ -1510,26 +1674,43 @@ OSStatus Device::DoIOOperationImpl(AudioObjectID streamID,
             ioFrameCount,
             ioChannelCount);
         break;
+    }
 
     case kAudioServerPlugInIOOperationMixOutput:
-        ioHandler->OnProcessClientOutput(client,
-            stream,
-            currentPeriodTimestamp_,
-            ioCycleInfo->mOutputTime.mSampleTime,
-            static_cast<Float32*>(ioMainBuffer),
-            ioFrameCount,
-            ioChannelCount);
+    {
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::ProcessClientOutput);
+
+            ioHandler->OnProcessClientOutput(client,
+                stream,
+                currentPeriodTimestamp_,
+                ioCycleInfo->mOutputTime.mSampleTime,
+                static_cast<Float32*>(ioMainBuffer),
+                ioFrameCount,
+                ioChannelCount);
+        }
 
-        ioHandler->OnWriteClientOutput(client,
-            stream,
-            currentPeriodTimestamp_,
-            ioCycleInfo->mOutputTime.mSampleTime,
-            static_cast<const Float32*>(ioMainBuffer),
-            ioFrameCount,
-            ioChannelCount);
+        {
+            ProfilerScope profilerScope(
+                profiler, clock, event, ProfilerCallback::WriteClientOutput);
+
+            ioHandler->OnWriteClientOutput(client,
+                stream,
+                currentPeriodTimestamp_,
+                ioCycleInfo->mOutputTime.mSampleTime,
+                static_cast<const Float32*>(ioMainBuffer),
+                ioFrameCount,
+                ioChannelCount);
+        }
         break;
+    }
 
     case kAudioServerPlugInIOOperationProcessMix:
+    {
+        ProfilerScope profilerScope(
+            profiler, clock, event, ProfilerCallback::ProcessMixedOutput);
+
         ioHandler->OnProcessMixedOutput(stream,
             currentPeriodTimestamp_,
             ioCycleInfo->mOutputTime.mSampleTime,
@@ -1537,14 +1718,20 @@ OSStatus Device::DoIOOperationImpl(AudioObjectID streamID,
             ioFrameCount,
             ioChannelCount);
         break;
+    }
 
     case kAudioServerPlugInIOOperationWriteMix:
+    {
+        ProfilerScope profilerScope(
+            profiler, clock, event, ProfilerCallback::WriteMixedOutput);
+
         ioHandler->OnWriteMixedOutput(stream,
             currentPeriodTimestamp_,
             ioCycleInfo->mOutputTime.mSampleTime,
             ioMainBuffer,
             ioBytesCount);
         break;
+    }
 
     default:
         break;
@@ -1553,16 +1740,22 @@ OSStatus Device::DoIOOperationImpl(AudioObjectID streamID,
     return kAudioHardwareNoError;
 }
 
+Float64 Device::GetCurrentZeroTimestamp() const
+{
+    return currentPeriodTimestamp_;
+}
+
 OSStatus Device::EndIOOperation(AudioObjectID objectID,
     UInt32 clientID,
     UInt32 operationID,
     UInt32 ioFrameCount,
     const AudioServerPlugInIOCycleInfo* ioCycleInfo)
 {
-    std::lock_guard ioLock(ioMutex_);
+    RealtimeScope realtimeScope(params_.EnableRealtimeChecks);
+    const auto ioLock = LockRealtime(ioMutex_);
 
     if (params_.EnableRealtimeTracing) {
-        GetContext()->Tracer->Message("Device::EndIOOperation()");
+        ASPL_TRACE_MESSAGE(GetTracer(), "Device::EndIOOperation()");
     }
 
     OSStatus status = kAudioHardwareNoError;
@@ -1590,6 +1783,68 @@ void Device::RequestConfigurationChange(std::function<void()> func)
 {
     std::lock_guard writeLock(writeMutex_);
 
+    if (configurationBatchDepth_ != 0) {
+        ASPL_TRACE_MESSAGE(
+            GetTracer(), "Device::RequestConfigurationChange() saving change to batch");
+
+        batchedConfigurationRequests_.push_back(std::move(func));
+        return;
+    }
+
+    std::vector<std::function<void()>> funcs;
+    funcs.push_back(std::move(func));
+
+    SubmitConfigurationChange(std::move(funcs));
+}
+
+std::future<OSStatus> Device::RequestConfigurationChangeWithResult(
+    std::function<OSStatus()> func)
+{
+    // If the function is dropped without being invoked, completion is
+    // destroyed and reports abort status.
+    auto completion = std::make_shared<Completion>(ConfigurationChangeAbortedError);
+    auto future = completion->GetFuture();
+
+    RequestConfigurationChange([func = std::move(func), completion]() {
+        completion->Complete(func ? func() : OSStatus(kAudioHardwareNoError));
+    });
+
+    return future;
+}
+
+void Device::BeginConfigurationBatch()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    configurationBatchDepth_++;
+}
+
+void Device::EndConfigurationBatch()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    if (configurationBatchDepth_ == 0) {
+        ASPL_TRACE_MESSAGE(
+            GetTracer(), "Device::EndConfigurationBatch() unpaired call, ignoring");
+        return;
+    }
+
+    if (--configurationBatchDepth_ != 0 || batchedConfigurationRequests_.empty()) {
+        return;
+    }
+
+    ASPL_TRACE_MESSAGE(GetTracer(),
+        "Device::EndConfigurationBatch() submitting batch numChanges=%lu",
+        static_cast<unsigned long>(batchedConfigurationRequests_.size()));
+
+    std::vector<std::function<void()>> funcs;
+    funcs.swap(batchedConfigurationRequests_);
+
+    SubmitConfigurationChange(std::move(funcs));
+}
+
+void Device::SubmitConfigurationChange(std::vector<std::function<void()>> funcs)
+{
     auto host = GetContext()->Host.load();
 
     // Note: RequestConfigurationChange(), RequestOwnershipChange(), and
@@ -1597,20 +1852,42 @@ void Device::RequestConfigurationChange(std::function<void()> func)
     // RequestOwnershipChange() changes HasOwner(), and PerformConfigurationChange()
     // changes insideConfigurationHandler_.
     if (host && HasOwner() && !insideConfigurationHandler_) {
+        if (params_.CoalesceConfigurationChanges &&
+            !pendingConfigurationRequests_.empty()) {
+            // Requests are removed from map when HAL starts performing them,
+            // so any request in map is not performed yet and we can append to it.
+            auto& [reqID, pendingFuncs] = *pendingConfigurationRequests_.rbegin();
+
+            ASPL_TRACE_MESSAGE(GetTracer(),
+                "Device::RequestConfigurationChange() merging change into reqID=%lu",
+                static_cast<unsigned long>(reqID));
+
+            for (auto& func : funcs) {
+                pendingFuncs.push_back(std::move(func));
+            }
+            return;
+        }
+
         const auto reqID = lastConfigurationRequestID_++;
 
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Device::RequestConfigurationChange() enqueueing change reqID=%lu",
             static_cast<unsigned long>(reqID));
 
-        pendingConfigurationRequests_[reqID] = std::move(func);
+        pendingConfigurationRequests_[reqID] = std::move(funcs);
 
         host->RequestDeviceConfigurationChange(host, GetID(), reqID, nullptr);
     } else {
-        GetContext()->Tracer->Message(
-            "Device::RequestConfigurationChange() applying change in-place");
+        ASPL_TRACE_MESSAGE(
+            GetTracer(), "Device::RequestConfigurationChange() applying change in-place");
 
-        func();
+        for (const auto& func : funcs) {
+            if (func) {
+                func();
+            }
+        }
+
+        UpdateScratchArena();
     }
 }
 
@@ -1626,7 +1903,7 @@ void Device::RequestOwnershipChange(Object* owner, bool shouldHaveOwnership)
             return;
         }
 
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Device::RequestOwnershipChange() attaching owner devID=%lu ownerID=%lu",
             static_cast<unsigned long>(GetID()),
             static_cast<unsigned long>(owner->GetID()));
@@ -1641,7 +1918,7 @@ void Device::RequestOwnershipChange(Object* owner, bool shouldHaveOwnership)
             return;
         }
 
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Device::RequestOwnershipChange() detaching owner devID=%lu ownerID=%lu",
             static_cast<unsigned long>(GetID()),
             static_cast<unsigned long>(owner->GetID()));
@@ -1656,7 +1933,7 @@ void Device::RequestOwnershipChange(Object* owner, bool shouldHaveOwnership)
             // guaranteed now that HAL will ever handle them. But HAL *will* try
             // to apply (some of) them, PerformConfigurationChange() will just
             // ignore those requests because we've removed them from map here.
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "Device::RequestOwnershipChange()"
                 " applying pending configuration changes in-place"
                 " devID=%lu  numChanges=%lu",
@@ -1667,11 +1944,17 @@ void Device::RequestOwnershipChange(Object* owner, bool shouldHaveOwnership)
             while (!pendingConfigurationRequests_.empty()) {
                 auto it = pendingConfigurationRequests_.begin();
 
-                const auto& func = it->second;
-                func();
-
+                const auto funcs = std::move(it->second);
                 pendingConfigurationRequests_.erase(it);
+
+                for (const auto& func : funcs) {
+                    if (func) {
+                        func();
+                    }
+                }
             }
+
+            UpdateScratchArena();
         }
     }
 }
@@ -1686,21 +1969,27 @@ OSStatus Device::PerformConfigurationChange(AudioObjectID objectID,
 
     const auto reqID = changeAction;
 
-    auto func = pendingConfigurationRequests_[reqID];
+    std::vector<std::function<void()>> funcs;
 
-    if (func) {
-        GetContext()->Tracer->Message(
-            "Device::PerformConfigurationChange() performing queued change reqID=%lu",
-            static_cast<unsigned long>(reqID));
+    if (auto it = pendingConfigurationRequests_.find(reqID);
+        it != pendingConfigurationRequests_.end()) {
+        funcs = std::move(it->second);
+        pendingConfigurationRequests_.erase(it);
+    }
 
-        func();
-    } else {
-        GetContext()->Tracer->Message(
-            "Device::PerformConfigurationChange() ignoring null change request reqID=%lu",
-            static_cast<unsigned long>(reqID));
+    ASPL_TRACE_MESSAGE(GetTracer(),
+        "Device::PerformConfigurationChange() performing queued change"
+        " reqID=%lu numChanges=%lu",
+        static_cast<unsigned long>(reqID),
+        static_cast<unsigned long>(funcs.size()));
+
+    for (const auto& func : funcs) {
+        if (func) {
+            func();
+        }
     }
 
-    pendingConfigurationRequests_.erase(reqID);
+    UpdateScratchArena();
 
     insideConfigurationHandler_--;
 
@@ -1715,7 +2004,7 @@ OSStatus Device::AbortConfigurationChange(AudioObjectID objectID,
 
     const auto reqID = changeAction;
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "Device::PerformConfigurationChange() aborting change request reqID=%lu",
         static_cast<unsigned long>(reqID));
 
@@ -1724,4 +2013,61 @@ OSStatus Device::AbortConfigurationChange(AudioObjectID objectID,
     return kAudioHardwareNoError;
 }
 
+void Device::UpdateScratchArena()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    UInt32 bufferCount = params_.ScratchBufferCount;
+    UInt32 frameCount = 0;
+    UInt32 channelCount = 0;
+
+    if (bufferCount != 0) {
+        frameCount = std::max(GetZeroTimeStampPeriod(), params_.MaxIOBufferFrameSize);
+        channelCount = GetPreferredChannelCount();
+
+        auto readLock = streams_.GetReadLock();
+
+        for (const auto& [dir, streams] : readLock.GetReference()) {
+            for (const auto& stream : streams) {
+                channelCount = std::max(channelCount, stream->GetChannelCount());
+            }
+        }
+    }
+
+    if (const auto arena = scratchArena_.load(); arena &&
+        arena->GetBufferCount() == bufferCount && arena->GetFrameCount() == frameCount &&
+        arena->GetChannelCount() == channelCount) {
+        return;
+    }
+
+    if (bufferCount != 0) {
+        ASPL_TRACE_MESSAGE(GetTracer(),
+            "Device::UpdateScratchArena() allocating scratch buffers"
+            " bufferCount=%lu frameCount=%lu channelCount=%lu",
+            static_cast<unsigned long>(bufferCount),
+            static_cast<unsigned long>(frameCount),
+            static_cast<unsigned long>(channelCount));
+    }
+
+    // Don't lock ioMutex_ here: we're holding writeMutex_, and I/O handlers
+    // may lock them in opposite order. Instead, publish new arena atomically,
+    // and keep old one until no I/O operation can use it.
+    scratchArenas_.push_back(
+        std::make_unique<ScratchArena>(bufferCount, frameCount, channelCount));
+    scratchArena_ = scratchArenas_.back().get();
+
+    if (startCount_ == 0) {
+        ReleaseRetiredScratchArenas();
+    }
+}
+
+void Device::ReleaseRetiredScratchArenas()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    if (scratchArenas_.size() > 1) {
+        scratchArenas_.erase(scratchArenas_.begin(), scratchArenas_.end() - 1);
+    }
+}
+
 } // namespace aspl
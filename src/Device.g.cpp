@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: Device.json
-// Timestamp: Sun Apr 13 14:12:48 2025 UTC
+// Timestamp: Mon Oct 19 09:08:12 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/Device.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -38,7 +40,8 @@ bool Device::IsInstance(AudioClassID classID) const
     }
 }
 
-OSStatus Device::SetLatencyAsync(UInt32 value)
+OSStatus Device::SetLatencyAsync(UInt32 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -46,45 +49,62 @@ OSStatus Device::SetLatencyAsync(UInt32 value)
     op.Name = "Device::SetLatencyAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetLatency()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetLatencyImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetLatencyImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetLatency()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetLatency()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetLatencyImpl(std::move(value));
-        }
+                status = SetLatencyImpl(std::move(value));
+            }
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            ASPL_TRACE_END(GetTracer(), op, status);
+
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetSafetyOffsetAsync(UInt32 value)
+OSStatus Device::SetSafetyOffsetAsync(UInt32 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -92,45 +112,62 @@ OSStatus Device::SetSafetyOffsetAsync(UInt32 value)
     op.Name = "Device::SetSafetyOffsetAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetSafetyOffset()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetSafetyOffsetImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetSafetyOffsetImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetSafetyOffset()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetSafetyOffset()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetSafetyOffsetImpl(std::move(value));
-        }
+                status = SetSafetyOffsetImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetZeroTimeStampPeriodAsync(UInt32 value)
+OSStatus Device::SetZeroTimeStampPeriodAsync(UInt32 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -138,45 +175,62 @@ OSStatus Device::SetZeroTimeStampPeriodAsync(UInt32 value)
     op.Name = "Device::SetZeroTimeStampPeriodAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetZeroTimeStampPeriod()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetZeroTimeStampPeriodImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetZeroTimeStampPeriodImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetZeroTimeStampPeriod()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetZeroTimeStampPeriod()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetZeroTimeStampPeriodImpl(std::move(value));
-        }
+                status = SetZeroTimeStampPeriodImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetNominalSampleRateAsync(Float64 value)
+OSStatus Device::SetNominalSampleRateAsync(Float64 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -184,51 +238,68 @@ OSStatus Device::SetNominalSampleRateAsync(Float64 value)
     op.Name = "Device::SetNominalSampleRateAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetNominalSampleRate()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
     status = CheckNominalSampleRate(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("value is invalid");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value is invalid");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetNominalSampleRateImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetNominalSampleRateImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetNominalSampleRate()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetNominalSampleRate()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetNominalSampleRateImpl(std::move(value));
-        }
+                status = SetNominalSampleRateImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetAvailableSampleRatesAsync(std::vector<AudioValueRange> value)
+OSStatus Device::SetAvailableSampleRatesAsync(std::vector<AudioValueRange> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -236,45 +307,62 @@ OSStatus Device::SetAvailableSampleRatesAsync(std::vector<AudioValueRange> value
     op.Name = "Device::SetAvailableSampleRatesAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetAvailableSampleRates()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetAvailableSampleRatesImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetAvailableSampleRatesImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetAvailableSampleRates()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetAvailableSampleRates()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetAvailableSampleRatesImpl(std::move(value));
-        }
+                status = SetAvailableSampleRatesImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetPreferredChannelsForStereoAsync(std::array<UInt32, 2> value)
+OSStatus Device::SetPreferredChannelsForStereoAsync(std::array<UInt32, 2> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -282,45 +370,62 @@ OSStatus Device::SetPreferredChannelsForStereoAsync(std::array<UInt32, 2> value)
     op.Name = "Device::SetPreferredChannelsForStereoAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetPreferredChannelsForStereo()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetPreferredChannelsForStereoImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetPreferredChannelsForStereoImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetPreferredChannelsForStereo()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetPreferredChannelsForStereo()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetPreferredChannelsForStereoImpl(std::move(value));
-        }
+                status = SetPreferredChannelsForStereoImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetPreferredChannelCountAsync(UInt32 value)
+OSStatus Device::SetPreferredChannelCountAsync(UInt32 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -328,45 +433,62 @@ OSStatus Device::SetPreferredChannelCountAsync(UInt32 value)
     op.Name = "Device::SetPreferredChannelCountAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetPreferredChannelCount()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetPreferredChannelCountImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetPreferredChannelCountImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetPreferredChannelCount()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetPreferredChannelCount()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetPreferredChannelCountImpl(std::move(value));
-        }
+                status = SetPreferredChannelCountImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
+
+            return status;
+        };
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetPreferredChannelsAsync(std::vector<AudioChannelDescription> value)
+OSStatus Device::SetPreferredChannelsAsync(std::vector<AudioChannelDescription> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -374,45 +496,62 @@ OSStatus Device::SetPreferredChannelsAsync(std::vector<AudioChannelDescription>
     op.Name = "Device::SetPreferredChannelsAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetPreferredChannels()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetPreferredChannelsImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetPreferredChannelsImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetPreferredChannels()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetPreferredChannels()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetPreferredChannelsImpl(std::move(value));
-        }
+                status = SetPreferredChannelsImpl(std::move(value));
+            }
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            ASPL_TRACE_END(GetTracer(), op, status);
+
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Device::SetPreferredChannelLayoutAsync(std::vector<UInt8> value)
+OSStatus Device::SetPreferredChannelLayoutAsync(std::vector<UInt8> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -420,40 +559,56 @@ OSStatus Device::SetPreferredChannelLayoutAsync(std::vector<UInt8> value)
     op.Name = "Device::SetPreferredChannelLayoutAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetPreferredChannelLayout()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Device::SetPreferredChannelLayoutImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Device::SetPreferredChannelLayoutImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetPreferredChannelLayout()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetPreferredChannelLayout()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetPreferredChannelLayoutImpl(std::move(value));
-        }
+                status = SetPreferredChannelLayoutImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -466,28 +621,28 @@ OSStatus Device::SetIsIdentifying(bool value)
     op.Name = "Device::SetIsIdentifying()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetIsIdentifying()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetIsIdentifyingImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioObjectPropertyIdentify);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -500,28 +655,28 @@ OSStatus Device::SetIsAlive(bool value)
     op.Name = "Device::SetIsAlive()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetIsAlive()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetIsAliveImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioDevicePropertyDeviceIsAlive);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -534,28 +689,28 @@ OSStatus Device::SetIsHidden(bool value)
     op.Name = "Device::SetIsHidden()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetIsHidden()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetIsHiddenImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioDevicePropertyIsHidden);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -568,28 +723,28 @@ OSStatus Device::SetCanBeDefaultDevice(bool value)
     op.Name = "Device::SetCanBeDefaultDevice()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetCanBeDefaultDevice()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetCanBeDefaultDeviceImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioDevicePropertyDeviceCanBeDefaultDevice);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -602,28 +757,28 @@ OSStatus Device::SetCanBeDefaultSystemDevice(bool value)
     op.Name = "Device::SetCanBeDefaultSystemDevice()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetCanBeDefaultSystemDevice()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetCanBeDefaultSystemDeviceImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioDevicePropertyDeviceCanBeDefaultSystemDevice);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -641,10 +796,10 @@ Boolean Device::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -653,79 +808,79 @@ Boolean Device::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioObjectPropertyName:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyManufacturer:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyDeviceUID:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyModelUID:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertySerialNumber:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyFirmwareVersion:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyIcon:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyConfigurationApplication:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyTransportType:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyRelatedDevices:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyClockIsStable:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyClockAlgorithm:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyClockDomain:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -735,13 +890,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -755,13 +910,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -771,19 +926,19 @@ Boolean Device::HasProperty(AudioObjectID objectID,
             goto end;
         case kAudioDevicePropertyZeroTimeStampPeriod:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyNominalSampleRate:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyAvailableNominalSampleRates:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -793,13 +948,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -813,13 +968,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -829,25 +984,25 @@ Boolean Device::HasProperty(AudioObjectID objectID,
             goto end;
         case kAudioDevicePropertyDeviceIsRunning:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyIdentify:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyDeviceIsAlive:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioDevicePropertyIsHidden:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -857,13 +1012,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -877,13 +1032,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
                 case kAudioObjectPropertyScopeInput:
                 case kAudioObjectPropertyScopeOutput:
                     {
-                        GetContext()->Tracer->Message("returning HasProperty=true");
+                        ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                         result = true;
                     }
                     break;
                 default:
                     {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "returning HasProperty=false (disallowed scope)");
                         result = false;
                     }
@@ -893,13 +1048,13 @@ Boolean Device::HasProperty(AudioObjectID objectID,
             goto end;
         case kAudioDevicePropertyStreams:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyControlList:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -909,7 +1064,7 @@ Boolean Device::HasProperty(AudioObjectID objectID,
     result = Object::HasProperty(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -927,10 +1082,10 @@ OSStatus Device::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -940,280 +1095,280 @@ OSStatus Device::IsPropertySettable(AudioObjectID objectID,
         case kAudioObjectPropertyName:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyManufacturer:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceUID:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyModelUID:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertySerialNumber:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyFirmwareVersion:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyIcon:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyConfigurationApplication:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyTransportType:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyRelatedDevices:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockIsStable:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockAlgorithm:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockDomain:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyLatency:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertySafetyOffset:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyZeroTimeStampPeriod:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyNominalSampleRate:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyAvailableNominalSampleRates:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyPreferredChannelsForStereo:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyPreferredChannelLayout:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceIsRunning:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyIdentify:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceIsAlive:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyIsHidden:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceCanBeDefaultDevice:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceCanBeDefaultSystemDevice:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyStreams:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyControlList:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1223,7 +1378,7 @@ OSStatus Device::IsPropertySettable(AudioObjectID objectID,
     status = Object::IsPropertySettable(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -1246,10 +1401,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -1260,10 +1415,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1271,10 +1426,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1282,10 +1437,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1293,10 +1448,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1304,10 +1459,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1315,10 +1470,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1326,10 +1481,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFURLRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1337,10 +1492,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1348,10 +1503,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1361,10 +1516,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetRelatedDeviceIDs();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioObjectID));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1372,10 +1527,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1383,10 +1538,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1394,10 +1549,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1405,10 +1560,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1416,10 +1571,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1427,10 +1582,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1438,10 +1593,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(Float64);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1451,10 +1606,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetAvailableSampleRates();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioValueRange));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1464,10 +1619,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetPreferredChannelsForStereo();
                     *outDataSize = UInt32(values.size()
                         * sizeof(UInt32));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1477,10 +1632,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetPreferredChannelLayout();
                     *outDataSize = UInt32(values.size()
                         * sizeof(UInt8));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1488,10 +1643,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1499,10 +1654,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1510,10 +1665,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1521,10 +1676,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1532,10 +1687,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1543,10 +1698,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1556,10 +1711,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetStreamIDs(address->mScope);
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioObjectID));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1569,10 +1724,10 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetControlIDs();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioObjectID));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -1583,7 +1738,7 @@ OSStatus Device::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -1610,10 +1765,10 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -1623,7 +1778,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
         case kAudioObjectPropertyName:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1632,25 +1787,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetName();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Name=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyManufacturer:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1659,25 +1814,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetManufacturer();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Manufacturer=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceUID:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1686,25 +1841,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetDeviceUID();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DeviceUID=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyModelUID:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1713,25 +1868,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetModelUID();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ModelUID=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertySerialNumber:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1740,25 +1895,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetSerialNumber();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning SerialNumber=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyFirmwareVersion:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1767,25 +1922,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetFirmwareVersion();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning FirmwareVersion=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyIcon:
             {
                 if (inDataSize < sizeof(CFURLRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFURLRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1794,25 +1949,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFURLRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIconURL();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFURLRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IconURL=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyConfigurationApplication:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1821,25 +1976,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetConfigurationApplicationBundleID();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ConfigurationApplicationBundleID=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyTransportType:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1848,18 +2003,18 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetTransportType();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning TransportType=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -1873,7 +2028,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioObjectID));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -1881,20 +2036,20 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioObjectID*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning RelatedDeviceIDs=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockIsStable:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1903,25 +2058,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetClockIsStable();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ClockIsStable=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockAlgorithm:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1930,25 +2085,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetClockAlgorithm();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ClockAlgorithm=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyClockDomain:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1957,25 +2112,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetClockDomain();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ClockDomain=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyLatency:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -1984,25 +2139,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetLatency();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Latency=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertySafetyOffset:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2011,25 +2166,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetSafetyOffset();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning SafetyOffset=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyZeroTimeStampPeriod:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2038,25 +2193,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetZeroTimeStampPeriod();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ZeroTimeStampPeriod=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyNominalSampleRate:
             {
                 if (inDataSize < sizeof(Float64)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(Float64)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2065,18 +2220,18 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(Float64);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetNominalSampleRate();
                     Convert::ToFoundation(
                         value,
                         *static_cast<Float64*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning NominalSampleRate=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2090,7 +2245,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioValueRange));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -2098,13 +2253,13 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioValueRange*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning AvailableSampleRates=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2118,7 +2273,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(UInt32));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -2126,13 +2281,13 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<UInt32*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning PreferredChannelsForStereo=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2141,7 +2296,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 const auto values = GetPreferredChannelLayout();
                 const size_t valuesCount = values.size();
                 if (inDataSize < valuesCount * sizeof(UInt8)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(valuesCount * sizeof(UInt8)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2151,7 +2306,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(UInt8));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -2159,20 +2314,20 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<UInt8*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning PreferredChannelLayout=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceIsRunning:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2181,25 +2336,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsRunning();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsRunning=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyIdentify:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2208,25 +2363,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsIdentifying();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsIdentifying=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceIsAlive:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2235,25 +2390,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsAlive();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsAlive=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyIsHidden:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2262,25 +2417,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsHidden();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsHidden=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceCanBeDefaultDevice:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2289,25 +2444,25 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetCanBeDefaultDevice();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning CanBeDefaultDevice=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioDevicePropertyDeviceCanBeDefaultSystemDevice:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -2316,18 +2471,18 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetCanBeDefaultSystemDevice();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning CanBeDefaultSystemDevice=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2341,7 +2496,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioObjectID));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -2349,13 +2504,13 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioObjectID*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning StreamIDs=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2369,7 +2524,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioObjectID));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -2377,13 +2532,13 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioObjectID*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ControlIDs=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -2395,7 +2550,7 @@ OSStatus Device::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -2419,10 +2574,10 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -2432,13 +2587,13 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
         case kAudioDevicePropertyNominalSampleRate:
             {
                 if (inDataSize != sizeof(Float64)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(Float64)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -2447,12 +2602,12 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const Float64*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting NominalSampleRate=%s",
                     Convert::ToString(value).c_str());
                 status = SetNominalSampleRateAsync(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -2460,13 +2615,13 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
         case kAudioObjectPropertyIdentify:
             {
                 if (inDataSize != sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(UInt32)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -2475,12 +2630,12 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const UInt32*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting IsIdentifying=%s",
                     Convert::ToString(value).c_str());
                 status = SetIsIdentifying(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -2492,7 +2647,7 @@ OSStatus Device::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -0,0 +1,129 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/DevicePool.hpp>
+
+#include "Tracing.hpp"
+#include "Uid.hpp"
+
+namespace aspl {
+
+DevicePool::DevicePool(std::shared_ptr<const Context> context,
+    const DevicePoolParameters& params,
+    Factory factory)
+    : context_(std::move(context))
+    , params_(params)
+    , factory_(std::move(factory))
+{
+}
+
+DevicePool::~DevicePool() = default;
+
+const DevicePoolParameters& DevicePool::GetParameters() const
+{
+    return params_;
+}
+
+std::shared_ptr<Device> DevicePool::Acquire()
+{
+    {
+        std::lock_guard lock(mutex_);
+
+        numAcquired_++;
+
+        if (!readyDevices_.empty()) {
+            auto device = std::move(readyDevices_.back());
+            readyDevices_.pop_back();
+
+            return device;
+        }
+
+        numMisses_++;
+    }
+
+    ASPL_TRACE_MESSAGE(
+        context_->Tracer, "DevicePool::Acquire() pool is empty, building device");
+
+    return Build();
+}
+
+void DevicePool::Release(std::shared_ptr<Device> device)
+{
+    if (!device) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+
+    releasedDevices_.push_back(std::move(device));
+}
+
+void DevicePool::Refill()
+{
+    std::lock_guard refillLock(refillMutex_);
+
+    std::vector<std::shared_ptr<Device>> releasedDevices;
+    size_t numReady = 0;
+
+    {
+        std::lock_guard lock(mutex_);
+
+        releasedDevices.swap(releasedDevices_);
+        numReady = readyDevices_.size();
+    }
+
+    // destroy without holding lock
+    releasedDevices.clear();
+
+    std::vector<std::shared_ptr<Device>> newDevices;
+
+    for (size_t n = numReady; n < params_.Size; n++) {
+        newDevices.push_back(Build());
+    }
+
+    if (!newDevices.empty()) {
+        std::lock_guard lock(mutex_);
+
+        for (auto& device : newDevices) {
+            readyDevices_.push_back(std::move(device));
+        }
+    }
+}
+
+DevicePoolStats DevicePool::GetStats() const
+{
+    std::lock_guard lock(mutex_);
+
+    DevicePoolStats stats;
+
+    stats.NumReady = readyDevices_.size();
+    stats.NumReleased = releasedDevices_.size();
+    stats.NumAcquired = numAcquired_;
+    stats.NumMisses = numMisses_;
+
+    return stats;
+}
+
+std::shared_ptr<Device> DevicePool::Build()
+{
+    DeviceParameters deviceParams = params_.Device;
+    deviceParams.DeviceUID = deviceParams.ModelUID + ":" + GenerateUID();
+
+    if (factory_) {
+        return factory_(context_, deviceParams);
+    }
+
+    auto device = std::make_shared<Device>(context_, deviceParams);
+
+    for (const auto& streamParams : params_.Streams) {
+        if (params_.AddControls) {
+            device->AddStreamWithControlsAsync(streamParams);
+        } else {
+            device->AddStreamAsync(streamParams);
+        }
+    }
+
+    return device;
+}
+
+} // namespace aspl
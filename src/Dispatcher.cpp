@@ -4,16 +4,23 @@
 #include <aspl/Dispatcher.hpp>
 #include <aspl/Object.hpp>
 
-#include <limits>
+#include "ObjectIDAllocator.hpp"
 
 namespace aspl {
 
-Dispatcher::Dispatcher(std::shared_ptr<Tracer> tracer, AudioObjectID hintMaximumID)
+Dispatcher::Dispatcher(std::shared_ptr<Tracer> tracer,
+    AudioObjectID hintMaximumID,
+    std::shared_ptr<MemoryResource> memoryResource)
     : tracer_(std::move(tracer))
-    , desiredMaximumID_(hintMaximumID)
+    , memoryResource_(std::move(memoryResource))
+    , registeredObjects_(std::allocator_arg, MakeAllocator(memoryResource_.get()))
+    , idAllocator_(std::make_unique<ObjectIDAllocator>(
+          tracer_, hintMaximumID, memoryResource_.get()))
 {
 }
 
+Dispatcher::~Dispatcher() = default;
+
 std::shared_ptr<Object> Dispatcher::FindObject(AudioObjectID objectID) const
 {
     auto readLock = registeredObjects_.GetReadLock();
@@ -82,21 +89,26 @@ AudioObjectID Dispatcher::RegisterObject(Object& object, AudioObjectID objectID)
         tracer_->OperationBegin(op);
     }
 
-    if (objectID == kAudioObjectUnknown) {
-        objectID = AllocateID();
-    }
-
     auto registeredObjects = registeredObjects_.Get();
 
-    if (registeredObjects.count(objectID)) {
-        if (tracer_) {
-            tracer_->Message("objectID=%u already registered", unsigned(objectID));
+    if (objectID == kAudioObjectUnknown) {
+        objectID = idAllocator_->Allocate();
+    } else {
+        if (registeredObjects.count(objectID)) {
+            if (tracer_) {
+                tracer_->Message("objectID=%u already registered", unsigned(objectID));
+            }
+            objectID = kAudioObjectUnknown;
+            goto end;
         }
-        objectID = kAudioObjectUnknown;
-        goto end;
+
+        // Prevent allocator from handing out this identifier until the object
+        // is unregistered.
+        idAllocator_->Acquire(objectID);
     }
 
-    registeredObjects[objectID] = std::make_shared<Registration>(&object);
+    registeredObjects[objectID] = std::allocate_shared<Registration>(
+        MakeAllocator<Registration>(memoryResource_.get()), &object);
     registeredObjects_.Set(std::move(registeredObjects));
 
     if (tracer_) {
@@ -160,7 +172,7 @@ void Dispatcher::UnregisterObject(AudioObjectID objectID)
         std::unique_lock objLock(registration->mutex);
     }
 
-    FreeID(objectID);
+    idAllocator_->Free(objectID);
 
     if (tracer_) {
         tracer_->Message("unregistered objectID=%u", unsigned(objectID));
@@ -172,144 +184,4 @@ end:
     }
 }
 
-AudioObjectID Dispatcher::AllocateID()
-{
-    AudioObjectID nextID = lastAllocatedID_ + 1;
-
-    if (nextID >= desiredMaximumID_ && numAllocatedIDs_ > desiredMaximumID_ / 2) {
-        if (desiredMaximumID_ <= std::numeric_limits<AudioObjectID>::max() / 2) {
-            if (tracer_) {
-                tracer_->Message("increasing desired maximum from %u to %u",
-                    unsigned(desiredMaximumID_),
-                    unsigned(desiredMaximumID_ * 2));
-            }
-            desiredMaximumID_ *= 2;
-        }
-    }
-
-    const bool isFree = IsFree(nextID);
-
-    if (tracer_) {
-        tracer_->Message("candidate nextID=%u isFree=%d desiredMaximumID=%u",
-            unsigned(nextID),
-            int(isFree),
-            unsigned(desiredMaximumID_));
-    }
-
-    if (nextID >= desiredMaximumID_) {
-        nextID = FindFreeID(0);
-    } else if (!isFree) {
-        nextID = FindFreeID(nextID + 1);
-    }
-
-    SetFree(nextID, false);
-    numAllocatedIDs_++;
-    lastAllocatedID_ = nextID;
-
-    if (tracer_) {
-        tracer_->Message("allocated objectID=%u numAllocated=%u",
-            unsigned(nextID),
-            unsigned(numAllocatedIDs_));
-    }
-
-    return nextID;
-}
-
-void Dispatcher::FreeID(AudioObjectID objectID)
-{
-    SetFree(objectID, true);
-    numAllocatedIDs_--;
-
-    if (tracer_) {
-        tracer_->Message("freed objectID=%u numAllocated=%u",
-            unsigned(objectID),
-            unsigned(numAllocatedIDs_));
-    }
-}
-
-AudioObjectID Dispatcher::FindFreeID(AudioObjectID startID) const
-{
-    if (allocatedBits_.size() != 0) {
-        const size_t startChunk = startID / BitsPerChunk;
-
-        for (size_t n = 0; n <= allocatedBits_.size(); n++) {
-            const size_t chunk = (startChunk + n) % allocatedBits_.size();
-
-            const auto chunkBits = allocatedBits_[chunk];
-
-            if (chunkBits == BitChunk(-1)) {
-                continue;
-            }
-
-            for (size_t bit = 0; bit < BitsPerChunk; bit++) {
-                if ((chunkBits & (BitChunk(1) << bit)) == 0) {
-                    const auto objectID = AudioObjectID(chunk * BitsPerChunk + bit);
-
-                    if (n == 0 && objectID < startID) {
-                        continue;
-                    }
-
-                    if (reservedIDs_.count(objectID)) {
-                        continue;
-                    }
-
-                    if (tracer_) {
-                        tracer_->Message(
-                            "selected id inside bitset startID=%u selectedID=%u",
-                            unsigned(startID),
-                            unsigned(objectID));
-                    }
-
-                    return objectID;
-                }
-            }
-        }
-    }
-
-    auto objectID = AudioObjectID(allocatedBits_.size() * BitsPerChunk);
-    while (reservedIDs_.count(objectID)) {
-        objectID++;
-    }
-
-    if (tracer_) {
-        tracer_->Message("selected id after bitset startID=%u selectedID=%u",
-            unsigned(startID),
-            unsigned(objectID));
-    }
-
-    return objectID;
-}
-
-bool Dispatcher::IsFree(AudioObjectID objectID) const
-{
-    if (reservedIDs_.count(objectID)) {
-        return false;
-    }
-
-    const size_t chunk = objectID / BitsPerChunk;
-    const size_t bit = objectID % BitsPerChunk;
-
-    if (allocatedBits_.size() <= chunk) {
-        return true;
-    }
-
-    return (allocatedBits_[chunk] & (BitChunk(1) << bit)) == 0;
-}
-
-void Dispatcher::SetFree(AudioObjectID objectID, bool free)
-{
-    const size_t chunk = objectID / BitsPerChunk;
-    const size_t bit = objectID % BitsPerChunk;
-
-    if (allocatedBits_.size() <= chunk) {
-        allocatedBits_.resize(chunk + 1);
-    }
-
-    if (free) {
-        allocatedBits_[chunk] &= ~(BitChunk(1) << bit);
-    } else {
-        allocatedBits_[chunk] |= (BitChunk(1) << bit);
-    }
-}
-
 } // namespace aspl
@@ -4,6 +4,8 @@
 #include <aspl/Driver.hpp>
 
 #include "Bridge.hpp"
+#include "RunningDevices.hpp"
+#include "Tracing.hpp"
 #include "Variant.hpp"
 
 #include <cstddef>
@@ -16,8 +18,9 @@ Driver::Driver(std::shared_ptr<Context> context,
     : context_(context ? std::move(context) : std::make_shared<Context>())
     , plugin_(plugin ? std::move(plugin) : std::make_shared<Plugin>(context_))
     , storage_(storage ? std::move(storage) : std::make_shared<Storage>(context_))
+    , runningDevices_(std::make_unique<RunningDevices>())
 {
-    GetContext()->Tracer->Message("Driver::Driver()");
+    ASPL_TRACE_MESSAGE(GetContext()->Tracer, "Driver::Driver()");
 
     driverInterfacePointer_ = &driverInterface_;
     driverInterface_ = {
@@ -54,7 +57,7 @@ Driver::Driver(std::shared_ptr<Context> context,
 
 Driver::~Driver()
 {
-    GetContext()->Tracer->Message("Driver::~Driver()");
+    ASPL_TRACE_MESSAGE(GetContext()->Tracer, "Driver::~Driver()");
 }
 
 std::shared_ptr<const Context> Driver::GetContext() const
@@ -138,7 +141,8 @@ HRESULT Driver::QueryInterface(void* driverRef, REFIID iid, LPVOID* outInterface
     CFRelease(interfaceID);
 
     if (!isSupportedInterface) {
-        driver->GetContext()->Tracer->Message("Driver::QueryInterface() E_NOINTERFACE");
+        ASPL_TRACE_MESSAGE(
+            driver->GetContext()->Tracer, "Driver::QueryInterface() E_NOINTERFACE");
         return E_NOINTERFACE;
     }
 
@@ -146,7 +150,8 @@ HRESULT Driver::QueryInterface(void* driverRef, REFIID iid, LPVOID* outInterface
 
     const auto counter = ++driver->refCounter_;
 
-    driver->GetContext()->Tracer->Message("Driver::QueryInterface() S_OK refCounter=%lu",
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
+        "Driver::QueryInterface() S_OK refCounter=%lu",
         static_cast<unsigned long>(counter));
 
     return S_OK;
@@ -159,8 +164,9 @@ ULONG Driver::AddRef(void* driverRef)
 
     const auto counter = ++driver->refCounter_;
 
-    driver->GetContext()->Tracer->Message(
-        "Driver::AddRef() refCounter=%lu", static_cast<unsigned long>(counter));
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
+        "Driver::AddRef() refCounter=%lu",
+        static_cast<unsigned long>(counter));
 
     return counter;
 }
@@ -172,8 +178,9 @@ ULONG Driver::Release(void* driverRef)
 
     const auto counter = --driver->refCounter_;
 
-    driver->GetContext()->Tracer->Message(
-        "Driver::Release() refCounter=%lu", static_cast<unsigned long>(counter));
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer,
+        "Driver::Release() refCounter=%lu",
+        static_cast<unsigned long>(counter));
 
     return counter;
 }
@@ -183,7 +190,7 @@ OSStatus Driver::InitializeJumper(AudioServerPlugInDriverRef driverRef,
 {
     const auto driver = Driver::GetDriver(driverRef);
 
-    driver->GetContext()->Tracer->Message("Driver::Initialize()");
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer, "Driver::Initialize()");
 
     driver->context_->Host = hostRef;
 
@@ -197,7 +204,7 @@ OSStatus Driver::CreateDeviceJumper(AudioServerPlugInDriverRef driverRef,
 {
     const auto driver = Driver::GetDriver(driverRef);
 
-    driver->GetContext()->Tracer->Message("Driver::CreateDevice()");
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer, "Driver::CreateDevice()");
 
     return driver->CreateDevice(description, clientInfo, outDeviceObjectID);
 }
@@ -207,7 +214,7 @@ OSStatus Driver::DestroyDeviceJumper(AudioServerPlugInDriverRef driverRef,
 {
     const auto driver = Driver::GetDriver(driverRef);
 
-    driver->GetContext()->Tracer->Message("Driver::DestroyDevice()");
+    ASPL_TRACE_MESSAGE(driver->GetContext()->Tracer, "Driver::DestroyDevice()");
 
     return driver->DestroyDevice(objectID);
 }
@@ -0,0 +1,211 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/IOStats.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace aspl {
+
+IOStatsCollector::IOStatsCollector(Float64 hostClockFrequency)
+    : nsPerTick_(hostClockFrequency > 0 ? 1e9 / hostClockFrequency : 0)
+{
+    for (auto* counters :
+        {&readInput_, &processInput_, &mixOutput_, &processMix_, &writeMix_}) {
+        counters->minTimeNs = std::numeric_limits<UInt64>::max();
+
+        for (auto& bucket : counters->buckets) {
+            bucket = 0;
+        }
+    }
+}
+
+void IOStatsCollector::BeginOperation(const AudioServerPlugInIOCycleInfo& cycleInfo,
+    UInt64 hostTime,
+    UInt64 zeroHostTime,
+    Float64 hostTicksPerPeriod)
+{
+    operationStartTime_ = hostTime;
+
+    if (hasCycle_ && cycleInfo.mIOCycleCounter == cycleCounter_) {
+        return;
+    }
+
+    // New cycle started.
+    const bool hasSampleTime =
+        (cycleInfo.mCurrentTime.mFlags & kAudioTimeStampSampleTimeValid);
+
+    if (hasCycle_ && hasSampleTime) {
+        const bool isContiguous = cycleInfo.mIOCycleCounter == cycleCounter_ + 1 &&
+                                  std::abs(cycleInfo.mCurrentTime.mSampleTime -
+                                           (cycleSampleTime_ + cycleFrameCount_)) < 1;
+
+        if (!isContiguous) {
+            Increment(numUnderruns_);
+        }
+    }
+
+    if (hostTicksPerPeriod > 0 && hostTime > zeroHostTime &&
+        Float64(hostTime - zeroHostTime) > hostTicksPerPeriod) {
+        Increment(numLateCycles_);
+    }
+
+    Increment(numCycles_);
+
+    hasCycle_ = true;
+    cycleCounter_ = cycleInfo.mIOCycleCounter;
+    cycleSampleTime_ = cycleInfo.mCurrentTime.mSampleTime;
+    cycleFrameCount_ = cycleInfo.mNominalIOBufferFrameSize;
+    cycleBudgetTicks_ =
+        UInt64(cycleInfo.mNominalIOBufferFrameSize * cycleInfo.mMainHostTicksPerFrame);
+    cycleTicks_ = 0;
+    cycleOverrun_ = false;
+}
+
+void IOStatsCollector::EndOperation(UInt32 operationID, UInt64 hostTime)
+{
+    const UInt64 elapsedTicks =
+        hostTime > operationStartTime_ ? hostTime - operationStartTime_ : 0;
+
+    cycleTicks_ += elapsedTicks;
+
+    if (!cycleOverrun_ && cycleBudgetTicks_ != 0 && cycleTicks_ > cycleBudgetTicks_) {
+        cycleOverrun_ = true;
+        Increment(numOverruns_);
+    }
+
+    auto counters = FindOperation(operationID);
+
+    if (!counters) {
+        return;
+    }
+
+    const UInt64 elapsedNs = UInt64(Float64(elapsedTicks) * nsPerTick_);
+
+    Increment(counters->numCalls);
+    Increment(counters->totalTimeNs, elapsedNs);
+    Increment(counters->buckets[BucketIndex(elapsedNs)]);
+
+    if (elapsedNs < counters->minTimeNs.load(std::memory_order_relaxed)) {
+        counters->minTimeNs.store(elapsedNs, std::memory_order_relaxed);
+    }
+
+    if (elapsedNs > counters->maxTimeNs.load(std::memory_order_relaxed)) {
+        counters->maxTimeNs.store(elapsedNs, std::memory_order_relaxed);
+    }
+}
+
+IOStats IOStatsCollector::GetStats() const
+{
+    IOStats stats;
+
+    stats.NumCycles = numCycles_.load(std::memory_order_relaxed);
+    stats.NumLateCycles = numLateCycles_.load(std::memory_order_relaxed);
+    stats.NumOverruns = numOverruns_.load(std::memory_order_relaxed);
+    stats.NumUnderruns = numUnderruns_.load(std::memory_order_relaxed);
+
+    stats.ReadInput = GetOperationStats(readInput_);
+    stats.ProcessInput = GetOperationStats(processInput_);
+    stats.MixOutput = GetOperationStats(mixOutput_);
+    stats.ProcessMix = GetOperationStats(processMix_);
+    stats.WriteMix = GetOperationStats(writeMix_);
+
+    return stats;
+}
+
+UInt32 IOStatsCollector::BucketIndex(UInt64 timeNs)
+{
+    constexpr UInt64 numSubBuckets = 1 << NumSubBucketBits;
+
+    // Values below numSubBuckets have their own buckets.
+    if (timeNs < numSubBuckets) {
+        return UInt32(timeNs);
+    }
+
+    // Otherwise, bucket is defined by the most significant bit and
+    // NumSubBucketBits bits following it.
+    const UInt32 msb = 63 - UInt32(__builtin_clzll(timeNs));
+    const UInt32 sub = UInt32(timeNs >> (msb - NumSubBucketBits)) & (numSubBuckets - 1);
+
+    return (msb << NumSubBucketBits) + sub;
+}
+
+UInt64 IOStatsCollector::BucketUpperBound(UInt32 index)
+{
+    constexpr UInt64 numSubBuckets = 1 << NumSubBucketBits;
+
+    if (index < numSubBuckets) {
+        return index;
+    }
+
+    const UInt32 msb = index >> NumSubBucketBits;
+    const UInt64 sub = index & (numSubBuckets - 1);
+    const UInt32 shift = msb - NumSubBucketBits;
+
+    // Careful not to overflow in the last bucket.
+    return (((numSubBuckets + sub) << shift) - 1) + (UInt64(1) << shift);
+}
+
+IOOperationStats IOStatsCollector::GetOperationStats(const OperationCounters& counters)
+{
+    IOOperationStats stats;
+
+    stats.NumCalls = counters.numCalls.load(std::memory_order_relaxed);
+
+    if (stats.NumCalls == 0) {
+        return stats;
+    }
+
+    stats.MinTimeNs = counters.minTimeNs.load(std::memory_order_relaxed);
+    stats.MaxTimeNs = counters.maxTimeNs.load(std::memory_order_relaxed);
+    stats.AvgTimeNs =
+        counters.totalTimeNs.load(std::memory_order_relaxed) / stats.NumCalls;
+
+    // Find bucket containing 99th percentile.
+    const UInt64 rank = (stats.NumCalls * 99 + 99) / 100;
+
+    UInt64 count = 0;
+
+    for (UInt32 index = 0; index < NumBuckets; index++) {
+        count += counters.buckets[index].load(std::memory_order_relaxed);
+
+        if (count >= rank) {
+            stats.P99TimeNs = BucketUpperBound(index);
+            break;
+        }
+    }
+
+    if (stats.P99TimeNs > stats.MaxTimeNs) {
+        stats.P99TimeNs = stats.MaxTimeNs;
+    }
+
+    return stats;
+}
+
+IOStatsCollector::OperationCounters* IOStatsCollector::FindOperation(UInt32 operationID)
+{
+    switch (operationID) {
+    case kAudioServerPlugInIOOperationReadInput:
+        return &readInput_;
+    case kAudioServerPlugInIOOperationProcessInput:
+        return &processInput_;
+    case kAudioServerPlugInIOOperationMixOutput:
+        return &mixOutput_;
+    case kAudioServerPlugInIOOperationProcessMix:
+        return &processMix_;
+    case kAudioServerPlugInIOOperationWriteMix:
+        return &writeMix_;
+    default:
+        return nullptr;
+    }
+}
+
+void IOStatsCollector::Increment(std::atomic<UInt64>& counter, UInt64 delta)
+{
+    // Only one writer, so no need in read-modify-write.
+    counter.store(counter.load(std::memory_order_relaxed) + delta,
+        std::memory_order_relaxed);
+}
+
+} // namespace aspl
@@ -0,0 +1,284 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/JitterBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace aspl {
+
+JitterBuffer::JitterBuffer(const JitterBufferParameters& params)
+    : params_(params)
+{
+    if (params_.BytesPerFrame == 0 || params_.Capacity == 0) {
+        return;
+    }
+
+    frames_.resize(size_t(params_.Capacity) * params_.BytesPerFrame);
+    tags_.reset(new std::atomic<UInt64>[params_.Capacity]);
+
+    for (UInt32 n = 0; n < params_.Capacity; n++) {
+        tags_[n] = EmptyTag;
+    }
+}
+
+const JitterBufferParameters& JitterBuffer::GetParameters() const
+{
+    return params_;
+}
+
+UInt32 JitterBuffer::Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount)
+{
+    numPackets_++;
+
+    if (!tags_) {
+        return 0;
+    }
+
+    const UInt32 bytesPerFrame = params_.BytesPerFrame;
+    const UInt32 capacity = params_.Capacity;
+    const UInt32 frameCount = bytesCount / bytesPerFrame;
+
+    if (frameCount == 0) {
+        return 0;
+    }
+
+    const UInt64 readPos = readPos_.load(std::memory_order_acquire);
+
+    UInt64 beginPos = sampleTime;
+    UInt64 endPos = sampleTime + frameCount;
+
+    // Frames that were already read.
+    if (beginPos < readPos) {
+        numLatePackets_++;
+        beginPos = std::min(readPos, endPos);
+    }
+
+    // Frames that would overwrite frames that were not read yet.
+    if (readPos != 0 && endPos > readPos + capacity) {
+        numOverflowPackets_++;
+        endPos = std::max(beginPos, readPos + capacity);
+    }
+
+    // Packet larger than whole buffer, before first read.
+    if (endPos - beginPos > capacity) {
+        beginPos = endPos - capacity;
+    }
+
+    if (beginPos == endPos) {
+        return 0;
+    }
+
+    // First pass: invalidate tags of frames that we're going to write.
+    // Frames that are already present are kept as is, so that concurrent
+    // Read() of a duplicate frame doesn't fail.
+    UInt32 numStored = 0;
+
+    for (UInt64 pos = beginPos; pos < endPos; pos++) {
+        auto& tag = tags_[pos % capacity];
+
+        if (tag.load(std::memory_order_relaxed) != MakeTag(pos)) {
+            tag.store(EmptyTag, std::memory_order_relaxed);
+            numStored++;
+        }
+    }
+
+    if (numStored == 0) {
+        numDuplicatePackets_++;
+        return 0;
+    }
+
+    // Tags should be invalidated before frames are modified.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Second pass: copy frames and publish tags.
+    const UInt8* src =
+        static_cast<const UInt8*>(bytes) + (beginPos - sampleTime) * bytesPerFrame;
+
+    for (UInt64 pos = beginPos; pos < endPos; pos++, src += bytesPerFrame) {
+        const size_t slot = pos % capacity;
+        auto& tag = tags_[slot];
+
+        if (tag.load(std::memory_order_relaxed) == EmptyTag) {
+            memcpy(&frames_[slot * bytesPerFrame], src, bytesPerFrame);
+            tag.store(MakeTag(pos), std::memory_order_release);
+        }
+    }
+
+    if (endPos > writePos_.load(std::memory_order_relaxed)) {
+        writePos_.store(endPos, std::memory_order_relaxed);
+    }
+
+    return numStored;
+}
+
+UInt32 JitterBuffer::Read(UInt64 sampleTime, void* bytes, UInt32 bytesCount)
+{
+    if (!tags_) {
+        memset(bytes, 0, bytesCount);
+        return 0;
+    }
+
+    const UInt32 bytesPerFrame = params_.BytesPerFrame;
+    const UInt32 frameCount = bytesCount / bytesPerFrame;
+    const UInt32 repeatPeriod =
+        params_.Concealment == ConcealmentMode::Repeat ? params_.RepeatPeriod : 0;
+
+    const UInt64 prevReadPos = readPos_.load(std::memory_order_relaxed);
+
+    UInt8* frames = static_cast<UInt8*>(bytes);
+
+    UInt32 numPresent = 0;
+    UInt64 numLost = 0;
+
+    for (UInt32 n = 0; n < frameCount;) {
+        const UInt64 pos = sampleTime + n;
+        UInt8* frame = frames + size_t(n) * bytesPerFrame;
+
+        // Copy as many present frames as possible at once.
+        if (const UInt32 numRead = ReadFrames(pos, frameCount - n, frame)) {
+            numPresent += numRead;
+            n += numRead;
+            continue;
+        }
+
+        // Frames after previous read position are read for the first time.
+        if (pos >= prevReadPos) {
+            numLost++;
+        }
+
+        bool concealed = false;
+
+        if (repeatPeriod != 0) {
+            if (n >= repeatPeriod) {
+                // Repeated frame is already in output, received or concealed.
+                memcpy(frame,
+                    frame - size_t(repeatPeriod) * bytesPerFrame,
+                    bytesPerFrame);
+                concealed = true;
+            } else if (pos >= repeatPeriod) {
+                concealed = ReadFrame(pos - repeatPeriod, frame);
+            }
+        }
+
+        if (!concealed) {
+            memset(frame, 0, bytesPerFrame);
+        }
+
+        n++;
+    }
+
+    // Zero frames trailing after the last whole frame.
+    memset(frames + size_t(frameCount) * bytesPerFrame,
+        0,
+        bytesCount - frameCount * bytesPerFrame);
+
+    if (numLost != 0) {
+        numLostFrames_.fetch_add(numLost, std::memory_order_relaxed);
+    }
+
+    if (sampleTime + frameCount > prevReadPos) {
+        readPos_.store(sampleTime + frameCount, std::memory_order_release);
+    }
+
+    return numPresent;
+}
+
+JitterBufferStats JitterBuffer::GetStats() const
+{
+    JitterBufferStats stats;
+
+    stats.NumPackets = numPackets_;
+    stats.NumDuplicatePackets = numDuplicatePackets_;
+    stats.NumLatePackets = numLatePackets_;
+    stats.NumOverflowPackets = numOverflowPackets_;
+    stats.NumLostFrames = numLostFrames_;
+
+    const UInt64 readPos = readPos_;
+    const UInt64 writePos = writePos_;
+
+    if (readPos != 0 && writePos > readPos) {
+        stats.Depth = writePos - readPos;
+    }
+
+    return stats;
+}
+
+void JitterBuffer::Reset()
+{
+    if (tags_) {
+        for (UInt32 n = 0; n < params_.Capacity; n++) {
+            tags_[n] = EmptyTag;
+        }
+    }
+
+    readPos_ = 0;
+    writePos_ = 0;
+
+    numPackets_ = 0;
+    numDuplicatePackets_ = 0;
+    numLatePackets_ = 0;
+    numOverflowPackets_ = 0;
+    numLostFrames_ = 0;
+}
+
+UInt64 JitterBuffer::MakeTag(UInt64 sampleTime)
+{
+    return sampleTime + 1;
+}
+
+UInt32 JitterBuffer::ReadFrames(UInt64 sampleTime, UInt32 frameCount, UInt8* frames) const
+{
+    const UInt32 bytesPerFrame = params_.BytesPerFrame;
+    const size_t slot = sampleTime % params_.Capacity;
+
+    // Frames are contiguous in storage until the end of the ring.
+    const UInt32 maxCount = std::min(frameCount, UInt32(params_.Capacity - slot));
+
+    UInt32 count = 0;
+    while (count < maxCount && tags_[slot + count].load(std::memory_order_acquire) ==
+                                   MakeTag(sampleTime + count)) {
+        count++;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    memcpy(frames, &frames_[slot * bytesPerFrame], size_t(count) * bytesPerFrame);
+
+    // If writer started overwriting some slots while we were copying,
+    // their tags were changed. Frames before the first changed slot are
+    // still valid, the rest will be read again by caller.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    UInt32 numValid = 0;
+    while (numValid < count && tags_[slot + numValid].load(std::memory_order_relaxed) ==
+                                   MakeTag(sampleTime + numValid)) {
+        numValid++;
+    }
+
+    return numValid;
+}
+
+bool JitterBuffer::ReadFrame(UInt64 sampleTime, UInt8* frame) const
+{
+    const size_t slot = sampleTime % params_.Capacity;
+    const auto& tag = tags_[slot];
+    const UInt64 expectedTag = MakeTag(sampleTime);
+
+    if (tag.load(std::memory_order_acquire) != expectedTag) {
+        return false;
+    }
+
+    memcpy(frame, &frames_[slot * params_.BytesPerFrame], params_.BytesPerFrame);
+
+    // If writer started overwriting the slot while we were copying,
+    // the tag was changed.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return tag.load(std::memory_order_relaxed) == expectedTag;
+}
+
+} // namespace aspl
@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: MuteControl.json
-// Timestamp: Sun Apr 13 14:12:48 2025 UTC
+// Timestamp: Mon Oct 19 08:16:49 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/MuteControl.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -48,28 +50,28 @@ OSStatus MuteControl::SetIsMuted(bool value)
     op.Name = "MuteControl::SetIsMuted()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetIsMuted()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetIsMutedImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioBooleanControlPropertyValue, GetScope(), GetElement());
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -87,10 +89,10 @@ Boolean MuteControl::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -99,19 +101,19 @@ Boolean MuteControl::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioControlPropertyScope:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioControlPropertyElement:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioBooleanControlPropertyValue:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -121,7 +123,7 @@ Boolean MuteControl::HasProperty(AudioObjectID objectID,
     result = Object::HasProperty(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -139,10 +141,10 @@ OSStatus MuteControl::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -152,30 +154,30 @@ OSStatus MuteControl::IsPropertySettable(AudioObjectID objectID,
         case kAudioControlPropertyScope:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioControlPropertyElement:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioBooleanControlPropertyValue:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -185,7 +187,7 @@ OSStatus MuteControl::IsPropertySettable(AudioObjectID objectID,
     status = Object::IsPropertySettable(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -208,10 +210,10 @@ OSStatus MuteControl::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -222,10 +224,10 @@ OSStatus MuteControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyScope);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -233,10 +235,10 @@ OSStatus MuteControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyElement);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -244,10 +246,10 @@ OSStatus MuteControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -258,7 +260,7 @@ OSStatus MuteControl::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -285,10 +287,10 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -298,7 +300,7 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
         case kAudioControlPropertyScope:
             {
                 if (inDataSize < sizeof(AudioObjectPropertyScope)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectPropertyScope)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -307,25 +309,25 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyScope);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetScope();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectPropertyScope*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Scope=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioControlPropertyElement:
             {
                 if (inDataSize < sizeof(AudioObjectPropertyElement)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectPropertyElement)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -334,25 +336,25 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyElement);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetElement();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectPropertyElement*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Element=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioBooleanControlPropertyValue:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -361,18 +363,18 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsMuted();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsMuted=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -384,7 +386,7 @@ OSStatus MuteControl::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -408,10 +410,10 @@ OSStatus MuteControl::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -421,13 +423,13 @@ OSStatus MuteControl::SetPropertyData(AudioObjectID objectID,
         case kAudioBooleanControlPropertyValue:
             {
                 if (inDataSize != sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(UInt32)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -436,12 +438,12 @@ OSStatus MuteControl::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const UInt32*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting IsMuted=%s",
                     Convert::ToString(value).c_str());
                 status = SetIsMuted(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -453,7 +455,7 @@ OSStatus MuteControl::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
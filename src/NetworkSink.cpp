@@ -0,0 +1,394 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/NetworkSink.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#define ASPL_HAS_SENDMMSG
+#if defined(UDP_SEGMENT)
+#define ASPL_HAS_UDP_GSO
+#endif
+#endif
+
+namespace aspl {
+
+namespace {
+
+// Limits of UDP generic segmentation offload.
+constexpr UInt32 MaxSegments = 64;
+constexpr UInt32 MaxSegmentedSize = 65000;
+
+void WriteHeader(UInt8* header,
+    UInt8 payloadType,
+    UInt16 sequence,
+    UInt32 timestamp,
+    UInt32 ssrc)
+{
+    // RTP version 2, no padding, no extension, no CSRC.
+    header[0] = 0x80;
+    header[1] = payloadType & 0x7f;
+
+    header[2] = UInt8(sequence >> 8);
+    header[3] = UInt8(sequence);
+
+    header[4] = UInt8(timestamp >> 24);
+    header[5] = UInt8(timestamp >> 16);
+    header[6] = UInt8(timestamp >> 8);
+    header[7] = UInt8(timestamp);
+
+    header[8] = UInt8(ssrc >> 24);
+    header[9] = UInt8(ssrc >> 16);
+    header[10] = UInt8(ssrc >> 8);
+    header[11] = UInt8(ssrc);
+}
+
+} // namespace
+
+struct NetworkSink::Batch
+{
+#if defined(ASPL_HAS_SENDMMSG)
+    std::vector<mmsghdr> Messages;
+    std::vector<UInt32> MessageSegments;
+    std::vector<iovec> Vectors;
+    std::vector<UInt8> Control;
+#endif
+};
+
+NetworkSink::NetworkSink(const NetworkSinkParameters& params)
+    : params_(params)
+    , payloadSize_(params.BytesPerFrame
+                       ? std::max(params.MaxPayloadSize / params.BytesPerFrame, 1u) *
+                             params.BytesPerFrame
+                       : params.MaxPayloadSize)
+    , slotSize_(HeaderSize + payloadSize_)
+    , batch_(std::make_unique<Batch>())
+{
+    const UInt32 queueSize = std::max(params_.QueueSize, 1u);
+    const UInt32 batchSize = std::max(params_.BatchSize, 1u);
+
+    slots_.resize(size_t(queueSize) * slotSize_);
+    slotSizes_.resize(queueSize);
+
+#if defined(ASPL_HAS_SENDMMSG)
+    batch_->Messages.resize(batchSize);
+    batch_->MessageSegments.resize(batchSize);
+    batch_->Vectors.resize(batchSize);
+#if defined(ASPL_HAS_UDP_GSO)
+    batch_->Control.resize(batchSize * CMSG_SPACE(sizeof(uint16_t)));
+#endif
+#endif
+}
+
+NetworkSink::~NetworkSink()
+{
+    Stop();
+}
+
+const NetworkSinkParameters& NetworkSink::GetParameters() const
+{
+    return params_;
+}
+
+OSStatus NetworkSink::Start()
+{
+    if (running_) {
+        return kAudioHardwareNoError;
+    }
+
+    socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_ == -1) {
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(params_.Port);
+
+    if (inet_pton(AF_INET, params_.Address.c_str(), &addr.sin_addr) != 1 ||
+        connect(socket_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1) {
+        close(socket_);
+        socket_ = -1;
+        return kAudioHardwareUnspecifiedError;
+    }
+
+#if defined(ASPL_HAS_UDP_GSO)
+    enableGSO_ = params_.EnableGSO;
+#else
+    enableGSO_ = false;
+#endif
+
+    readIndex_ = writeIndex_.load();
+
+    stopRequested_ = false;
+    running_ = true;
+
+    thread_ = std::thread(&NetworkSink::SenderLoop, this);
+
+    return kAudioHardwareNoError;
+}
+
+void NetworkSink::Stop()
+{
+    if (!running_) {
+        return;
+    }
+
+    // Writes are rejected from now, and sender thread exits when
+    // it sends remaining packets.
+    running_ = false;
+    stopRequested_ = true;
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    close(socket_);
+    socket_ = -1;
+}
+
+void NetworkSink::Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount)
+{
+    const UInt32 bytesPerFrame = std::max(params_.BytesPerFrame, 1u);
+    const UInt64 queueSize = slotSizes_.size();
+
+    const UInt8* data = static_cast<const UInt8*>(bytes);
+
+    const bool running = running_.load(std::memory_order_acquire);
+
+    UInt64 writeIndex = writeIndex_.load(std::memory_order_relaxed);
+    const UInt64 readIndex = readIndex_.load(std::memory_order_acquire);
+
+    UInt32 numQueued = 0;
+    UInt32 numDropped = 0;
+
+    while (bytesCount != 0) {
+        const UInt32 payloadSize = std::min(bytesCount, payloadSize_);
+
+        if (!running || writeIndex - readIndex == queueSize) {
+            numDropped++;
+        } else {
+            UInt8* slot = GetSlot(writeIndex);
+
+            WriteHeader(slot,
+                params_.PayloadType,
+                sequence_,
+                UInt32(sampleTime),
+                params_.SSRC);
+
+            memcpy(slot + HeaderSize, data, payloadSize);
+
+            slotSizes_[writeIndex % queueSize] = HeaderSize + payloadSize;
+
+            writeIndex++;
+            numQueued++;
+        }
+
+        // Sequence number is incremented for dropped packets too, so that
+        // receiver can detect losses.
+        sequence_++;
+
+        sampleTime += payloadSize / bytesPerFrame;
+        data += payloadSize;
+        bytesCount -= payloadSize;
+    }
+
+    // Publish all packets at once.
+    writeIndex_.store(writeIndex, std::memory_order_release);
+
+    if (numQueued != 0) {
+        numQueuedPackets_.fetch_add(numQueued, std::memory_order_relaxed);
+    }
+    if (numDropped != 0) {
+        numDroppedPackets_.fetch_add(numDropped, std::memory_order_relaxed);
+    }
+}
+
+NetworkSinkStats NetworkSink::GetStats() const
+{
+    NetworkSinkStats stats;
+
+    stats.NumQueuedPackets = numQueuedPackets_;
+    stats.NumDroppedPackets = numDroppedPackets_;
+    stats.NumSentPackets = numSentPackets_;
+    stats.NumFailedPackets = numFailedPackets_;
+    stats.NumSendCalls = numSendCalls_;
+
+    return stats;
+}
+
+void NetworkSink::SenderLoop()
+{
+    const UInt32 batchSize = std::max(params_.BatchSize, 1u);
+
+    for (;;) {
+        // Check stop flag before reading write index, so that after we see
+        // the flag, we also see all packets written before it.
+        const bool stopRequested = stopRequested_.load(std::memory_order_acquire);
+
+        const UInt64 readIndex = readIndex_.load(std::memory_order_relaxed);
+        const UInt64 writeIndex = writeIndex_.load(std::memory_order_acquire);
+
+        if (readIndex == writeIndex) {
+            if (stopRequested) {
+                break;
+            }
+            usleep(params_.PollInterval);
+            continue;
+        }
+
+        const UInt32 numPackets =
+            UInt32(std::min<UInt64>(writeIndex - readIndex, batchSize));
+        const UInt32 numProcessed = SendBatch(readIndex, numPackets);
+
+        // Release slots to realtime thread.
+        readIndex_.store(readIndex + numProcessed, std::memory_order_release);
+    }
+}
+
+UInt32 NetworkSink::SendBatch(UInt64 firstPacket, UInt32 numPackets)
+{
+    const UInt64 queueSize = slotSizes_.size();
+
+#if defined(ASPL_HAS_SENDMMSG)
+    auto& batch = *batch_;
+
+    // Build messages. Without GSO, every message holds one packet. With GSO,
+    // consecutive packets of equal size are merged into one message, which
+    // kernel splits into datagrams.
+    UInt32 numMessages = 0;
+    UInt32 packet = 0;
+
+    while (packet < numPackets) {
+        mmsghdr& msg = batch.Messages[numMessages];
+        memset(&msg, 0, sizeof(msg));
+
+        const UInt32 firstVector = packet;
+        const UInt32 segmentSize = slotSizes_[(firstPacket + packet) % queueSize];
+
+        UInt32 numSegments = 0;
+        UInt32 totalSize = 0;
+
+        do {
+            const UInt64 index = firstPacket + packet;
+            const UInt32 size = slotSizes_[index % queueSize];
+
+            batch.Vectors[packet].iov_base = GetSlot(index);
+            batch.Vectors[packet].iov_len = size;
+
+            numSegments++;
+            totalSize += size;
+            packet++;
+
+            if (!enableGSO_) {
+                break;
+            }
+        } while (packet < numPackets && numSegments < MaxSegments &&
+                 totalSize + segmentSize <= MaxSegmentedSize &&
+                 slotSizes_[(firstPacket + packet) % queueSize] == segmentSize);
+
+        msg.msg_hdr.msg_iov = &batch.Vectors[firstVector];
+        msg.msg_hdr.msg_iovlen = numSegments;
+
+#if defined(ASPL_HAS_UDP_GSO)
+        if (numSegments > 1) {
+            UInt8* control =
+                &batch.Control[numMessages * CMSG_SPACE(sizeof(uint16_t))];
+
+            msg.msg_hdr.msg_control = control;
+            msg.msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+            cmsghdr* cmsg = CMSG_FIRSTHDR(&msg.msg_hdr);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+            const uint16_t gsoSize = uint16_t(segmentSize);
+            memcpy(CMSG_DATA(cmsg), &gsoSize, sizeof(gsoSize));
+        }
+#endif
+
+        batch.MessageSegments[numMessages] = numSegments;
+        numMessages++;
+    }
+
+    // Send messages.
+    UInt32 sentMessages = 0;
+
+    while (sentMessages < numMessages) {
+        numSendCalls_++;
+
+        const int ret = sendmmsg(
+            socket_, &batch.Messages[sentMessages], numMessages - sentMessages, 0);
+
+        if (ret > 0) {
+            for (int n = 0; n < ret; n++) {
+                numSentPackets_ += batch.MessageSegments[sentMessages + n];
+            }
+            sentMessages += UInt32(ret);
+            continue;
+        }
+
+        if (ret == -1 && errno == EINTR) {
+            continue;
+        }
+
+        if (ret == -1 && enableGSO_ &&
+            batch.MessageSegments[sentMessages] > 1 &&
+            (errno == EIO || errno == EINVAL || errno == ENOPROTOOPT)) {
+            // GSO not supported by device or kernel, fall back to regular
+            // datagrams and rebuild remaining messages.
+            enableGSO_ = false;
+
+            UInt32 sentPackets = 0;
+            for (UInt32 n = 0; n < sentMessages; n++) {
+                sentPackets += batch.MessageSegments[n];
+            }
+            return sentPackets;
+        }
+
+        // Skip message that can't be sent.
+        numFailedPackets_ += batch.MessageSegments[sentMessages];
+        sentMessages++;
+    }
+
+    return numPackets;
+#else
+    for (UInt32 n = 0; n < numPackets; n++) {
+        const UInt64 index = firstPacket + n;
+
+        numSendCalls_++;
+
+        ssize_t ret;
+        do {
+            ret = send(socket_, GetSlot(index), slotSizes_[index % queueSize], 0);
+        } while (ret == -1 && errno == EINTR);
+
+        if (ret == -1) {
+            numFailedPackets_++;
+        } else {
+            numSentPackets_++;
+        }
+    }
+
+    return numPackets;
+#endif
+}
+
+UInt8* NetworkSink::GetSlot(UInt64 packet)
+{
+    return &slots_[(packet % slotSizes_.size()) * slotSize_];
+}
+
+} // namespace aspl
@@ -0,0 +1,444 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/NetworkSource.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#define ASPL_HAS_RECVMMSG
+#endif
+
+namespace aspl {
+
+namespace {
+
+// Payload slots in packet pool are aligned to this boundary.
+constexpr UInt32 PayloadAlignment = 64;
+
+UInt32 ReadUInt32(const UInt8* data)
+{
+    return (UInt32(data[0]) << 24) | (UInt32(data[1]) << 16) | (UInt32(data[2]) << 8) |
+           UInt32(data[3]);
+}
+
+} // namespace
+
+struct NetworkSource::Stream
+{
+    explicit Stream(const NetworkSourceStreamParameters& params)
+        : Params(params)
+        , Buffer(params.Buffer)
+    {
+    }
+
+    void Reset()
+    {
+        Buffer.Reset();
+
+        HasTimestamp = false;
+        LastTimestamp = 0;
+        LatestEnd = 0;
+
+        HasOffset = false;
+        Offset = 0;
+    }
+
+    const NetworkSourceStreamParameters Params;
+
+    JitterBuffer Buffer;
+
+    // accessed only by receiver thread
+    // RTP timestamp extended to 64 bits
+    bool HasTimestamp = false;
+    UInt64 LastTimestamp = 0;
+
+    // written by receiver thread, read by realtime thread
+    // end of the latest received frame
+    std::atomic<UInt64> LatestEnd = 0;
+
+    // accessed only by realtime thread
+    // difference between extended RTP timestamp and device sample time
+    bool HasOffset = false;
+    UInt64 Offset = 0;
+};
+
+struct NetworkSource::Pool
+{
+    std::vector<UInt8> Headers;
+    std::vector<UInt8> Payloads;
+    std::vector<iovec> Vectors;
+    std::vector<msghdr> Messages;
+    std::vector<UInt32> Sizes;
+#if defined(ASPL_HAS_RECVMMSG)
+    std::vector<mmsghdr> MultiMessages;
+#endif
+};
+
+NetworkSource::NetworkSource(const NetworkSourceParameters& params)
+    : params_(params)
+    , payloadSize_((std::max(params.MaxPacketSize, HeaderSize + 1) - HeaderSize +
+                       PayloadAlignment - 1) /
+                   PayloadAlignment * PayloadAlignment)
+    , pool_(std::make_unique<Pool>())
+{
+    const UInt32 batchSize = std::max(params_.BatchSize, 1u);
+
+    auto& pool = *pool_;
+
+    pool.Headers.resize(size_t(batchSize) * HeaderSize);
+    pool.Payloads.resize(size_t(batchSize) * payloadSize_ + PayloadAlignment);
+    pool.Vectors.resize(size_t(batchSize) * 2);
+    pool.Messages.resize(batchSize);
+    pool.Sizes.resize(batchSize);
+
+    // Align the first payload slot; slot size is a multiple of alignment.
+    const size_t misalignment =
+        reinterpret_cast<uintptr_t>(pool.Payloads.data()) % PayloadAlignment;
+    UInt8* payloads =
+        pool.Payloads.data() + (misalignment ? PayloadAlignment - misalignment : 0);
+
+    // Every packet is received into two buffers: header and payload.
+    for (UInt32 n = 0; n < batchSize; n++) {
+        pool.Vectors[n * 2].iov_base = &pool.Headers[size_t(n) * HeaderSize];
+        pool.Vectors[n * 2].iov_len = HeaderSize;
+
+        pool.Vectors[n * 2 + 1].iov_base = payloads + size_t(n) * payloadSize_;
+        pool.Vectors[n * 2 + 1].iov_len = payloadSize_;
+
+        msghdr& msg = pool.Messages[n];
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &pool.Vectors[n * 2];
+        msg.msg_iovlen = 2;
+    }
+
+#if defined(ASPL_HAS_RECVMMSG)
+    pool.MultiMessages.resize(batchSize);
+#endif
+}
+
+NetworkSource::~NetworkSource()
+{
+    Stop();
+}
+
+const NetworkSourceParameters& NetworkSource::GetParameters() const
+{
+    return params_;
+}
+
+OSStatus NetworkSource::AddStream(const NetworkSourceStreamParameters& params)
+{
+    if (thread_.joinable()) {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    if (params.Buffer.BytesPerFrame == 0 || FindStream(params.StreamID)) {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    streams_.push_back(std::make_unique<Stream>(params));
+
+    return kAudioHardwareNoError;
+}
+
+UInt32 NetworkSource::GetStreamCount() const
+{
+    return UInt32(streams_.size());
+}
+
+JitterBufferStats NetworkSource::GetStreamStats(UInt32 streamID) const
+{
+    if (auto stream = FindStream(streamID)) {
+        return stream->Buffer.GetStats();
+    }
+
+    return {};
+}
+
+OSStatus NetworkSource::Start()
+{
+    if (thread_.joinable()) {
+        return kAudioHardwareNoError;
+    }
+
+    socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_ == -1) {
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(params_.Port);
+
+    socklen_t addrLen = sizeof(addr);
+
+    if (inet_pton(AF_INET, params_.Address.c_str(), &addr.sin_addr) != 1 ||
+        bind(socket_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1 ||
+        getsockname(socket_, reinterpret_cast<sockaddr*>(&addr), &addrLen) == -1) {
+        close(socket_);
+        socket_ = -1;
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    port_ = ntohs(addr.sin_port);
+
+    if (params_.SocketBufferSize != 0) {
+        const int bufSize = int(params_.SocketBufferSize);
+        setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &bufSize, sizeof(bufSize));
+    }
+
+    // Receive calls return periodically, so that receiver thread can
+    // check stop flag.
+    timeval timeout = {};
+    timeout.tv_sec = params_.PollInterval / 1000000;
+    timeout.tv_usec = std::max(params_.PollInterval % 1000000, 1u);
+    setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    for (auto& stream : streams_) {
+        stream->Reset();
+    }
+
+    stopRequested_ = false;
+
+    thread_ = std::thread(&NetworkSource::ReceiverLoop, this);
+
+    return kAudioHardwareNoError;
+}
+
+void NetworkSource::Stop()
+{
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    stopRequested_ = true;
+    thread_.join();
+
+    close(socket_);
+    socket_ = -1;
+}
+
+UInt16 NetworkSource::GetPort() const
+{
+    return port_;
+}
+
+UInt32 NetworkSource::Read(UInt32 streamID,
+    UInt64 sampleTime,
+    void* bytes,
+    UInt32 bytesCount)
+{
+    Stream* stream = FindStream(streamID);
+
+    if (!stream) {
+        memset(bytes, 0, bytesCount);
+        return 0;
+    }
+
+    if (!stream->HasOffset) {
+        const UInt64 latestEnd = stream->LatestEnd.load(std::memory_order_acquire);
+
+        // Nothing received yet, wait for the first packet to choose mapping.
+        if (latestEnd == 0) {
+            memset(bytes, 0, bytesCount);
+            return 0;
+        }
+
+        // Unsigned arithmetic, wraps around if sample time is ahead of
+        // RTP timestamp.
+        stream->Offset = latestEnd - stream->Params.Latency - sampleTime;
+        stream->HasOffset = true;
+    }
+
+    return stream->Buffer.Read(sampleTime + stream->Offset, bytes, bytesCount);
+}
+
+NetworkSourceStats NetworkSource::GetStats() const
+{
+    NetworkSourceStats stats;
+
+    stats.NumReceivedPackets = numReceivedPackets_;
+    stats.NumRoutedPackets = numRoutedPackets_;
+    stats.NumUnknownPackets = numUnknownPackets_;
+    stats.NumInvalidPackets = numInvalidPackets_;
+    stats.NumRecvCalls = numRecvCalls_;
+
+    return stats;
+}
+
+NetworkSource::Stream* NetworkSource::FindStream(UInt32 streamID) const
+{
+    // Number of streams is small and fixed while running, linear search
+    // is fast and realtime-safe.
+    for (const auto& stream : streams_) {
+        if (stream->Params.StreamID == streamID) {
+            return stream.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void NetworkSource::ReceiverLoop()
+{
+    while (!stopRequested_.load(std::memory_order_acquire)) {
+        ReceiveBatch();
+    }
+}
+
+UInt32 NetworkSource::ReceiveBatch()
+{
+    auto& pool = *pool_;
+
+    const UInt32 batchSize = UInt32(pool.Messages.size());
+
+    UInt32 numPackets = 0;
+
+#if defined(ASPL_HAS_RECVMMSG)
+    for (UInt32 n = 0; n < batchSize; n++) {
+        pool.MultiMessages[n].msg_hdr = pool.Messages[n];
+        pool.MultiMessages[n].msg_len = 0;
+    }
+
+    // Wait for the first packet, then fetch all packets that are already
+    // in socket queue, up to the batch size.
+    const int ret =
+        recvmmsg(socket_, pool.MultiMessages.data(), batchSize, MSG_WAITFORONE, nullptr);
+
+    if (ret <= 0) {
+        return 0;
+    }
+
+    numPackets = UInt32(ret);
+    numRecvCalls_++;
+
+    for (UInt32 n = 0; n < numPackets; n++) {
+        pool.Sizes[n] = (pool.MultiMessages[n].msg_hdr.msg_flags & MSG_TRUNC)
+                            ? 0
+                            : UInt32(pool.MultiMessages[n].msg_len);
+    }
+#else
+    // Wait for the first packet, then fetch packets that are already
+    // in socket queue, up to the batch size.
+    while (numPackets < batchSize) {
+        msghdr& msg = pool.Messages[numPackets];
+        msg.msg_flags = 0;
+
+        const ssize_t ret = recvmsg(socket_, &msg, numPackets == 0 ? 0 : MSG_DONTWAIT);
+
+        if (ret < 0) {
+            break;
+        }
+
+        numRecvCalls_++;
+
+        pool.Sizes[numPackets] = (msg.msg_flags & MSG_TRUNC) ? 0 : UInt32(ret);
+        numPackets++;
+    }
+#endif
+
+    numReceivedPackets_ += numPackets;
+
+    // Truncated packets have zero size and are counted as invalid.
+    for (UInt32 n = 0; n < numPackets; n++) {
+        RoutePacket(static_cast<const UInt8*>(pool.Vectors[n * 2].iov_base),
+            static_cast<const UInt8*>(pool.Vectors[n * 2 + 1].iov_base),
+            pool.Sizes[n]);
+    }
+
+    return numPackets;
+}
+
+void NetworkSource::RoutePacket(const UInt8* header,
+    const UInt8* payload,
+    UInt32 packetSize)
+{
+    // Only RTP version 2 is supported.
+    if (packetSize < HeaderSize || (header[0] >> 6) != 2) {
+        numInvalidPackets_++;
+        return;
+    }
+
+    UInt32 payloadSize = packetSize - HeaderSize;
+
+    // CSRC list and header extension are received into payload buffer,
+    // skip them.
+    UInt32 headerExtra = (header[0] & 0x0f) * 4;
+
+    if (header[0] & 0x10) {
+        if (payloadSize < headerExtra + 4) {
+            numInvalidPackets_++;
+            return;
+        }
+        const UInt8* extension = payload + headerExtra;
+        headerExtra += 4 + ((UInt32(extension[2]) << 8) | extension[3]) * 4;
+    }
+
+    if (payloadSize < headerExtra) {
+        numInvalidPackets_++;
+        return;
+    }
+
+    payload += headerExtra;
+    payloadSize -= headerExtra;
+
+    // Padding, last byte holds its size.
+    if (header[0] & 0x20) {
+        if (payloadSize == 0 || payload[payloadSize - 1] > payloadSize) {
+            numInvalidPackets_++;
+            return;
+        }
+        payloadSize -= payload[payloadSize - 1];
+    }
+
+    const UInt32 timestamp = ReadUInt32(header + 4);
+    const UInt32 ssrc = ReadUInt32(header + 8);
+
+    Stream* stream = FindStream(ssrc);
+
+    if (!stream) {
+        numUnknownPackets_++;
+        return;
+    }
+
+    // Extend 32-bit RTP timestamp to 64 bits, taking wrap-around into account.
+    // Start from 2^32, so that extended timestamps never go below zero.
+    UInt64 extTimestamp;
+
+    if (!stream->HasTimestamp) {
+        extTimestamp = (UInt64(1) << 32) | timestamp;
+        stream->HasTimestamp = true;
+    } else {
+        extTimestamp = stream->LastTimestamp +
+                       UInt64(SInt64(SInt32(timestamp - UInt32(stream->LastTimestamp))));
+    }
+
+    stream->LastTimestamp = std::max(stream->LastTimestamp, extTimestamp);
+
+    const UInt32 bytesPerFrame = stream->Params.Buffer.BytesPerFrame;
+    const UInt32 frameCount = payloadSize / bytesPerFrame;
+
+    stream->Buffer.Write(extTimestamp, payload, frameCount * bytesPerFrame);
+
+    const UInt64 endTimestamp = extTimestamp + frameCount;
+
+    if (endTimestamp > stream->LatestEnd.load(std::memory_order_relaxed)) {
+        stream->LatestEnd.store(endTimestamp, std::memory_order_release);
+    }
+
+    numRoutedPackets_++;
+}
+
+} // namespace aspl
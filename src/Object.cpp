@@ -4,6 +4,7 @@
 #include <aspl/Object.hpp>
 
 #include "Strings.hpp"
+#include "Tracing.hpp"
 
 #include <algorithm>
 
@@ -49,15 +50,17 @@ Object::Object(std::shared_ptr<const Context> context,
     : context_(std::move(context))
     , className_(className)
     , objectID_(context_->Dispatcher->RegisterObject(*this, objectID))
+    , ownedObjects_(std::allocator_arg, MakeAllocator(context_->MemoryResource.get()))
+    , customProps_(std::allocator_arg, MakeAllocator(context_->MemoryResource.get()))
 {
-    GetContext()->Tracer->Message(
-        "%s::%s() objectID=%u", className_, className_, unsigned(GetID()));
+    ASPL_TRACE_MESSAGE(
+        GetTracer(), "%s::%s() objectID=%u", className_, className_, unsigned(GetID()));
 }
 
 Object::~Object()
 {
-    GetContext()->Tracer->Message(
-        "%s::~%s() objectID=%u", className_, className_, unsigned(GetID()));
+    ASPL_TRACE_MESSAGE(
+        GetTracer(), "%s::~%s() objectID=%u", className_, className_, unsigned(GetID()));
 
     GetContext()->Dispatcher->UnregisterObject(objectID_);
 }
@@ -67,6 +70,21 @@ std::shared_ptr<const Context> Object::GetContext() const
     return context_;
 }
 
+const std::shared_ptr<Tracer>& Object::GetTracer() const
+{
+    return context_->Tracer;
+}
+
+const Clock& Object::GetClock() const
+{
+    return *context_->Clock;
+}
+
+Profiler* Object::GetProfiler() const
+{
+    return context_->Profiler.get();
+}
+
 AudioObjectID Object::GetID() const
 {
     return objectID_;
@@ -110,7 +128,7 @@ void Object::AddOwnedObject(std::shared_ptr<Object> object,
     std::lock_guard writeLock(writeMutex_);
 
     if (!object) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Object::AddOwnedObject()"
             " owner:(objectID=%u classID=%s) not adding null object",
             unsigned(GetID()),
@@ -120,7 +138,7 @@ void Object::AddOwnedObject(std::shared_ptr<Object> object,
     }
 
     if (object.get() == this) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Object::AddOwnedObject()"
             " owner:(objectID=%u classID=%s) not adding self",
             unsigned(GetID()),
@@ -129,14 +147,14 @@ void Object::AddOwnedObject(std::shared_ptr<Object> object,
         return;
     }
 
-    auto ownedObjects = ownedObjects_.Get();
+    auto& ownedObjects = GetPendingOwnedObjects();
 
     ownedObjects[scope][object->GetID()] = object;
-    ownedObjects_.Set(std::move(ownedObjects));
+    PublishOwnedObjects();
 
     object->AttachOwner(*this);
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "Object::AddOwnedObject()"
         " owner:(objectID=%u classID=%s) owned:(objectID=%u classID=%s)",
         unsigned(GetID()),
@@ -149,7 +167,7 @@ void Object::RemoveOwnedObject(AudioObjectID objectID)
 {
     std::lock_guard writeLock(writeMutex_);
 
-    auto ownedObjects = ownedObjects_.Get();
+    auto& ownedObjects = GetPendingOwnedObjects();
 
     for (auto& [_, objectMap] : ownedObjects) {
         auto iter = objectMap.find(objectID);
@@ -159,7 +177,7 @@ void Object::RemoveOwnedObject(AudioObjectID objectID)
 
         auto object = iter->second;
 
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Object::RemoveOwnedObject()"
             " owner:(objectID=%u classID=%s) owned:(objectID=%u classID=%s)",
             unsigned(GetID()),
@@ -170,12 +188,17 @@ void Object::RemoveOwnedObject(AudioObjectID objectID)
         object->DetachOwner();
         objectMap.erase(iter);
 
-        ownedObjects_.Set(std::move(ownedObjects));
+        PublishOwnedObjects();
 
         return;
     }
 
-    GetContext()->Tracer->Message(
+    // Nothing changed, no need to publish.
+    if (ownedObjectsUpdateDepth_ == 0) {
+        pendingOwnedObjects_.reset();
+    }
+
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "Object::RemoveOwnedObject()"
         " owner:(objectID=%u classID=%s)"
         " not removing objectID=%u because it's not owned",
@@ -184,13 +207,36 @@ void Object::RemoveOwnedObject(AudioObjectID objectID)
         unsigned(objectID));
 }
 
+void Object::BeginOwnedObjectsUpdate()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    ownedObjectsUpdateDepth_++;
+}
+
+void Object::EndOwnedObjectsUpdate()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    if (ownedObjectsUpdateDepth_ == 0) {
+        ASPL_TRACE_MESSAGE(GetTracer(),
+            "Object::EndOwnedObjectsUpdate() unbalanced call objectID=%u",
+            unsigned(GetID()));
+        return;
+    }
+
+    ownedObjectsUpdateDepth_--;
+
+    PublishOwnedObjects();
+}
+
 void Object::AttachOwner(Object& owner)
 {
     std::lock_guard writeLock(writeMutex_);
 
     if (ownerObject_) {
-        GetContext()->Tracer->Message(
-            "detaching previous owner before attaching a new one");
+        ASPL_TRACE_MESSAGE(
+            GetTracer(), "detaching previous owner before attaching a new one");
         ownerObject_->RemoveOwnedObject(GetID());
     }
 
@@ -206,6 +252,26 @@ void Object::DetachOwner()
     ownerObject_ = nullptr;
 }
 
+Object::OwnedObjectMap& Object::GetPendingOwnedObjects()
+{
+    // Make a copy once per batch, and then modify it in-place.
+    if (!pendingOwnedObjects_) {
+        pendingOwnedObjects_ = ownedObjects_.Get();
+    }
+
+    return *pendingOwnedObjects_;
+}
+
+void Object::PublishOwnedObjects()
+{
+    if (ownedObjectsUpdateDepth_ != 0 || !pendingOwnedObjects_) {
+        return;
+    }
+
+    ownedObjects_.Set(std::move(*pendingOwnedObjects_));
+    pendingOwnedObjects_.reset();
+}
+
 void Object::NotifyPropertiesChanged(std::vector<AudioObjectPropertySelector> selectors,
     AudioObjectPropertyScope scope,
     AudioObjectPropertyElement element) const
@@ -236,7 +302,7 @@ void Object::NotifyPropertiesChanged(std::vector<AudioObjectPropertySelector> se
         propNames += PropertySelectorToString(selector);
     }
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetTracer(),
         "Object::NotifyPropertiesChanged() sending notification for %s",
         propNames.c_str());
 
@@ -300,16 +366,16 @@ Boolean Object::HasPropertyFallback(AudioObjectID objectID,
 
     if (objectID == GetID()) {
         if (customProps.count(address->mSelector)) {
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "property found in custom property map, returning HasProperty=true");
             return true;
         }
 
-        GetContext()->Tracer->Message("property not found");
+        ASPL_TRACE_MESSAGE(GetTracer(), "property not found");
         return false;
     }
 
-    GetContext()->Tracer->Message("object not found");
+    ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
     return false;
 }
 
@@ -326,23 +392,23 @@ OSStatus Object::IsPropertySettableFallback(AudioObjectID objectID,
         auto it = customProps.find(address->mSelector);
 
         if (it == customProps.end()) {
-            GetContext()->Tracer->Message("property not found");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property not found");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (outIsSettable) {
             *outIsSettable = bool(it->second->setter);
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "property found in custom property map, returning IsSettable=%s",
                 *outIsSettable ? "true" : "false");
         } else {
-            GetContext()->Tracer->Message("output buffer is null");
+            ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
         }
 
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("object not found");
+    ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
     return kAudioHardwareBadObjectError;
 }
 
@@ -361,23 +427,23 @@ OSStatus Object::GetPropertyDataSizeFallback(AudioObjectID objectID,
         auto it = customProps.find(address->mSelector);
 
         if (it == customProps.end()) {
-            GetContext()->Tracer->Message("property not found");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property not found");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (outDataSize) {
             *outDataSize = it->second->size;
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "property found in custom property map, returning PropertySize=%u",
                 unsigned(*outDataSize));
         } else {
-            GetContext()->Tracer->Message("output buffer is null");
+            ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
         }
 
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("object not found");
+    ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
     return kAudioHardwareBadObjectError;
 }
 
@@ -398,17 +464,18 @@ OSStatus Object::GetPropertyDataFallback(AudioObjectID objectID,
         auto it = customProps.find(address->mSelector);
 
         if (it == customProps.end()) {
-            GetContext()->Tracer->Message("property not found");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property not found");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (!it->second->getter) {
-            GetContext()->Tracer->Message("property does not have getter");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property does not have getter");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (inDataSize < it->second->size) {
-            GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+            ASPL_TRACE_MESSAGE(GetTracer(),
+                "not enough space: need %u, avail %u",
                 unsigned(it->second->size),
                 unsigned(inDataSize));
             return kAudioHardwareBadPropertySizeError;
@@ -417,20 +484,21 @@ OSStatus Object::GetPropertyDataFallback(AudioObjectID objectID,
         if (outDataSize) {
             *outDataSize = it->second->size;
         } else {
-            GetContext()->Tracer->Message("size buffer is null");
+            ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
         }
 
         if (outData) {
-            GetContext()->Tracer->Message("returning property from custom property map");
+            ASPL_TRACE_MESSAGE(
+                GetTracer(), "returning property from custom property map");
             it->second->getter(outData);
         } else {
-            GetContext()->Tracer->Message("data buffer is null");
+            ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
         }
 
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("object not found");
+    ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
     return kAudioHardwareBadObjectError;
 }
 
@@ -450,34 +518,35 @@ OSStatus Object::SetPropertyDataFallback(AudioObjectID objectID,
         auto it = customProps.find(address->mSelector);
 
         if (it == customProps.end()) {
-            GetContext()->Tracer->Message("property not found");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property not found");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (!it->second->setter) {
-            GetContext()->Tracer->Message("property does not have setter");
+            ASPL_TRACE_MESSAGE(GetTracer(), "property does not have setter");
             return kAudioHardwareUnknownPropertyError;
         }
 
         if (inDataSize != it->second->size) {
-            GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+            ASPL_TRACE_MESSAGE(GetTracer(),
+                "invalid size: should be %u, got %u",
                 unsigned(it->second->size),
                 unsigned(inDataSize));
             return kAudioHardwareBadPropertySizeError;
         }
 
         if (!inData) {
-            GetContext()->Tracer->Message("input buffer is null");
+            ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
             return kAudioHardwareIllegalOperationError;
         }
 
-        GetContext()->Tracer->Message("setting property in custom property map");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setting property in custom property map");
         it->second->setter(inData);
 
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("object not found");
+    ASPL_TRACE_MESSAGE(GetTracer(), "object not found");
     return kAudioHardwareBadObjectError;
 }
 
@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: Object.json
-// Timestamp: Sun Apr 13 14:12:48 2025 UTC
+// Timestamp: Mon Oct 19 08:16:49 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/Object.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -50,10 +52,10 @@ Boolean Object::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -62,31 +64,31 @@ Boolean Object::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioObjectPropertyClass:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyBaseClass:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyOwner:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyOwnedObjects:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioObjectPropertyCustomPropertyInfoList:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -96,7 +98,7 @@ Boolean Object::HasProperty(AudioObjectID objectID,
     result = HasPropertyFallback(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -114,10 +116,10 @@ OSStatus Object::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -127,50 +129,50 @@ OSStatus Object::IsPropertySettable(AudioObjectID objectID,
         case kAudioObjectPropertyClass:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyBaseClass:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyOwner:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyOwnedObjects:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyCustomPropertyInfoList:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -180,7 +182,7 @@ OSStatus Object::IsPropertySettable(AudioObjectID objectID,
     status = IsPropertySettableFallback(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -203,10 +205,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -217,10 +219,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioClassID);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -228,10 +230,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioClassID);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -239,10 +241,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectID);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -252,10 +254,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetOwnedObjectIDs(address->mScope);
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioObjectID));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -265,10 +267,10 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetCustomProperties();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioServerPlugInCustomPropertyInfo));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -279,7 +281,7 @@ OSStatus Object::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -306,10 +308,10 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -319,7 +321,7 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
         case kAudioObjectPropertyClass:
             {
                 if (inDataSize < sizeof(AudioClassID)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioClassID)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -328,25 +330,25 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioClassID);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetClass();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioClassID*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Class=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyBaseClass:
             {
                 if (inDataSize < sizeof(AudioClassID)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioClassID)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -355,25 +357,25 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioClassID);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetBaseClass();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioClassID*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning BaseClass=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioObjectPropertyOwner:
             {
                 if (inDataSize < sizeof(AudioObjectID)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectID)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -382,18 +384,18 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectID);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetOwnerID();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectID*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning OwnerID=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -407,7 +409,7 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioObjectID));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -415,13 +417,13 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioObjectID*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning OwnedObjectIDs=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -435,7 +437,7 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioServerPlugInCustomPropertyInfo));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -443,13 +445,13 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioServerPlugInCustomPropertyInfo*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning CustomProperties=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -461,7 +463,7 @@ OSStatus Object::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -485,10 +487,10 @@ OSStatus Object::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -502,7 +504,7 @@ OSStatus Object::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -0,0 +1,262 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "ObjectIDAllocator.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace aspl {
+
+namespace {
+
+// Identifiers that should not be auto-allocated.
+constexpr AudioObjectID ReservedIDs[] = {
+    kAudioObjectUnknown,
+    kAudioObjectPlugInObject,
+};
+
+constexpr size_t NoWord = std::numeric_limits<size_t>::max();
+
+size_t CountTrailingZeros(UInt64 value)
+{
+    return size_t(__builtin_ctzll(value));
+}
+
+} // namespace
+
+ObjectIDAllocator::ObjectIDAllocator(std::shared_ptr<Tracer> tracer,
+    AudioObjectID hintMaximumID,
+    MemoryResource* memoryResource)
+    : tracer_(std::move(tracer))
+    , bits_(MakeAllocator(memoryResource))
+    , fullWords_(MakeAllocator(memoryResource))
+    , desiredMaximumID_(hintMaximumID)
+{
+}
+
+AudioObjectID ObjectIDAllocator::Allocate()
+{
+    AudioObjectID nextID = lastAllocatedID_ + 1;
+
+    if (nextID >= desiredMaximumID_ && numAllocatedIDs_ > desiredMaximumID_ / 2) {
+        if (desiredMaximumID_ <= std::numeric_limits<AudioObjectID>::max() / 2) {
+            if (tracer_) {
+                tracer_->Message("increasing desired maximum from %u to %u",
+                    unsigned(desiredMaximumID_),
+                    unsigned(desiredMaximumID_ * 2));
+            }
+            desiredMaximumID_ *= 2;
+        }
+    }
+
+    const bool isFree = IsFree(nextID);
+
+    if (tracer_) {
+        tracer_->Message("candidate nextID=%u isFree=%d desiredMaximumID=%u",
+            unsigned(nextID),
+            int(isFree),
+            unsigned(desiredMaximumID_));
+    }
+
+    if (nextID >= desiredMaximumID_) {
+        nextID = FindFreeID(0);
+    } else if (!isFree) {
+        nextID = FindFreeID(nextID + 1);
+    }
+
+    SetAllocated(nextID, true);
+    numAllocatedIDs_++;
+    lastAllocatedID_ = nextID;
+
+    if (tracer_) {
+        tracer_->Message("allocated objectID=%u numAllocated=%u",
+            unsigned(nextID),
+            unsigned(numAllocatedIDs_));
+    }
+
+    return nextID;
+}
+
+bool ObjectIDAllocator::Acquire(AudioObjectID objectID)
+{
+    if (!IsFree(objectID)) {
+        return false;
+    }
+
+    SetAllocated(objectID, true);
+    numAllocatedIDs_++;
+
+    if (tracer_) {
+        tracer_->Message("acquired objectID=%u numAllocated=%u",
+            unsigned(objectID),
+            unsigned(numAllocatedIDs_));
+    }
+
+    return true;
+}
+
+void ObjectIDAllocator::Free(AudioObjectID objectID)
+{
+    if (IsReserved(objectID) || IsFree(objectID)) {
+        return;
+    }
+
+    SetAllocated(objectID, false);
+    numAllocatedIDs_--;
+
+    if (tracer_) {
+        tracer_->Message("freed objectID=%u numAllocated=%u",
+            unsigned(objectID),
+            unsigned(numAllocatedIDs_));
+    }
+}
+
+bool ObjectIDAllocator::IsFree(AudioObjectID objectID) const
+{
+    const size_t word = objectID / BitsPerWord;
+    const size_t bit = objectID % BitsPerWord;
+
+    if (bits_.size() <= word) {
+        return !IsReserved(objectID);
+    }
+
+    return (bits_[word] & (Word(1) << bit)) == 0;
+}
+
+size_t ObjectIDAllocator::GetAllocatedCount() const
+{
+    return numAllocatedIDs_;
+}
+
+bool ObjectIDAllocator::IsReserved(AudioObjectID objectID)
+{
+    for (const auto reservedID : ReservedIDs) {
+        if (objectID == reservedID) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+AudioObjectID ObjectIDAllocator::FindFreeID(AudioObjectID startID) const
+{
+    const size_t numWords = bits_.size();
+    const size_t startWord = startID / BitsPerWord;
+
+    size_t word = NoWord;
+
+    if (startWord < numWords) {
+        // Free bits in start word at or after start position.
+        const Word freeBits = ~bits_[startWord] & (~Word(0) << (startID % BitsPerWord));
+
+        if (freeBits != 0) {
+            const auto objectID =
+                AudioObjectID(startWord * BitsPerWord + CountTrailingZeros(freeBits));
+
+            if (tracer_) {
+                tracer_->Message("selected id inside bitset startID=%u selectedID=%u",
+                    unsigned(startID),
+                    unsigned(objectID));
+            }
+
+            return objectID;
+        }
+
+        word = FindNonFullWord(startWord + 1, numWords);
+    }
+
+    // Wrap around.
+    if (word == NoWord) {
+        word = FindNonFullWord(0, std::min(startWord + 1, numWords));
+    }
+
+    if (word != NoWord) {
+        const auto objectID =
+            AudioObjectID(word * BitsPerWord + CountTrailingZeros(~bits_[word]));
+
+        if (tracer_) {
+            tracer_->Message("selected id inside bitset startID=%u selectedID=%u",
+                unsigned(startID),
+                unsigned(objectID));
+        }
+
+        return objectID;
+    }
+
+    // All words are full, so the first identifier after bitset is free,
+    // unless bitset is not allocated yet.
+    auto objectID = AudioObjectID(numWords * BitsPerWord);
+    while (IsReserved(objectID)) {
+        objectID++;
+    }
+
+    if (tracer_) {
+        tracer_->Message("selected id after bitset startID=%u selectedID=%u",
+            unsigned(startID),
+            unsigned(objectID));
+    }
+
+    return objectID;
+}
+
+size_t ObjectIDAllocator::FindNonFullWord(size_t fromWord, size_t toWord) const
+{
+    for (size_t summary = fromWord / BitsPerWord; summary * BitsPerWord < toWord;
+         summary++) {
+        Word nonFullWords = ~fullWords_[summary];
+
+        if (summary == fromWord / BitsPerWord) {
+            nonFullWords &= ~Word(0) << (fromWord % BitsPerWord);
+        }
+
+        if (nonFullWords != 0) {
+            const size_t word = summary * BitsPerWord + CountTrailingZeros(nonFullWords);
+
+            // Summary bits after the last word are zero, i.e. "not full",
+            // so the found word may be outside of requested range.
+            return word < toWord ? word : NoWord;
+        }
+    }
+
+    return NoWord;
+}
+
+void ObjectIDAllocator::SetAllocated(AudioObjectID objectID, bool allocated)
+{
+    const size_t word = objectID / BitsPerWord;
+    const size_t bit = objectID % BitsPerWord;
+
+    if (bits_.size() <= word) {
+        const bool isEmpty = bits_.empty();
+
+        bits_.resize(word + 1);
+        fullWords_.resize((bits_.size() + BitsPerWord - 1) / BitsPerWord);
+
+        // Bitmap is allocated lazily, and reserved identifiers are marked
+        // when it's allocated for the first time.
+        if (isEmpty) {
+            for (const auto reservedID : ReservedIDs) {
+                bits_[reservedID / BitsPerWord] |= Word(1) << (reservedID % BitsPerWord);
+            }
+        }
+    }
+
+    if (allocated) {
+        bits_[word] |= (Word(1) << bit);
+    } else {
+        bits_[word] &= ~(Word(1) << bit);
+    }
+
+    const size_t summary = word / BitsPerWord;
+    const Word summaryBit = Word(1) << (word % BitsPerWord);
+
+    if (bits_[word] == ~Word(0)) {
+        fullWords_[summary] |= summaryBit;
+    } else {
+        fullWords_[summary] &= ~summaryBit;
+    }
+}
+
+} // namespace aspl
@@ -0,0 +1,93 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/MemoryResource.hpp>
+#include <aspl/Tracer.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <memory>
+
+namespace aspl {
+
+// Allocator of object identifiers, used by Dispatcher.
+//
+// Identifiers are allocated sequentially while they're below desired maximum.
+// When the maximum is reached, allocator either wraps around and reuses the
+// lowest free identifier, or, if more than half of identifiers below the
+// maximum are in use, doubles the maximum. This keeps identifiers low and
+// delays reuse of recently freed identifiers.
+//
+// Allocated identifiers are stored in a two-level bitmap. Every bit of the
+// lower level corresponds to one identifier. Every bit of the upper level
+// (summary) is set when the corresponding word of the lower level is full.
+// Free identifier is found with count-trailing-zeros instruction, first in
+// the summary and then in the selected word, so that full words are skipped
+// 64 at a time, and allocation and freeing take amortized constant time.
+//
+// Reserved identifiers are marked in the bitmap when it's first allocated
+// and are never allocated or freed.
+//
+// Not thread-safe.
+class ObjectIDAllocator
+{
+public:
+    ObjectIDAllocator(std::shared_ptr<Tracer> tracer,
+        AudioObjectID hintMaximumID,
+        MemoryResource* memoryResource);
+
+    ObjectIDAllocator(const ObjectIDAllocator&) = delete;
+    ObjectIDAllocator& operator=(const ObjectIDAllocator&) = delete;
+
+    // Allocate new identifier.
+    AudioObjectID Allocate();
+
+    // Mark given identifier as allocated, if it is free.
+    // Used for identifiers chosen by user instead of allocator.
+    // Returns false if identifier is reserved or already allocated.
+    bool Acquire(AudioObjectID objectID);
+
+    // Free previously allocated or acquired identifier.
+    // Does nothing if identifier is reserved or not allocated.
+    void Free(AudioObjectID objectID);
+
+    // Check if identifier is neither allocated nor reserved.
+    bool IsFree(AudioObjectID objectID) const;
+
+    // Get number of allocated identifiers, excluding reserved ones.
+    size_t GetAllocatedCount() const;
+
+private:
+    using Word = UInt64;
+    static constexpr size_t BitsPerWord = sizeof(Word) * 8;
+
+    static bool IsReserved(AudioObjectID objectID);
+
+    AudioObjectID FindFreeID(AudioObjectID startID) const;
+    size_t FindNonFullWord(size_t fromWord, size_t toWord) const;
+
+    void SetAllocated(AudioObjectID objectID, bool allocated);
+
+    // Optional tracer.
+    const std::shared_ptr<Tracer> tracer_;
+
+    // Lower level, one bit per identifier, set if allocated or reserved.
+    Vector<Word> bits_;
+
+    // Upper level, one bit per word of lower level, set if word is full.
+    Vector<Word> fullWords_;
+
+    size_t numAllocatedIDs_ = 0;
+    AudioObjectID lastAllocatedID_ = 0;
+
+    // The maximum value below which we're currently trying to keep identifiers.
+    // If the next identifier exceeds this value, and there are quite a lot of
+    // free identifiers below the maximum, we'll reuse one of them. Otherwise,
+    // if there are too little free identifiers below the maximum, we'll increase
+    // the maximum instead.
+    AudioObjectID desiredMaximumID_;
+};
+
+} // namespace aspl
@@ -3,6 +3,10 @@
 
 #include <aspl/Plugin.hpp>
 
+#include "Convert.hpp"
+#include "TraceFilter.hpp"
+#include "Tracing.hpp"
+
 #include <algorithm>
 
 namespace aspl {
@@ -10,7 +14,14 @@ namespace aspl {
 Plugin::Plugin(std::shared_ptr<const Context> context, const PluginParameters& params)
     : Object(std::move(context), "Plugin", kAudioObjectPlugInObject)
     , params_(params)
+    , deviceSnapshot_(std::make_shared<const DeviceRegistry>())
 {
+    if (params_.EnableTraceFilterProperty) {
+        RegisterCustomProperty(params_.TraceFilterSelector,
+            *this,
+            &Plugin::GetTraceFilterProperty,
+            &Plugin::SetTraceFilterProperty);
+    }
 }
 
 std::string Plugin::GetManufacturer() const
@@ -30,59 +41,61 @@ std::vector<AudioObjectID> Plugin::GetDeviceIDs() const
 
 AudioObjectID Plugin::GetDeviceIDByUID(const std::string& uid) const
 {
-    auto readLock = deviceByUID_.GetReadLock();
+    auto readLock = deviceSnapshot_.GetReadLock();
+
+    const auto& deviceIDByUID = readLock.GetReference()->deviceIDByUID;
 
-    const auto& deviceByUID = readLock.GetReference();
+    const auto pos = deviceIDByUID.find(uid);
 
-    if (!deviceByUID.count(uid)) {
+    if (pos == deviceIDByUID.end()) {
         return {};
     }
 
-    const auto device = deviceByUID.at(uid);
-
-    return device->GetID();
+    return pos->second;
 }
 
 UInt32 Plugin::GetDeviceCount() const
 {
-    auto readLock = devices_.GetReadLock();
+    auto readLock = deviceSnapshot_.GetReadLock();
 
-    const auto& devices = readLock.GetReference();
+    const auto& devices = readLock.GetReference()->devices;
 
     return UInt32(devices.size());
 }
 
 std::shared_ptr<Device> Plugin::GetDeviceByIndex(UInt32 idx) const
 {
-    auto readLock = devices_.GetReadLock();
+    auto readLock = deviceSnapshot_.GetReadLock();
 
-    const auto& devices = readLock.GetReference();
+    const auto& devices = readLock.GetReference()->devices;
 
     if (devices.size() <= idx) {
         return {};
     }
 
-    return devices[idx];
+    return devices[idx].device;
 }
 
 std::shared_ptr<Device> Plugin::GetDeviceByID(AudioObjectID deviceID) const
 {
-    auto readLock = deviceByID_.GetReadLock();
+    auto readLock = deviceSnapshot_.GetReadLock();
+
+    const auto& deviceByID = readLock.GetReference()->deviceByID;
 
-    const auto& deviceByID = readLock.GetReference();
+    const auto pos = deviceByID.find(deviceID);
 
-    if (!deviceByID.count(deviceID)) {
+    if (pos == deviceByID.end()) {
         return {};
     }
 
-    return deviceByID.at(deviceID);
+    return pos->second;
 }
 
 bool Plugin::HasDevice(std::shared_ptr<Device> device) const
 {
-    auto readLock = deviceByID_.GetReadLock();
+    auto readLock = deviceSnapshot_.GetReadLock();
 
-    const auto& deviceByID = readLock.GetReference();
+    const auto& deviceByID = readLock.GetReference()->deviceByID;
 
     return deviceByID.count(device->GetID());
 }
@@ -95,12 +108,12 @@ void Plugin::AddDevice(std::shared_ptr<Device> device)
     op.Name = "Plugin::AddDevice()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (auto devOwner = device->GetOwnerID(); devOwner != kAudioObjectUnknown) {
         if (devOwner == GetID()) {
             // Protection from adding same device twice.
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "Plugin::AddDevice() device already added"
                 " devID=%lu pluginID=%lu",
                 static_cast<unsigned long>(device->GetID()),
@@ -108,7 +121,7 @@ void Plugin::AddDevice(std::shared_ptr<Device> device)
         } else {
             // This is likely a bug in user code. Only Plugin can be
             // Device owner, and there is only one plugin.
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetTracer(),
                 "Plugin::AddDevice() unexpected device owner"
                 " devID=%lu devOwnerID=%lu pluginID=%lu",
                 static_cast<unsigned long>(device->GetID()),
@@ -118,37 +131,18 @@ void Plugin::AddDevice(std::shared_ptr<Device> device)
         goto end;
     }
 
-    {
-        auto devices = devices_.Get();
+    // If we're not inside a batch, this one will publish the change
+    // and notify HAL.
+    BeginDeviceBatch();
 
-        devices.push_back(device);
-        devices_.Set(std::move(devices));
-    }
-
-    {
-        auto deviceByID = deviceByID_.Get();
-
-        deviceByID[device->GetID()] = device;
-        deviceByID_.Set(std::move(deviceByID));
-    }
-
-    {
-        auto deviceByUID = deviceByUID_.Get();
-
-        if (auto uid = device->GetDeviceUID(); !uid.empty()) {
-            deviceByUID[uid] = device;
-        }
-
-        deviceByUID_.Set(std::move(deviceByUID));
-    }
+    AddDeviceToRegistry(device);
 
     device->RequestOwnershipChange(this, true);
 
-    NotifyPropertiesChanged(
-        {kAudioObjectPropertyOwnedObjects, kAudioPlugInPropertyDeviceList});
+    EndDeviceBatch();
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
 }
 
 void Plugin::RemoveDevice(std::shared_ptr<Device> device)
@@ -159,11 +153,11 @@ void Plugin::RemoveDevice(std::shared_ptr<Device> device)
     op.Name = "Plugin::RemoveDevice()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (device->GetOwnerID() == kAudioObjectUnknown) {
         // Protection from removing same device twice.
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetTracer(),
             "Plugin::RemoveDevice() device already removed"
             " devID=%lu pluginID=%lu",
             static_cast<unsigned long>(device->GetID()),
@@ -171,41 +165,156 @@ void Plugin::RemoveDevice(std::shared_ptr<Device> device)
         goto end;
     }
 
-    {
-        auto devices = devices_.Get();
+    BeginDeviceBatch();
 
-        if (auto pos = std::find(devices.begin(), devices.end(), device);
-            pos != devices.end()) {
-            devices.erase(pos);
-        }
+    RemoveDeviceFromRegistry(device);
+
+    device->RequestOwnershipChange(this, false);
 
-        devices_.Set(std::move(devices));
+    EndDeviceBatch();
+
+end:
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
+}
+
+void Plugin::AddDevices(const std::vector<std::shared_ptr<Device>>& devices)
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    BeginDeviceBatch();
+
+    for (const auto& device : devices) {
+        AddDevice(device);
     }
 
-    {
-        auto deviceByID = deviceByID_.Get();
+    EndDeviceBatch();
+}
+
+void Plugin::RemoveDevices(const std::vector<std::shared_ptr<Device>>& devices)
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    BeginDeviceBatch();
 
-        deviceByID.erase(device->GetID());
-        deviceByID_.Set(std::move(deviceByID));
+    for (const auto& device : devices) {
+        RemoveDevice(device);
     }
 
-    {
-        auto deviceByUID = deviceByUID_.Get();
+    EndDeviceBatch();
+}
 
-        if (auto uid = device->GetDeviceUID(); !uid.empty()) {
-            deviceByUID.erase(uid);
-        }
+void Plugin::BeginDeviceBatch()
+{
+    std::lock_guard writeLock(writeMutex_);
 
-        deviceByUID_.Set(std::move(deviceByUID));
+    // Owned objects list is published together with device list.
+    BeginOwnedObjectsUpdate();
+
+    deviceBatchDepth_++;
+}
+
+void Plugin::EndDeviceBatch()
+{
+    std::lock_guard writeLock(writeMutex_);
+
+    if (deviceBatchDepth_ == 0) {
+        ASPL_TRACE_MESSAGE(GetTracer(),
+            "Plugin::EndDeviceBatch() unbalanced call pluginID=%lu",
+            static_cast<unsigned long>(GetID()));
+        return;
     }
 
-    device->RequestOwnershipChange(this, false);
+    EndOwnedObjectsUpdate();
+
+    deviceBatchDepth_--;
+
+    if (deviceBatchDepth_ != 0 || !deviceBatchChanged_) {
+        return;
+    }
+
+    deviceBatchChanged_ = false;
+
+    // This is the only place where registry is copied.
+    deviceSnapshot_.Set(std::make_shared<const DeviceRegistry>(deviceRegistry_));
+
+    ASPL_TRACE_MESSAGE(GetTracer(),
+        "Plugin::EndDeviceBatch() publishing %lu devices",
+        static_cast<unsigned long>(deviceRegistry_.devices.size()));
 
     NotifyPropertiesChanged(
         {kAudioObjectPropertyOwnedObjects, kAudioPlugInPropertyDeviceList});
+}
 
-end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+void Plugin::AddDeviceToRegistry(std::shared_ptr<Device> device)
+{
+    DeviceEntry entry;
+    entry.device = device;
+
+    if (auto uid = device->GetDeviceUID(); !uid.empty()) {
+        entry.uid = std::make_shared<const std::string>(std::move(uid));
+
+        // If there is another device with the same UID, re-insert the key,
+        // so that it points to the string owned by the new entry.
+        deviceRegistry_.deviceIDByUID.erase(*entry.uid);
+        deviceRegistry_.deviceIDByUID.emplace(*entry.uid, device->GetID());
+    }
+
+    deviceRegistry_.deviceByID[device->GetID()] = device;
+    deviceRegistry_.devices.push_back(std::move(entry));
+
+    deviceBatchChanged_ = true;
+}
+
+void Plugin::RemoveDeviceFromRegistry(std::shared_ptr<Device> device)
+{
+    auto& devices = deviceRegistry_.devices;
+
+    const auto pos = std::find_if(devices.begin(),
+        devices.end(),
+        [&device](const DeviceEntry& entry) { return entry.device == device; });
+
+    if (pos == devices.end()) {
+        return;
+    }
+
+    if (pos->uid) {
+        auto& deviceIDByUID = deviceRegistry_.deviceIDByUID;
+
+        // UID may belong to another device which was added later.
+        if (auto uidPos = deviceIDByUID.find(*pos->uid);
+            uidPos != deviceIDByUID.end() && uidPos->second == device->GetID()) {
+            deviceIDByUID.erase(uidPos);
+        }
+    }
+
+    deviceRegistry_.deviceByID.erase(device->GetID());
+    devices.erase(pos);
+
+    deviceBatchChanged_ = true;
+}
+
+CFStringRef Plugin::GetTraceFilterProperty() const
+{
+    CFStringRef result = nullptr;
+    Convert::ToFoundation(FormatTraceFilter(GetTracer()->GetFilter()), result);
+
+    return result;
+}
+
+void Plugin::SetTraceFilterProperty(CFStringRef value)
+{
+    std::string str;
+    Tracer::Filter filter;
+
+    if (!Convert::FromFoundation(value, str) || !ParseTraceFilter(str, filter)) {
+        ASPL_TRACE_MESSAGE(GetTracer(), "Plugin::SetTraceFilter() invalid filter");
+        return;
+    }
+
+    ASPL_TRACE_MESSAGE(
+        GetTracer(), "Plugin::SetTraceFilter() filter=\"%s\"", str.c_str());
+
+    GetTracer()->SetFilter(filter);
 }
 
 } // namespace aspl
@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: Plugin.json
-// Timestamp: Sun Apr 13 14:12:48 2025 UTC
+// Timestamp: Mon Oct 19 08:16:50 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/Plugin.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -51,10 +53,10 @@ Boolean Plugin::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -63,25 +65,25 @@ Boolean Plugin::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioObjectPropertyManufacturer:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioPlugInPropertyResourceBundle:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioPlugInPropertyDeviceList:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioPlugInPropertyTranslateUIDToDevice:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -91,7 +93,7 @@ Boolean Plugin::HasProperty(AudioObjectID objectID,
     result = Object::HasProperty(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -109,10 +111,10 @@ OSStatus Plugin::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -122,40 +124,40 @@ OSStatus Plugin::IsPropertySettable(AudioObjectID objectID,
         case kAudioObjectPropertyManufacturer:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioPlugInPropertyResourceBundle:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioPlugInPropertyDeviceList:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioPlugInPropertyTranslateUIDToDevice:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -165,7 +167,7 @@ OSStatus Plugin::IsPropertySettable(AudioObjectID objectID,
     status = Object::IsPropertySettable(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -188,10 +190,10 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -202,10 +204,10 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -213,10 +215,10 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -226,10 +228,10 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetDeviceIDs();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioObjectID));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -237,10 +239,10 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectID);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -251,7 +253,7 @@ OSStatus Plugin::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -278,10 +280,10 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -291,7 +293,7 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
         case kAudioObjectPropertyManufacturer:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -300,25 +302,25 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetManufacturer();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Manufacturer=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioPlugInPropertyResourceBundle:
             {
                 if (inDataSize < sizeof(CFStringRef)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(CFStringRef)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -327,18 +329,18 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(CFStringRef);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetResourceBundlePath();
                     Convert::ToFoundation(
                         value,
                         *static_cast<CFStringRef*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ResourceBundlePath=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -352,7 +354,7 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioObjectID));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -360,20 +362,20 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioObjectID*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DeviceIDs=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioPlugInPropertyTranslateUIDToDevice:
             {
                 if (inDataSize < sizeof(AudioObjectID)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectID)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -382,11 +384,11 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectID);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     if (qualifierDataSize != sizeof(CFStringRef)) {
-                        GetContext()->Tracer->Message(
+                        ASPL_TRACE_MESSAGE(GetTracer(),
                             "invalid qualifier size: should be %u, got %u",
                             unsigned(sizeof(CFStringRef)),
                             unsigned(qualifierDataSize));
@@ -398,18 +400,18 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
                     Convert::FromFoundation(
                         *static_cast<const CFStringRef*>(qualifierData),
                         qualifierValue);
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "obtained qualifier DeviceIDByUID=%s",
                         Convert::ToString(qualifierValue).c_str());
                     const auto value = GetDeviceIDByUID(qualifierValue);
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectID*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DeviceIDByUID=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -421,7 +423,7 @@ OSStatus Plugin::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -445,10 +447,10 @@ OSStatus Plugin::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -462,7 +464,7 @@ OSStatus Plugin::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -0,0 +1,60 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/Profiler.hpp>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define ASPL_HAS_SDT
+#endif
+#endif
+
+namespace aspl {
+
+void Profiler::HandlerBegin(const ProfilerEvent& event)
+{
+}
+
+void Profiler::HandlerEnd(const ProfilerEvent& event)
+{
+}
+
+bool UsdtProfiler::IsSupported()
+{
+#if defined(ASPL_HAS_SDT)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UsdtProfiler::HandlerBegin(const ProfilerEvent& event)
+{
+#if defined(ASPL_HAS_SDT)
+    DTRACE_PROBE6(aspl,
+        handler_begin,
+        UInt32(event.Callback),
+        event.StreamID,
+        event.ClientID,
+        event.OperationID,
+        event.FrameCount,
+        event.HostTime);
+#endif
+}
+
+void UsdtProfiler::HandlerEnd(const ProfilerEvent& event)
+{
+#if defined(ASPL_HAS_SDT)
+    DTRACE_PROBE6(aspl,
+        handler_end,
+        UInt32(event.Callback),
+        event.StreamID,
+        event.ClientID,
+        event.OperationID,
+        event.FrameCount,
+        event.HostTime);
+#endif
+}
+
+} // namespace aspl
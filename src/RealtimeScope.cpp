@@ -0,0 +1,56 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/RealtimeScope.hpp>
+
+#include <cstdint>
+
+#include <pthread.h>
+
+namespace aspl {
+
+namespace {
+
+pthread_once_t depthKeyOnce = PTHREAD_ONCE_INIT;
+pthread_key_t depthKey;
+
+void CreateDepthKey()
+{
+    pthread_key_create(&depthKey, nullptr);
+}
+
+uintptr_t GetDepth()
+{
+    pthread_once(&depthKeyOnce, CreateDepthKey);
+
+    return reinterpret_cast<uintptr_t>(pthread_getspecific(depthKey));
+}
+
+void SetDepth(uintptr_t depth)
+{
+    pthread_setspecific(depthKey, reinterpret_cast<void*>(depth));
+}
+
+} // namespace
+
+RealtimeScope::RealtimeScope(bool enable) noexcept
+    : enabled_(enable)
+{
+    if (enabled_) {
+        SetDepth(GetDepth() + 1);
+    }
+}
+
+RealtimeScope::~RealtimeScope() noexcept
+{
+    if (enabled_) {
+        SetDepth(GetDepth() - 1);
+    }
+}
+
+bool RealtimeScope::IsRealtimeThread() noexcept
+{
+    return GetDepth() != 0;
+}
+
+} // namespace aspl
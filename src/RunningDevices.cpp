@@ -0,0 +1,80 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "RunningDevices.hpp"
+
+namespace aspl {
+
+void RunningDevices::Pin(AudioObjectID objectID, std::shared_ptr<Device> device)
+{
+    if (objectID == kAudioObjectUnknown || !device) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+
+    auto& entry = entries_[objectID];
+
+    entry.PinCount++;
+
+    if (entry.PinCount > 1) {
+        return;
+    }
+
+    entry.DeviceRef = std::move(device);
+
+    for (auto& slot : slots_) {
+        if (slot.ObjectID.load(std::memory_order_relaxed) != kAudioObjectUnknown) {
+            continue;
+        }
+
+        // publish pointer before ID, so that Find() never sees ID without pointer
+        slot.DevicePtr.store(entry.DeviceRef.get(), std::memory_order_release);
+        slot.ObjectID.store(objectID, std::memory_order_release);
+
+        entry.SlotPtr = &slot;
+        break;
+    }
+}
+
+void RunningDevices::Unpin(AudioObjectID objectID)
+{
+    std::shared_ptr<Device> device;
+
+    {
+        std::lock_guard lock(mutex_);
+
+        auto it = entries_.find(objectID);
+        if (it == entries_.end()) {
+            return;
+        }
+
+        auto& entry = it->second;
+
+        entry.PinCount--;
+
+        if (entry.PinCount > 0) {
+            return;
+        }
+
+        if (entry.SlotPtr) {
+            entry.SlotPtr->ObjectID.store(kAudioObjectUnknown, std::memory_order_release);
+            entry.SlotPtr->DevicePtr.store(nullptr, std::memory_order_release);
+        }
+
+        device = std::move(entry.DeviceRef);
+        entries_.erase(it);
+    }
+
+    // device may be destroyed here, outside of the lock
+    device.reset();
+}
+
+size_t RunningDevices::GetDeviceCount() const
+{
+    std::lock_guard lock(mutex_);
+
+    return entries_.size();
+}
+
+} // namespace aspl
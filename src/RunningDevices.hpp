@@ -0,0 +1,96 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/Device.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace aspl {
+
+// Per-driver cache of devices with running I/O.
+//
+// Bridge pins device when StartIO succeeds and unpins it when StopIO
+// succeeds, so the number of pins equals the device start count. While
+// device is pinned, cache holds a reference to it, hence the device can't
+// be destroyed until the last StopIO, even if it is removed from plugin.
+//
+// Find() is invoked from realtime I/O trampolines instead of looking up
+// object in Dispatcher. It scans a small fixed array of slots using only
+// atomic loads, without locks and without touching shared_ptr refcounts.
+//
+// If there are more running devices than slots, extra devices are still
+// pinned, but Find() returns null for them and Bridge falls back to
+// Dispatcher lookup.
+class RunningDevices
+{
+public:
+    static constexpr size_t NumSlots = 16;
+
+    RunningDevices() = default;
+
+    RunningDevices(const RunningDevices&) = delete;
+    RunningDevices& operator=(const RunningDevices&) = delete;
+
+    // Increment pin count of device.
+    // Non-realtime.
+    void Pin(AudioObjectID objectID, std::shared_ptr<Device> device);
+
+    // Decrement pin count of device and remove it when count becomes zero.
+    // Non-realtime.
+    void Unpin(AudioObjectID objectID);
+
+    // Find pinned device by ID.
+    // Realtime-safe. Returns null if device is not pinned or has no slot.
+    Device* Find(AudioObjectID objectID) const
+    {
+        for (const auto& slot : slots_) {
+            if (slot.ObjectID.load(std::memory_order_acquire) != objectID) {
+                continue;
+            }
+
+            Device* device = slot.DevicePtr.load(std::memory_order_acquire);
+
+            // re-check that slot was not reassigned while we were reading it
+            if (slot.ObjectID.load(std::memory_order_acquire) != objectID) {
+                return nullptr;
+            }
+
+            return device;
+        }
+
+        return nullptr;
+    }
+
+    // Get number of pinned devices.
+    // Non-realtime.
+    size_t GetDeviceCount() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<AudioObjectID> ObjectID = kAudioObjectUnknown;
+        std::atomic<Device*> DevicePtr = nullptr;
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<Device> DeviceRef;
+        UInt32 PinCount = 0;
+        Slot* SlotPtr = nullptr;
+    };
+
+    mutable std::mutex mutex_;
+    std::map<AudioObjectID, Entry> entries_;
+
+    std::array<Slot, NumSlots> slots_;
+};
+
+} // namespace aspl
@@ -0,0 +1,153 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/ScratchArena.hpp>
+
+#include <cstdlib>
+#include <utility>
+
+namespace aspl {
+
+ScratchBuffer::ScratchBuffer(ScratchArena* arena, Float32* data) noexcept
+    : arena_(arena)
+    , data_(data)
+{
+}
+
+ScratchBuffer::~ScratchBuffer() noexcept
+{
+    Reset();
+}
+
+ScratchBuffer::ScratchBuffer(ScratchBuffer&& other) noexcept
+    : arena_(std::exchange(other.arena_, nullptr))
+    , data_(std::exchange(other.data_, nullptr))
+{
+}
+
+ScratchBuffer& ScratchBuffer::operator=(ScratchBuffer&& other) noexcept
+{
+    if (this != &other) {
+        Reset();
+
+        arena_ = std::exchange(other.arena_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+    }
+
+    return *this;
+}
+
+ScratchBuffer::operator bool() const noexcept
+{
+    return data_ != nullptr;
+}
+
+Float32* ScratchBuffer::GetData() const noexcept
+{
+    return data_;
+}
+
+UInt32 ScratchBuffer::GetFrameCount() const noexcept
+{
+    return arena_ ? arena_->GetFrameCount() : 0;
+}
+
+UInt32 ScratchBuffer::GetChannelCount() const noexcept
+{
+    return arena_ ? arena_->GetChannelCount() : 0;
+}
+
+UInt32 ScratchBuffer::GetByteCount() const noexcept
+{
+    return GetFrameCount() * GetChannelCount() * UInt32(sizeof(Float32));
+}
+
+void ScratchBuffer::Reset() noexcept
+{
+    if (arena_ && data_) {
+        arena_->Return(data_);
+    }
+
+    arena_ = nullptr;
+    data_ = nullptr;
+}
+
+ScratchArena::ScratchArena(UInt32 bufferCount, UInt32 frameCount, UInt32 channelCount)
+{
+    if (bufferCount == 0 || frameCount == 0 || channelCount == 0) {
+        return;
+    }
+
+    // Round buffer size up to alignment, so that every buffer is aligned.
+    constexpr size_t samplesPerAlignment = Alignment / sizeof(Float32);
+
+    const size_t stride = (size_t(frameCount) * channelCount + samplesPerAlignment - 1) /
+                          samplesPerAlignment * samplesPerAlignment;
+
+    void* memory = nullptr;
+    if (posix_memalign(&memory, Alignment, stride * bufferCount * sizeof(Float32)) != 0) {
+        // Leave arena empty, Borrow() will return empty handles.
+        return;
+    }
+
+    memory_ = static_cast<Float32*>(memory);
+    stride_ = stride;
+
+    bufferCount_ = bufferCount;
+    frameCount_ = frameCount;
+    channelCount_ = channelCount;
+
+    freeList_.resize(bufferCount_);
+
+    // Fill stack so that buffers are borrowed in order of their addresses.
+    for (UInt32 n = 0; n < bufferCount_; n++) {
+        freeList_[n] = bufferCount_ - n - 1;
+    }
+
+    freeCount_ = bufferCount_;
+}
+
+ScratchArena::~ScratchArena()
+{
+    free(memory_);
+}
+
+UInt32 ScratchArena::GetBufferCount() const noexcept
+{
+    return bufferCount_;
+}
+
+UInt32 ScratchArena::GetAvailableCount() const noexcept
+{
+    return freeCount_;
+}
+
+UInt32 ScratchArena::GetFrameCount() const noexcept
+{
+    return frameCount_;
+}
+
+UInt32 ScratchArena::GetChannelCount() const noexcept
+{
+    return channelCount_;
+}
+
+ScratchBuffer ScratchArena::Borrow() noexcept
+{
+    if (freeCount_ == 0) {
+        return {};
+    }
+
+    const UInt32 index = freeList_[--freeCount_];
+
+    return ScratchBuffer(this, memory_ + stride_ * index);
+}
+
+void ScratchArena::Return(Float32* data) noexcept
+{
+    const UInt32 index = UInt32((data - memory_) / stride_);
+
+    freeList_[freeCount_++] = index;
+}
+
+} // namespace aspl
@@ -0,0 +1,69 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace aspl {
+
+// Layout of shared memory region used by SharedRingWriter and SharedRingReader.
+//
+// The region starts with this header, followed by Capacity frames of audio.
+// Frame with sample time T is stored in slot T % Capacity. Writer is the only
+// process that modifies the region; reader maps it read-only.
+//
+// Writer first advances WriteBegin to the end of the frames it's going to
+// write, then copies frames, then advances WriteEnd. Reader copies frames
+// before WriteEnd and then checks WriteBegin: frames that are more than
+// Capacity frames behind WriteBegin could be overwritten during copy.
+struct SharedRingLayout
+{
+    static constexpr UInt32 Magic = 0x4153504c; // "ASPL"
+    static constexpr UInt32 Version = 1;
+
+    // Set by writer before region is published, never changed afterwards.
+    UInt32 HeaderMagic;
+    UInt32 HeaderVersion;
+    UInt32 HeaderSize;
+    UInt32 Capacity;
+    UInt32 BytesPerFrame;
+    UInt32 Reserved;
+    AudioStreamBasicDescription Format;
+
+    // Non-zero while writer is open.
+    alignas(64) std::atomic<UInt32> WriterActive;
+
+    // Sample time of the first written frame.
+    // Set before WriteEnd becomes non-zero.
+    std::atomic<UInt64> WriteStart;
+
+    // End of frames that writer is writing now.
+    alignas(64) std::atomic<UInt64> WriteBegin;
+
+    // End of frames that are completely written, zero if nothing was written.
+    alignas(64) std::atomic<UInt64> WriteEnd;
+
+    // Frames start here.
+    alignas(64) UInt8 Data[1];
+};
+
+static_assert(std::atomic<UInt64>::is_always_lock_free,
+    "64-bit atomics should be lock-free to be shared between processes");
+
+inline size_t GetSharedRingSize(UInt32 capacity, UInt32 bytesPerFrame)
+{
+    return offsetof(SharedRingLayout, Data) + size_t(capacity) * bytesPerFrame;
+}
+
+// Name of POSIX semaphore used to wake up reader.
+inline std::string GetSharedRingSemaphoreName(const std::string& name)
+{
+    return name + ".sem";
+}
+
+} // namespace aspl
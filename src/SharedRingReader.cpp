@@ -0,0 +1,278 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/SharedRingReader.hpp>
+
+#include "SharedRingLayout.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aspl {
+
+SharedRingReader::SharedRingReader(const std::string& name)
+    : name_(name)
+{
+}
+
+SharedRingReader::~SharedRingReader()
+{
+    Close();
+}
+
+OSStatus SharedRingReader::Open()
+{
+    if (layout_) {
+        return kAudioHardwareNoError;
+    }
+
+    const int fd = shm_open(name_.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    struct stat st = {};
+    void* addr = MAP_FAILED;
+
+    if (fstat(fd, &st) == 0 && size_t(st.st_size) >= sizeof(SharedRingLayout)) {
+        addr = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    const auto layout = static_cast<const SharedRingLayout*>(addr);
+    const size_t size = size_t(st.st_size);
+
+    if (layout->HeaderMagic != SharedRingLayout::Magic ||
+        layout->HeaderVersion != SharedRingLayout::Version ||
+        layout->HeaderSize != offsetof(SharedRingLayout, Data) ||
+        layout->Capacity == 0 || layout->BytesPerFrame == 0 ||
+        size < GetSharedRingSize(layout->Capacity, layout->BytesPerFrame)) {
+        munmap(addr, size);
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    semaphore_ = sem_open(GetSharedRingSemaphoreName(name_).c_str(), 0);
+    if (semaphore_ == SEM_FAILED) {
+        munmap(addr, size);
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    layout_ = layout;
+    layoutSize_ = size;
+
+    format_ = layout_->Format;
+
+    started_ = false;
+    readPos_ = 0;
+
+    stats_ = {};
+
+    return kAudioHardwareNoError;
+}
+
+void SharedRingReader::Close()
+{
+    if (!layout_) {
+        return;
+    }
+
+    sem_close(semaphore_);
+    semaphore_ = SEM_FAILED;
+
+    munmap(const_cast<SharedRingLayout*>(layout_), layoutSize_);
+    layout_ = nullptr;
+    layoutSize_ = 0;
+}
+
+bool SharedRingReader::IsOpen() const
+{
+    return layout_ != nullptr;
+}
+
+bool SharedRingReader::IsWriterActive() const
+{
+    return layout_ && layout_->WriterActive.load(std::memory_order_acquire) != 0;
+}
+
+const AudioStreamBasicDescription& SharedRingReader::GetFormat() const
+{
+    return format_;
+}
+
+UInt32 SharedRingReader::GetCapacity() const
+{
+    return layout_ ? layout_->Capacity : 0;
+}
+
+UInt64 SharedRingReader::GetAvailableFrames() const
+{
+    UInt64 readBegin, readEnd;
+
+    if (!GetReadRange(readBegin, readEnd)) {
+        return 0;
+    }
+
+    return std::min<UInt64>(readEnd - readBegin, layout_->Capacity);
+}
+
+bool SharedRingReader::Wait(UInt32 timeout)
+{
+    if (!layout_) {
+        return false;
+    }
+
+    if (GetAvailableFrames() != 0) {
+        return true;
+    }
+
+    if (!IsWriterActive()) {
+        return false;
+    }
+
+#if defined(__APPLE__)
+    // macOS doesn't provide sem_timedwait(), poll semaphore instead.
+    constexpr UInt32 PollInterval = 500;
+
+    for (UInt32 waited = 0; sem_trywait(semaphore_) != 0 && waited < timeout;) {
+        const UInt32 step = std::min(timeout - waited, PollInterval);
+        usleep(step);
+        waited += step;
+    }
+#else
+    timespec deadline = {};
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    deadline.tv_sec += timeout / 1000000;
+    deadline.tv_nsec += long(timeout % 1000000) * 1000;
+
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    while (sem_timedwait(semaphore_, &deadline) == -1 && errno == EINTR) {
+    }
+#endif
+
+    // Drain wakeups accumulated while we were reading.
+    while (sem_trywait(semaphore_) == 0) {
+    }
+
+    return GetAvailableFrames() != 0;
+}
+
+UInt32 SharedRingReader::Read(void* bytes, UInt32 bytesCount, UInt64& sampleTime)
+{
+    UInt64 readBegin, readEnd;
+
+    if (!GetReadRange(readBegin, readEnd)) {
+        return 0;
+    }
+
+    const UInt32 capacity = layout_->Capacity;
+    const UInt32 bytesPerFrame = layout_->BytesPerFrame;
+
+    // Reader fell behind and frames were overwritten.
+    if (readEnd - readBegin > capacity) {
+        stats_.NumLostFrames += readEnd - capacity - readBegin;
+        readBegin = readEnd - capacity;
+    }
+
+    started_ = true;
+    readPos_ = readBegin;
+
+    UInt32 frameCount =
+        UInt32(std::min<UInt64>(readEnd - readBegin, bytesCount / bytesPerFrame));
+
+    if (frameCount == 0) {
+        return 0;
+    }
+
+    UInt8* frames = static_cast<UInt8*>(bytes);
+
+    // Frames may wrap around the end of the ring.
+    const UInt32 slot = UInt32(readPos_ % capacity);
+    const UInt32 firstCount = std::min(frameCount, capacity - slot);
+
+    memcpy(frames,
+        layout_->Data + size_t(slot) * bytesPerFrame,
+        size_t(firstCount) * bytesPerFrame);
+
+    memcpy(frames + size_t(firstCount) * bytesPerFrame,
+        layout_->Data,
+        size_t(frameCount - firstCount) * bytesPerFrame);
+
+    // If writer started overwriting some of the copied frames, they are
+    // behind WriteBegin by more than capacity. Such frames are at the
+    // beginning of the output, drop them.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    const UInt64 writeBegin = layout_->WriteBegin.load(std::memory_order_relaxed);
+
+    if (writeBegin > capacity && writeBegin - capacity > readPos_) {
+        const UInt32 numOverwritten =
+            UInt32(std::min<UInt64>(frameCount, writeBegin - capacity - readPos_));
+
+        memmove(frames,
+            frames + size_t(numOverwritten) * bytesPerFrame,
+            size_t(frameCount - numOverwritten) * bytesPerFrame);
+
+        stats_.NumLostFrames += numOverwritten;
+
+        readPos_ += numOverwritten;
+        frameCount -= numOverwritten;
+    }
+
+    sampleTime = readPos_;
+    readPos_ += frameCount;
+
+    stats_.NumReadFrames += frameCount;
+
+    return frameCount;
+}
+
+SharedRingReaderStats SharedRingReader::GetStats() const
+{
+    return stats_;
+}
+
+bool SharedRingReader::GetReadRange(UInt64& readBegin, UInt64& readEnd) const
+{
+    if (!layout_) {
+        return false;
+    }
+
+    readEnd = layout_->WriteEnd.load(std::memory_order_acquire);
+
+    // Nothing was written yet.
+    if (readEnd == 0) {
+        return false;
+    }
+
+    if (started_) {
+        readBegin = readPos_;
+    } else {
+        // Start from the oldest frame still present in ring.
+        const UInt64 writeStart = layout_->WriteStart.load(std::memory_order_relaxed);
+
+        const UInt64 oldest = readEnd - std::min<UInt64>(readEnd, layout_->Capacity);
+
+        readBegin = std::max(writeStart, oldest);
+    }
+
+    return true;
+}
+
+} // namespace aspl
@@ -0,0 +1,288 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include <aspl/SharedRingWriter.hpp>
+
+#include "SharedRingLayout.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aspl {
+
+SharedRingWriter::SharedRingWriter(const SharedRingParameters& params)
+    : params_(params)
+    , bytesPerFrame_(params.Format.mBytesPerFrame)
+{
+}
+
+SharedRingWriter::~SharedRingWriter()
+{
+    Close();
+}
+
+const SharedRingParameters& SharedRingWriter::GetParameters() const
+{
+    return params_;
+}
+
+OSStatus SharedRingWriter::Open()
+{
+    if (open_) {
+        return kAudioHardwareNoError;
+    }
+
+    if (bytesPerFrame_ == 0 || params_.Capacity == 0) {
+        return kAudioHardwareIllegalOperationError;
+    }
+
+    const std::string semName = GetSharedRingSemaphoreName(params_.Name);
+
+    // Replace objects left by previous writer, so that we always start with
+    // a fresh header and readers of old ring aren't confused.
+    shm_unlink(params_.Name.c_str());
+    sem_unlink(semName.c_str());
+
+    const int fd = shm_open(params_.Name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd == -1) {
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    const size_t size = GetSharedRingSize(params_.Capacity, bytesPerFrame_);
+
+    void* addr = MAP_FAILED;
+    if (ftruncate(fd, off_t(size)) == 0) {
+        addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        shm_unlink(params_.Name.c_str());
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    // Reader needs write access to semaphore to wait on it.
+    semaphore_ = sem_open(semName.c_str(), O_CREAT | O_EXCL, 0666, 0);
+    if (semaphore_ == SEM_FAILED) {
+        munmap(addr, size);
+        shm_unlink(params_.Name.c_str());
+        return kAudioHardwareUnspecifiedError;
+    }
+
+    // Memory is zero-filled by ftruncate().
+    layout_ = new (addr) SharedRingLayout;
+    layoutSize_ = size;
+
+    layout_->HeaderMagic = SharedRingLayout::Magic;
+    layout_->HeaderVersion = SharedRingLayout::Version;
+    layout_->HeaderSize = UInt32(offsetof(SharedRingLayout, Data));
+    layout_->Capacity = params_.Capacity;
+    layout_->BytesPerFrame = bytesPerFrame_;
+    layout_->Format = params_.Format;
+
+    layout_->WriteStart.store(0, std::memory_order_relaxed);
+    layout_->WriteBegin.store(0, std::memory_order_relaxed);
+    layout_->WriteEnd.store(0, std::memory_order_relaxed);
+
+    // Publish header.
+    layout_->WriterActive.store(1, std::memory_order_release);
+
+    writeEnd_ = 0;
+
+    numWrittenFrames_ = 0;
+    numGapFrames_ = 0;
+    numLateFrames_ = 0;
+    numNotifications_ = 0;
+
+    open_.store(true, std::memory_order_release);
+
+    if (params_.NotifyInterval != 0) {
+        stopRequested_ = false;
+        thread_ = std::thread(&SharedRingWriter::NotifierLoop, this);
+    }
+
+    return kAudioHardwareNoError;
+}
+
+void SharedRingWriter::Close()
+{
+    if (!open_) {
+        return;
+    }
+
+    open_ = false;
+
+    if (thread_.joinable()) {
+        stopRequested_ = true;
+        thread_.join();
+    }
+
+    layout_->WriterActive.store(0, std::memory_order_release);
+
+    // Wake up reader, so that it can notice that writer is gone.
+    sem_post(semaphore_);
+
+    sem_close(semaphore_);
+    semaphore_ = SEM_FAILED;
+
+    munmap(layout_, layoutSize_);
+    layout_ = nullptr;
+    layoutSize_ = 0;
+
+    shm_unlink(params_.Name.c_str());
+    sem_unlink(GetSharedRingSemaphoreName(params_.Name).c_str());
+}
+
+bool SharedRingWriter::IsOpen() const
+{
+    return open_;
+}
+
+void SharedRingWriter::Write(UInt64 sampleTime, const void* bytes, UInt32 bytesCount)
+{
+    if (!open_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const UInt32 capacity = params_.Capacity;
+
+    const UInt8* frames = static_cast<const UInt8*>(bytes);
+    UInt32 frameCount = bytesCount / bytesPerFrame_;
+
+    if (frameCount == 0) {
+        return;
+    }
+
+    // Frames that were already written. Rewriting them could corrupt
+    // frames that reader is copying now.
+    if (writeEnd_ != 0 && sampleTime < writeEnd_) {
+        const UInt32 numLate =
+            UInt32(std::min<UInt64>(frameCount, writeEnd_ - sampleTime));
+
+        numLateFrames_.fetch_add(numLate, std::memory_order_relaxed);
+
+        sampleTime += numLate;
+        frames += size_t(numLate) * bytesPerFrame_;
+        frameCount -= numLate;
+
+        if (frameCount == 0) {
+            return;
+        }
+    }
+
+    // Frames that don't fit into ring would be overwritten by the same write.
+    if (frameCount > capacity) {
+        const UInt32 numSkipped = frameCount - capacity;
+
+        sampleTime += numSkipped;
+        frames += size_t(numSkipped) * bytesPerFrame_;
+        frameCount = capacity;
+    }
+
+    const UInt64 writeEnd = sampleTime + frameCount;
+
+    // Gap between previous and current write. Only the part that fits into
+    // ring together with current frames is filled.
+    UInt64 gapBegin = sampleTime;
+
+    if (writeEnd_ != 0 && sampleTime > writeEnd_) {
+        gapBegin =
+            writeEnd > capacity ? std::max(writeEnd_, writeEnd - capacity) : writeEnd_;
+    }
+
+    if (writeEnd_ == 0) {
+        layout_->WriteStart.store(sampleTime, std::memory_order_relaxed);
+    }
+
+    // Announce frames that are going to be overwritten before modifying them.
+    layout_->WriteBegin.store(writeEnd, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (gapBegin != sampleTime) {
+        const UInt32 numGap = UInt32(sampleTime - gapBegin);
+
+        ZeroFrames(gapBegin, numGap);
+        numGapFrames_.fetch_add(numGap, std::memory_order_relaxed);
+    }
+
+    CopyFrames(sampleTime, frames, frameCount);
+
+    // Publish frames.
+    layout_->WriteEnd.store(writeEnd, std::memory_order_release);
+
+    writeEnd_ = writeEnd;
+
+    numWrittenFrames_.fetch_add(frameCount, std::memory_order_relaxed);
+}
+
+SharedRingWriterStats SharedRingWriter::GetStats() const
+{
+    SharedRingWriterStats stats;
+
+    stats.NumWrittenFrames = numWrittenFrames_;
+    stats.NumGapFrames = numGapFrames_;
+    stats.NumLateFrames = numLateFrames_;
+    stats.NumNotifications = numNotifications_;
+
+    return stats;
+}
+
+void SharedRingWriter::NotifierLoop()
+{
+    UInt64 lastEnd = 0;
+
+    while (!stopRequested_.load(std::memory_order_acquire)) {
+        usleep(params_.NotifyInterval);
+
+        const UInt64 writeEnd = layout_->WriteEnd.load(std::memory_order_acquire);
+
+        if (writeEnd != lastEnd) {
+            lastEnd = writeEnd;
+
+            sem_post(semaphore_);
+            numNotifications_++;
+        }
+    }
+}
+
+void SharedRingWriter::CopyFrames(UInt64 sampleTime,
+    const UInt8* frames,
+    UInt32 frameCount)
+{
+    const UInt32 capacity = params_.Capacity;
+    const UInt32 slot = UInt32(sampleTime % capacity);
+
+    // Frames may wrap around the end of the ring.
+    const UInt32 firstCount = std::min(frameCount, capacity - slot);
+
+    memcpy(layout_->Data + size_t(slot) * bytesPerFrame_,
+        frames,
+        size_t(firstCount) * bytesPerFrame_);
+
+    memcpy(layout_->Data,
+        frames + size_t(firstCount) * bytesPerFrame_,
+        size_t(frameCount - firstCount) * bytesPerFrame_);
+}
+
+void SharedRingWriter::ZeroFrames(UInt64 sampleTime, UInt32 frameCount)
+{
+    const UInt32 capacity = params_.Capacity;
+    const UInt32 slot = UInt32(sampleTime % capacity);
+
+    const UInt32 firstCount = std::min(frameCount, capacity - slot);
+
+    memset(layout_->Data + size_t(slot) * bytesPerFrame_,
+        0,
+        size_t(firstCount) * bytesPerFrame_);
+
+    memset(layout_->Data, 0, size_t(frameCount - firstCount) * bytesPerFrame_);
+}
+
+} // namespace aspl
@@ -5,6 +5,7 @@
 
 #include "Convert.hpp"
 #include "Strings.hpp"
+#include "Tracing.hpp"
 
 #include <type_traits>
 
@@ -98,7 +99,7 @@ std::pair<T, bool> Storage::CopyFromStorage_(const char* type, std::string key)
 
     Convert::ToFoundation(key, keyString);
     if (!keyString) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
             "Storage::CopyFromStorage() type=%s key=\"%s\" can't encode key",
             type,
             key.c_str());
@@ -107,7 +108,7 @@ std::pair<T, bool> Storage::CopyFromStorage_(const char* type, std::string key)
 
     host = GetContext()->Host.load();
     if (!host) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
             "Storage::CopyFromStorage() type=%s key=\"%s\" Context.Host is NULL"
             " (driver is not initialized yet)",
             type,
@@ -117,7 +118,7 @@ std::pair<T, bool> Storage::CopyFromStorage_(const char* type, std::string key)
 
     status = host->CopyFromStorage(host, keyString, &valuePlist);
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetContext()->Tracer,
         "Storage::CopyFromStorage() type=%s key=\"%s\" status=%s hasValue=%s",
         type,
         key.c_str(),
@@ -134,7 +135,7 @@ std::pair<T, bool> Storage::CopyFromStorage_(const char* type, std::string key)
 
     if constexpr (!std::is_same<T, CFPropertyListRef>::value) {
         if (!Convert::FromFoundation(valuePlist, value)) {
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetContext()->Tracer,
                 "Storage::CopyFromStorage() type=%s key=\"%s\" can't decode value",
                 type,
                 key.c_str());
@@ -172,7 +173,7 @@ bool Storage::WriteToStorage_(const char* type, std::string key, T value)
 
     Convert::ToFoundation(key, keyString);
     if (!keyString) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
             "Storage::WriteToStorage() type=%s key=\"%s\" can't encode key",
             type,
             key.c_str());
@@ -182,7 +183,7 @@ bool Storage::WriteToStorage_(const char* type, std::string key, T value)
     if constexpr (!std::is_same<T, CFPropertyListRef>::value) {
         Convert::ToFoundation(value, valuePlist);
         if (!valuePlist) {
-            GetContext()->Tracer->Message(
+            ASPL_TRACE_MESSAGE(GetContext()->Tracer,
                 "Storage::WriteToStorage() type=%s key=\"%s\" can't encode value",
                 type,
                 key.c_str());
@@ -194,7 +195,7 @@ bool Storage::WriteToStorage_(const char* type, std::string key, T value)
 
     host = GetContext()->Host.load();
     if (!host) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
             "Storage::WriteToStorage() type=%s key=\"%s\" Context.Host is NULL"
             " (driver is not initialized yet)",
             type,
@@ -204,7 +205,7 @@ bool Storage::WriteToStorage_(const char* type, std::string key, T value)
 
     status = host->WriteToStorage(host, keyString, valuePlist);
 
-    GetContext()->Tracer->Message(
+    ASPL_TRACE_MESSAGE(GetContext()->Tracer,
         "Storage::WriteToStorage() type=%s key=\"%s\" status=%s",
         type,
         key.c_str(),
@@ -240,14 +241,15 @@ bool Storage::DeleteFromStorage_(std::string key)
 
     Convert::ToFoundation(key, keyString);
     if (!keyString) {
-        GetContext()->Tracer->Message(
-            "Storage::DeleteFromStorage() key=\"%s\" can't encode key", key.c_str());
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
+            "Storage::DeleteFromStorage() key=\"%s\" can't encode key",
+            key.c_str());
         goto end;
     }
 
     host = GetContext()->Host.load();
     if (!host) {
-        GetContext()->Tracer->Message(
+        ASPL_TRACE_MESSAGE(GetContext()->Tracer,
             "Storage::DeleteFromStorage() key=\"%s\" Context.Host is NULL"
             " (driver is not initialized yet)",
             key.c_str());
@@ -256,7 +258,8 @@ bool Storage::DeleteFromStorage_(std::string key)
 
     status = host->DeleteFromStorage(host, keyString);
 
-    GetContext()->Tracer->Message("Storage::DeleteFromStorage() key=\"%s\" status=%s",
+    ASPL_TRACE_MESSAGE(GetContext()->Tracer,
+        "Storage::DeleteFromStorage() key=\"%s\" status=%s",
         key.c_str(),
         StatusToString(status).c_str());
 
@@ -5,6 +5,8 @@
 #include <aspl/Stream.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
+#include "Tracing.hpp"
 
 namespace aspl {
 
@@ -90,7 +92,7 @@ OSStatus Stream::CheckPhysicalFormat(const AudioStreamBasicDescription& format)
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("format is not supported");
+    ASPL_TRACE_MESSAGE(GetTracer(), "format is not supported");
 
     return kAudioDeviceUnsupportedFormatError;
 }
@@ -144,7 +146,7 @@ OSStatus Stream::CheckVirtualFormat(const AudioStreamBasicDescription& format) c
         return kAudioHardwareNoError;
     }
 
-    GetContext()->Tracer->Message("format is not supported");
+    ASPL_TRACE_MESSAGE(GetTracer(), "format is not supported");
 
     return kAudioDeviceUnsupportedFormatError;
 }
@@ -226,4 +228,14 @@ void Stream::RequestConfigurationChange(std::function<void()> func)
     }
 }
 
+std::future<OSStatus> Stream::RequestConfigurationChangeWithResult(
+    std::function<OSStatus()> func)
+{
+    if (auto device = device_.lock()) {
+        return device->RequestConfigurationChangeWithResult(std::move(func));
+    }
+
+    return MakeReadyFuture(Device::ConfigurationChangeAbortedError);
+}
+
 } // namespace aspl
@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: Stream.json
-// Timestamp: Sun Apr 13 14:12:49 2025 UTC
+// Timestamp: Mon Oct 19 09:08:12 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/Stream.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -46,33 +48,34 @@ OSStatus Stream::SetIsActive(bool value)
     op.Name = "Stream::SetIsActive()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetIsActive()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message("setting value to %s",
+    ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
         Convert::ToString(value).c_str());
 
     status = SetIsActiveImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("setter failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
         goto end;
     }
 
     NotifyPropertyChanged(kAudioStreamPropertyIsActive);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Stream::SetLatencyAsync(UInt32 value)
+OSStatus Stream::SetLatencyAsync(UInt32 value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -80,45 +83,62 @@ OSStatus Stream::SetLatencyAsync(UInt32 value)
     op.Name = "Stream::SetLatencyAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetLatency()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Stream::SetLatencyImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Stream::SetLatencyImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetLatency()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetLatency()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetLatencyImpl(std::move(value));
-        }
+                status = SetLatencyImpl(std::move(value));
+            }
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            ASPL_TRACE_END(GetTracer(), op, status);
+
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Stream::SetPhysicalFormatAsync(AudioStreamBasicDescription value)
+OSStatus Stream::SetPhysicalFormatAsync(AudioStreamBasicDescription value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -126,51 +146,68 @@ OSStatus Stream::SetPhysicalFormatAsync(AudioStreamBasicDescription value)
     op.Name = "Stream::SetPhysicalFormatAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetPhysicalFormat()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
     status = CheckPhysicalFormat(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("value is invalid");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value is invalid");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Stream::SetPhysicalFormatImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Stream::SetPhysicalFormatImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetPhysicalFormat()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetPhysicalFormat()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetPhysicalFormatImpl(std::move(value));
-        }
+                status = SetPhysicalFormatImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Stream::SetVirtualFormatAsync(AudioStreamBasicDescription value)
+OSStatus Stream::SetVirtualFormatAsync(AudioStreamBasicDescription value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -178,51 +215,68 @@ OSStatus Stream::SetVirtualFormatAsync(AudioStreamBasicDescription value)
     op.Name = "Stream::SetVirtualFormatAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetVirtualFormat()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
     status = CheckVirtualFormat(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("value is invalid");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value is invalid");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Stream::SetVirtualFormatImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Stream::SetVirtualFormatImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetVirtualFormat()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetVirtualFormat()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetVirtualFormatImpl(std::move(value));
-        }
+                status = SetVirtualFormatImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Stream::SetAvailablePhysicalFormatsAsync(std::vector<AudioStreamRangedDescription> value)
+OSStatus Stream::SetAvailablePhysicalFormatsAsync(std::vector<AudioStreamRangedDescription> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -230,45 +284,62 @@ OSStatus Stream::SetAvailablePhysicalFormatsAsync(std::vector<AudioStreamRangedD
     op.Name = "Stream::SetAvailablePhysicalFormatsAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetAvailablePhysicalFormats()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Stream::SetAvailablePhysicalFormatsImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Stream::SetAvailablePhysicalFormatsImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetAvailablePhysicalFormats()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetAvailablePhysicalFormats()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetAvailablePhysicalFormatsImpl(std::move(value));
-        }
+                status = SetAvailablePhysicalFormatsImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
+
+            return status;
+        };
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
 
-OSStatus Stream::SetAvailableVirtualFormatsAsync(std::vector<AudioStreamRangedDescription> value)
+OSStatus Stream::SetAvailableVirtualFormatsAsync(std::vector<AudioStreamRangedDescription> value,
+    std::future<OSStatus>* completion)
 {
     std::lock_guard writeLock(writeMutex_);
 
@@ -276,40 +347,56 @@ OSStatus Stream::SetAvailableVirtualFormatsAsync(std::vector<AudioStreamRangedDe
     op.Name = "Stream::SetAvailableVirtualFormatsAsync()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
+    std::future<OSStatus> result;
 
     if (value == GetAvailableVirtualFormats()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    RequestConfigurationChange([this, value = std::move(value)]() mutable {
-        std::lock_guard writeLock(writeMutex_);
+    {
+        auto func = [this, value = std::move(value)]() mutable {
+            std::lock_guard writeLock(writeMutex_);
 
-        Tracer::Operation op;
-        op.Name = "Stream::SetAvailableVirtualFormatsImpl()";
-        op.ObjectID = GetID();
+            Tracer::Operation op;
+            op.Name = "Stream::SetAvailableVirtualFormatsImpl()";
+            op.ObjectID = GetID();
 
-        GetContext()->Tracer->OperationBegin(op);
+            ASPL_TRACE_BEGIN(GetTracer(), op);
 
-        OSStatus status = kAudioHardwareNoError;
+            OSStatus status = kAudioHardwareNoError;
 
-        if (value == GetAvailableVirtualFormats()) {
-            GetContext()->Tracer->Message("value not changed");
-        } else {
-            GetContext()->Tracer->Message("setting value to %s",
-                Convert::ToString(value).c_str());
+            if (value == GetAvailableVirtualFormats()) {
+                ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
+            } else {
+                ASPL_TRACE_MESSAGE(GetTracer(), "setting value to %s",
+                    Convert::ToString(value).c_str());
 
-            status = SetAvailableVirtualFormatsImpl(std::move(value));
-        }
+                status = SetAvailableVirtualFormatsImpl(std::move(value));
+            }
+
+            ASPL_TRACE_END(GetTracer(), op, status);
 
-        GetContext()->Tracer->OperationEnd(op, status);
-    });
+            return status;
+        };
+
+        // Track result only if caller asked for it.
+        if (completion) {
+            result = RequestConfigurationChangeWithResult(std::move(func));
+        } else {
+            RequestConfigurationChange(std::move(func));
+        }
+    }
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    if (completion) {
+        *completion = result.valid() ? std::move(result) : MakeReadyFuture(status);
+    }
+
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -327,10 +414,10 @@ Boolean Stream::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -339,55 +426,55 @@ Boolean Stream::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioStreamPropertyIsActive:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyDirection:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyTerminalType:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyStartingChannel:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyLatency:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyPhysicalFormat:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyVirtualFormat:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyAvailablePhysicalFormats:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioStreamPropertyAvailableVirtualFormats:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -397,7 +484,7 @@ Boolean Stream::HasProperty(AudioObjectID objectID,
     result = Object::HasProperty(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -415,10 +502,10 @@ OSStatus Stream::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -428,90 +515,90 @@ OSStatus Stream::IsPropertySettable(AudioObjectID objectID,
         case kAudioStreamPropertyIsActive:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyDirection:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyTerminalType:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyStartingChannel:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyLatency:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyPhysicalFormat:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyVirtualFormat:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyAvailablePhysicalFormats:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyAvailableVirtualFormats:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -521,7 +608,7 @@ OSStatus Stream::IsPropertySettable(AudioObjectID objectID,
     status = Object::IsPropertySettable(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -544,10 +631,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -558,10 +645,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -569,10 +656,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -580,10 +667,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -591,10 +678,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -602,10 +689,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -613,10 +700,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioStreamBasicDescription);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -624,10 +711,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioStreamBasicDescription);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -637,10 +724,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetAvailablePhysicalFormats();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioStreamRangedDescription));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -650,10 +737,10 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
                     const auto values = GetAvailableVirtualFormats();
                     *outDataSize = UInt32(values.size()
                         * sizeof(AudioStreamRangedDescription));
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -664,7 +751,7 @@ OSStatus Stream::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -691,10 +778,10 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -704,7 +791,7 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
         case kAudioStreamPropertyIsActive:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -713,25 +800,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetIsActive();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning IsActive=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyDirection:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -740,25 +827,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetDirection();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Direction=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyTerminalType:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -767,25 +854,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetTerminalType();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning TerminalType=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyStartingChannel:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -794,25 +881,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetStartingChannel();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning StartingChannel=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyLatency:
             {
                 if (inDataSize < sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(UInt32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -821,25 +908,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(UInt32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetLatency();
                     Convert::ToFoundation(
                         value,
                         *static_cast<UInt32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Latency=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyPhysicalFormat:
             {
                 if (inDataSize < sizeof(AudioStreamBasicDescription)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioStreamBasicDescription)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -848,25 +935,25 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioStreamBasicDescription);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetPhysicalFormat();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioStreamBasicDescription*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning PhysicalFormat=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioStreamPropertyVirtualFormat:
             {
                 if (inDataSize < sizeof(AudioStreamBasicDescription)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioStreamBasicDescription)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -875,18 +962,18 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioStreamBasicDescription);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetVirtualFormat();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioStreamBasicDescription*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning VirtualFormat=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -900,7 +987,7 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioStreamRangedDescription));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -908,13 +995,13 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioStreamRangedDescription*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning AvailablePhysicalFormats=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -928,7 +1015,7 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                     *outDataSize = UInt32(valuesCount
                         * sizeof(AudioStreamRangedDescription));
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     for (size_t i = 0; i < valuesCount; i++) {
@@ -936,13 +1023,13 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
                             values[i],
                             static_cast<AudioStreamRangedDescription*>(outData)[i]);
                     }
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning AvailableVirtualFormats=%s (%u/%u)",
                         Convert::ToString(values).c_str(),
                         unsigned(valuesCount),
                         unsigned(values.size()));
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -954,7 +1041,7 @@ OSStatus Stream::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -978,10 +1065,10 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -991,13 +1078,13 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
         case kAudioStreamPropertyIsActive:
             {
                 if (inDataSize != sizeof(UInt32)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(UInt32)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -1006,12 +1093,12 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const UInt32*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting IsActive=%s",
                     Convert::ToString(value).c_str());
                 status = SetIsActive(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -1019,13 +1106,13 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
         case kAudioStreamPropertyPhysicalFormat:
             {
                 if (inDataSize != sizeof(AudioStreamBasicDescription)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(AudioStreamBasicDescription)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -1034,12 +1121,12 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const AudioStreamBasicDescription*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting PhysicalFormat=%s",
                     Convert::ToString(value).c_str());
                 status = SetPhysicalFormatAsync(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -1047,13 +1134,13 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
         case kAudioStreamPropertyVirtualFormat:
             {
                 if (inDataSize != sizeof(AudioStreamBasicDescription)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(AudioStreamBasicDescription)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -1062,12 +1149,12 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const AudioStreamBasicDescription*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting VirtualFormat=%s",
                     Convert::ToString(value).c_str());
                 status = SetVirtualFormatAsync(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -1079,7 +1166,7 @@ OSStatus Stream::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -3,25 +3,93 @@
 
 #include "Strings.hpp"
 
-#include <sstream>
+#include <algorithm>
+#include <cstdio>
 
 namespace aspl {
 
-std::string CodeToString(UInt32 value)
+std::string_view CodeToString(UInt32 value, StringBuffer& buf)
 {
     const char* bytes = reinterpret_cast<const char*>(&value);
 
-    std::stringstream ss;
-
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-    ss << "'" << bytes[0] << bytes[1] << bytes[2] << bytes[3] << "'";
+    const char chars[] = {bytes[0], bytes[1], bytes[2], bytes[3]};
 #else
-    ss << "'" << bytes[3] << bytes[2] << bytes[1] << bytes[0] << "'";
+    const char chars[] = {bytes[3], bytes[2], bytes[1], bytes[0]};
 #endif
 
-    ss << " (0x" << std::hex << value << ")";
+    // chars are copied as is, even if zero, like when printing to stream
+    buf[0] = '\'';
+    std::copy(std::begin(chars), std::end(chars), buf.begin() + 1);
+    buf[5] = '\'';
+
+    const int size = snprintf(buf.data() + 6, buf.size() - 6, " (0x%x)", unsigned(value));
+
+    return std::string_view(buf.data(), 6 + size_t(std::max(size, 0)));
+}
+
+size_t AppendFlagName(StringBuffer& buf, size_t len, std::string_view name)
+{
+    if (len != 0 && len + 1 < buf.size()) {
+        buf[len++] = '|';
+    }
+
+    const size_t count = std::min(name.size(), buf.size() - 1 - len);
+
+    std::copy(name.begin(), name.begin() + count, buf.begin() + len);
+    len += count;
+
+    buf[len] = '\0';
+
+    return len;
+}
+
+std::string ClassIDToString(AudioClassID classID)
+{
+    StringBuffer buf;
+    return std::string(ClassIDToString(classID, buf));
+}
+
+std::string PropertySelectorToString(AudioObjectPropertySelector selector)
+{
+    StringBuffer buf;
+    return std::string(PropertySelectorToString(selector, buf));
+}
 
-    return ss.str();
+std::string PropertyScopeToString(AudioObjectPropertyScope scope)
+{
+    StringBuffer buf;
+    return std::string(PropertyScopeToString(scope, buf));
+}
+
+std::string OperationIDToString(UInt32 operationID)
+{
+    StringBuffer buf;
+    return std::string(OperationIDToString(operationID, buf));
+}
+
+std::string StatusToString(OSStatus status)
+{
+    StringBuffer buf;
+    return std::string(StatusToString(status, buf));
+}
+
+std::string FormatIDToString(AudioFormatID formatID)
+{
+    StringBuffer buf;
+    return std::string(FormatIDToString(formatID, buf));
+}
+
+std::string FormatFlagsToString(AudioFormatFlags formatFlags)
+{
+    StringBuffer buf;
+    return std::string(FormatFlagsToString(formatFlags, buf));
+}
+
+std::string CodeToString(UInt32 value)
+{
+    StringBuffer buf;
+    return std::string(CodeToString(value, buf));
 }
 
 } // namespace aspl
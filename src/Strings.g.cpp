@@ -11,7 +11,7 @@
 
 namespace aspl {
 
-std::string ClassIDToString(AudioClassID classID)
+std::string_view ClassIDToString(AudioClassID classID, StringBuffer& buf)
 {
     switch (classID) {
     case 'togl':
@@ -77,11 +77,11 @@ std::string ClassIDToString(AudioClassID classID)
     case 'vlme':
         return "kAudioVolumeControlClassID";
     default:
-        return CodeToString(classID);
+        return CodeToString(classID, buf);
     }
 }
 
-std::string PropertySelectorToString(AudioObjectPropertySelector selector)
+std::string_view PropertySelectorToString(AudioObjectPropertySelector selector, StringBuffer& buf)
 {
     switch (selector) {
     case 'bcvl':
@@ -245,11 +245,11 @@ std::string PropertySelectorToString(AudioObjectPropertySelector selector)
     case 'uide':
         return "kAudioTransportManagerPropertyTranslateUIDToEndPoint";
     default:
-        return CodeToString(selector);
+        return CodeToString(selector, buf);
     }
 }
 
-std::string PropertyScopeToString(AudioObjectPropertyScope scope)
+std::string_view PropertyScopeToString(AudioObjectPropertyScope scope, StringBuffer& buf)
 {
     switch (scope) {
     case 'glob':
@@ -263,11 +263,11 @@ std::string PropertyScopeToString(AudioObjectPropertyScope scope)
     case '****':
         return "kAudioObjectPropertyScopeWildcard";
     default:
-        return CodeToString(scope);
+        return CodeToString(scope, buf);
     }
 }
 
-std::string OperationIDToString(UInt32 operationID)
+std::string_view OperationIDToString(UInt32 operationID, StringBuffer& buf)
 {
     switch (operationID) {
     case 'cinp':
@@ -291,11 +291,11 @@ std::string OperationIDToString(UInt32 operationID)
     case 'rite':
         return "kAudioServerPlugInIOOperationWriteMix";
     default:
-        return CodeToString(operationID);
+        return CodeToString(operationID, buf);
     }
 }
 
-std::string StatusToString(OSStatus status)
+std::string_view StatusToString(OSStatus status, StringBuffer& buf)
 {
     switch (status) {
     case kAudioHardwareNoError:
@@ -327,11 +327,11 @@ std::string StatusToString(OSStatus status)
     case '!pth':
         return "kAudio_BadFilePathError";
     default:
-        return CodeToString(UInt32(status));
+        return CodeToString(UInt32(status), buf);
     }
 }
 
-std::string FormatIDToString(AudioFormatID fmtid2code)
+std::string_view FormatIDToString(AudioFormatID fmtid2code, StringBuffer& buf)
 {
     switch (fmtid2code) {
     case 'cac3':
@@ -417,56 +417,36 @@ std::string FormatIDToString(AudioFormatID fmtid2code)
     case 'ilbc':
         return "kAudioFormatiLBC";
     default:
-        return CodeToString(fmtid2code);
+        return CodeToString(fmtid2code, buf);
     }
 }
 
-std::string FormatFlagsToString(AudioFormatFlags formatFlags)
+std::string_view FormatFlagsToString(AudioFormatFlags formatFlags, StringBuffer& buf)
 {
-    std::string ret;
+    buf[0] = '\0';
+    size_t len = 0;
     if (formatFlags & (1U << 4)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsAlignedHigh";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsAlignedHigh");
     }
     if (formatFlags & (1U << 1)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsBigEndian";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsBigEndian");
     }
     if (formatFlags & (1U << 0)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsFloat";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsFloat");
     }
     if (formatFlags & (1U << 5)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsNonInterleaved";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsNonInterleaved");
     }
     if (formatFlags & (1U << 6)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsNonMixable";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsNonMixable");
     }
     if (formatFlags & (1U << 3)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsPacked";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsPacked");
     }
     if (formatFlags & (1U << 2)) {
-        if (!ret.empty()) {
-            ret += "|";
-        }
-        ret += "kAudioFormatFlagIsSignedInteger";
+        len = AppendFlagName(buf, len, "kAudioFormatFlagIsSignedInteger");
     }
-    return ret;
+    return std::string_view(buf.data(), len);
 }
 
 } // namespace aspl
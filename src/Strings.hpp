@@ -5,10 +5,37 @@
 
 #include <CoreAudio/AudioServerPlugIn.h>
 
+#include <array>
 #include <string>
+#include <string_view>
 
 namespace aspl {
 
+// Caller-provided storage for strings that are not known statically,
+// like unknown codes or combinations of flags.
+using StringBuffer = std::array<char, 256>;
+
+// Functions below return views to static strings for known codes. For unknown
+// codes, string is formatted into the buffer and the returned view points to it.
+// Returned views are always null-terminated. They don't allocate memory.
+
+std::string_view ClassIDToString(AudioClassID classID, StringBuffer& buf);
+
+std::string_view PropertySelectorToString(
+    AudioObjectPropertySelector selector, StringBuffer& buf);
+std::string_view PropertyScopeToString(AudioObjectPropertyScope scope, StringBuffer& buf);
+
+std::string_view OperationIDToString(UInt32 operationID, StringBuffer& buf);
+
+std::string_view StatusToString(OSStatus status, StringBuffer& buf);
+
+std::string_view FormatIDToString(AudioFormatID formatID, StringBuffer& buf);
+std::string_view FormatFlagsToString(AudioFormatFlags formatFlags, StringBuffer& buf);
+
+std::string_view CodeToString(UInt32 value, StringBuffer& buf);
+
+// Same as above, but return a copy.
+
 std::string ClassIDToString(AudioClassID classID);
 
 std::string PropertySelectorToString(AudioObjectPropertySelector selector);
@@ -23,4 +50,7 @@ std::string FormatFlagsToString(AudioFormatFlags formatFlags);
 
 std::string CodeToString(UInt32 value);
 
+// Append flag name to buffer, separated by "|". Used by generated code.
+size_t AppendFlagName(StringBuffer& buf, size_t len, std::string_view name);
+
 } // namespace aspl
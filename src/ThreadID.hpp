@@ -0,0 +1,30 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <pthread.h>
+
+#if !defined(__APPLE__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace aspl {
+
+// Get OS-level ID of calling thread, for logging.
+inline unsigned long GetThreadID()
+{
+#if defined(__APPLE__)
+    UInt64 tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+
+    return static_cast<unsigned long>(tid);
+#else
+    return static_cast<unsigned long>(syscall(SYS_gettid));
+#endif
+}
+
+} // namespace aspl
@@ -0,0 +1,157 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#include "TraceFilter.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+namespace aspl {
+
+namespace {
+
+bool ParseNumber(const std::string& str, UInt32& result)
+{
+    if (str.empty()) {
+        return false;
+    }
+
+    char* end = nullptr;
+    const unsigned long value = strtoul(str.c_str(), &end, 0);
+
+    if (*end != '\0' || value > 0xffffffff) {
+        return false;
+    }
+
+    result = UInt32(value);
+    return true;
+}
+
+bool IsFourCC(const std::string& str)
+{
+    if (str.size() != 4) {
+        return false;
+    }
+
+    for (const char c : str) {
+        if (!isprint(static_cast<unsigned char>(c))) {
+            return false;
+        }
+    }
+
+    // numbers take precedence
+    return !isdigit(static_cast<unsigned char>(str[0]));
+}
+
+bool ParseSelector(const std::string& str, AudioObjectPropertySelector& result)
+{
+    if (IsFourCC(str)) {
+        result = (UInt32(UInt8(str[0])) << 24) | (UInt32(UInt8(str[1])) << 16) |
+                 (UInt32(UInt8(str[2])) << 8) | UInt32(UInt8(str[3]));
+        return true;
+    }
+
+    return ParseNumber(str, result);
+}
+
+std::string FormatSelector(AudioObjectPropertySelector selector)
+{
+    const char chars[] = {
+        char((selector >> 24) & 0xff),
+        char((selector >> 16) & 0xff),
+        char((selector >> 8) & 0xff),
+        char(selector & 0xff),
+    };
+
+    const std::string str(chars, sizeof(chars));
+
+    if (IsFourCC(str) && str.find_first_of(", =") == std::string::npos) {
+        return str;
+    }
+
+    return std::to_string(selector);
+}
+
+template <typename T, typename ParseFunc>
+bool ParseList(const std::string& str, std::vector<T>& result, ParseFunc parse)
+{
+    std::istringstream ss(str);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        T value = {};
+        if (!parse(item, value)) {
+            return false;
+        }
+        result.push_back(value);
+    }
+
+    return !result.empty();
+}
+
+} // namespace
+
+bool ParseTraceFilter(const std::string& str, Tracer::Filter& filter)
+{
+    Tracer::Filter result;
+
+    std::istringstream ss(str);
+    std::string token;
+
+    while (ss >> token) {
+        const auto pos = token.find('=');
+        if (pos == std::string::npos) {
+            return false;
+        }
+
+        const auto key = token.substr(0, pos);
+        const auto value = token.substr(pos + 1);
+
+        if (key == "objects") {
+            if (!ParseList(value, result.ObjectIDs, ParseNumber)) {
+                return false;
+            }
+        } else if (key == "selectors") {
+            if (!ParseList(value, result.Selectors, ParseSelector)) {
+                return false;
+            }
+        } else if (key == "depth") {
+            if (!ParseNumber(value, result.MaxDepth)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    filter = std::move(result);
+    return true;
+}
+
+std::string FormatTraceFilter(const Tracer::Filter& filter)
+{
+    std::ostringstream ss;
+
+    if (!filter.ObjectIDs.empty()) {
+        ss << "objects=";
+        for (size_t n = 0; n < filter.ObjectIDs.size(); n++) {
+            ss << (n ? "," : "") << filter.ObjectIDs[n];
+        }
+    }
+
+    if (!filter.Selectors.empty()) {
+        ss << (ss.tellp() > 0 ? " " : "") << "selectors=";
+        for (size_t n = 0; n < filter.Selectors.size(); n++) {
+            ss << (n ? "," : "") << FormatSelector(filter.Selectors[n]);
+        }
+    }
+
+    if (filter.MaxDepth != 0) {
+        ss << (ss.tellp() > 0 ? " " : "") << "depth=" << filter.MaxDepth;
+    }
+
+    return ss.str();
+}
+
+} // namespace aspl
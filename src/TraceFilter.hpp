@@ -0,0 +1,20 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/Tracer.hpp>
+
+#include <string>
+
+namespace aspl {
+
+// Parse tracer filter from string like "objects=2,5 selectors=nsrt,lnam depth=3".
+// Selectors are four-character codes or numbers. Empty string means empty filter.
+// Returns false if string is invalid.
+bool ParseTraceFilter(const std::string& str, Tracer::Filter& filter);
+
+// Format tracer filter into string accepted by ParseTraceFilter().
+std::string FormatTraceFilter(const Tracer::Filter& filter);
+
+} // namespace aspl
@@ -4,10 +4,11 @@
 #include <aspl/Tracer.hpp>
 
 #include "Strings.hpp"
+#include "ThreadID.hpp"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
-#include <sstream>
 
 #include <pthread.h>
 #include <syslog.h>
@@ -22,12 +23,35 @@ enum
     DepthHardLimit = 1000,
 };
 
-unsigned long GetThreadID()
+// Object IDs below this limit are stored in bitset.
+constexpr AudioObjectID MaxBitsetObjectID = 65536;
+
+// Append formatted string to buffer of given size, which currently holds
+// string of length len. Output is truncated if it doesn't fit.
+__attribute__((format(printf, 4, 5))) void Append(char* buf,
+    size_t bufSize,
+    size_t& len,
+    const char* format,
+    ...)
 {
-    UInt64 tid = 0;
-    pthread_threadid_np(nullptr, &tid);
+    if (len + 1 >= bufSize) {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    const int ret = vsnprintf(buf + len, bufSize - len, format, args);
+    va_end(args);
+
+    if (ret > 0) {
+        len = std::min(len + size_t(ret), bufSize - 1);
+    }
+}
 
-    return static_cast<unsigned long>(tid);
+// Append indentation for hierarchical style.
+void AppendIndent(char* buf, size_t bufSize, size_t& len, UInt32 numDashes)
+{
+    Append(buf, bufSize, len, "|%.*s ", int(numDashes), "-----------");
 }
 
 } // namespace
@@ -61,6 +85,48 @@ Tracer::ThreadLocalState& Tracer::GetThreadLocalState()
     return *static_cast<ThreadLocalState*>(ptr);
 }
 
+void Tracer::SetFilter(const Filter& filter)
+{
+    CompiledFilter compiled;
+    compiled.Source = filter;
+
+    for (const auto objectID : filter.ObjectIDs) {
+        if (objectID < MaxBitsetObjectID) {
+            if (compiled.ObjectBits.size() <= objectID / 64) {
+                compiled.ObjectBits.resize(objectID / 64 + 1);
+            }
+            compiled.ObjectBits[objectID / 64] |= (UInt64(1) << (objectID % 64));
+        } else {
+            compiled.LargeObjectIDs.insert(objectID);
+        }
+    }
+
+    compiled.Selectors.insert(filter.Selectors.begin(), filter.Selectors.end());
+
+    compiled.Restricted = !filter.ObjectIDs.empty() || !filter.Selectors.empty();
+
+    const bool hasFilter = compiled.Restricted || filter.MaxDepth != 0;
+
+    // When disabling filter, clear flag before resetting filter, and when
+    // enabling, set it after, so that readers never see flag without filter.
+    if (!hasFilter) {
+        hasFilter_ = false;
+    }
+
+    filter_.Set(std::move(compiled));
+
+    if (hasFilter) {
+        hasFilter_ = true;
+    }
+}
+
+Tracer::Filter Tracer::GetFilter() const
+{
+    auto readLock = filter_.GetReadLock();
+
+    return readLock.GetReference().Source;
+}
+
 void Tracer::OperationBegin(const Operation& op)
 {
     if (mode_ == Mode::Noop) {
@@ -82,14 +148,20 @@ void Tracer::OperationBegin(const Operation& op)
         return;
     }
 
-    if (ShouldIgnore(op)) {
+    if (ShouldIgnore(op) || IsFiltered(op, threadState)) {
         threadState.IgnoreCounter = threadState.DepthCounter;
         return;
     }
 
-    const auto str = FormatOperationBegin(op, threadState.DepthCounter);
+    if (legacyFormatHooks_.load(std::memory_order_relaxed) & LegacyFormatBegin) {
+        Print(FormatOperationBegin(op, threadState.DepthCounter).c_str());
+        return;
+    }
+
+    char str[MaxMessageLen];
+    FormatOperationBegin(op, threadState.DepthCounter, str, sizeof(str));
 
-    Print(str.c_str());
+    Print(str);
 }
 
 void Tracer::Message(const char* format, ...)
@@ -105,6 +177,10 @@ void Tracer::Message(const char* format, ...)
         return;
     }
 
+    if (IsMessageFiltered(threadState)) {
+        return;
+    }
+
     char message[MaxMessageLen] = {};
 
     va_list args;
@@ -112,9 +188,15 @@ void Tracer::Message(const char* format, ...)
     vsnprintf(message, sizeof(message), format, args);
     va_end(args);
 
-    const auto str = FormatMessage(message, threadState.DepthCounter);
+    if (legacyFormatHooks_.load(std::memory_order_relaxed) & LegacyFormatMessage) {
+        Print(FormatMessage(message, threadState.DepthCounter).c_str());
+        return;
+    }
 
-    Print(str.c_str());
+    char str[MaxMessageLen];
+    FormatMessage(message, threadState.DepthCounter, str, sizeof(str));
+
+    Print(str);
 }
 
 void Tracer::OperationEnd(const Operation& op, OSStatus status)
@@ -134,9 +216,18 @@ void Tracer::OperationEnd(const Operation& op, OSStatus status)
         return;
     }
 
-    const auto str = FormatOperationEnd(op, status, threadState.DepthCounter);
+    if (legacyFormatHooks_.load(std::memory_order_relaxed) & LegacyFormatEnd) {
+        Print(FormatOperationEnd(op, status, threadState.DepthCounter).c_str());
+    } else {
+        char str[MaxMessageLen];
+        FormatOperationEnd(op, status, threadState.DepthCounter, str, sizeof(str));
+
+        Print(str);
+    }
 
-    Print(str.c_str());
+    if (threadState.DepthCounter == threadState.MatchCounter) {
+        threadState.MatchCounter = 0;
+    }
 
     if (threadState.DepthCounter != 0) {
         threadState.DepthCounter--;
@@ -145,95 +236,133 @@ void Tracer::OperationEnd(const Operation& op, OSStatus status)
     }
 }
 
-std::string Tracer::FormatOperationBegin(const Operation& op, UInt32 depth)
+void Tracer::FormatOperationBegin(const Operation& op,
+    UInt32 depth,
+    char* buf,
+    size_t bufSize)
 {
     if (depth > DepthSoftLimit) {
         depth = DepthSoftLimit;
     }
 
-    std::ostringstream ss;
+    size_t len = 0;
+    buf[0] = '\0';
 
     if (style_ == Style::Hierarchical) {
-        ss << "|";
-        for (UInt32 i = 0; i < depth; i++) {
-            ss << "-";
-        }
-        ss << " ";
+        AppendIndent(buf, bufSize, len, depth);
     }
 
-    ss << op.Name << " begin";
+    StringBuffer strBuf;
+
+    Append(buf, bufSize, len, "%s begin", op.Name);
 
     if (op.PropertyAddress) {
-        ss << " " << PropertySelectorToString(op.PropertyAddress->mSelector);
+        Append(buf,
+            bufSize,
+            len,
+            " %s",
+            PropertySelectorToString(op.PropertyAddress->mSelector, strBuf).data());
     }
 
     if (op.ClientPID != 0) {
-        ss << " clientPID=" << op.ClientPID;
+        Append(buf, bufSize, len, " clientPID=%d", int(op.ClientPID));
     }
 
-    ss << " objectID=" << op.ObjectID;
+    Append(buf, bufSize, len, " objectID=%u", unsigned(op.ObjectID));
 
     if (op.PropertyAddress) {
-        ss << " scope=" << PropertyScopeToString(op.PropertyAddress->mScope);
+        Append(buf,
+            bufSize,
+            len,
+            " scope=%s",
+            PropertyScopeToString(op.PropertyAddress->mScope, strBuf).data());
     }
 
     if (op.InDataSize != 0 || op.InData != nullptr) {
-        ss << " inSize=" << op.InDataSize;
+        Append(buf, bufSize, len, " inSize=%u", unsigned(op.InDataSize));
     }
 
     if (op.QualifierDataSize != 0 || op.QualifierData != nullptr) {
-        ss << " qualSize=" << op.QualifierDataSize;
+        Append(buf, bufSize, len, " qualSize=%u", unsigned(op.QualifierDataSize));
     }
-
-    return ss.str();
 }
 
-std::string Tracer::FormatMessage(const char* message, UInt32 depth)
+void Tracer::FormatMessage(const char* message, UInt32 depth, char* buf, size_t bufSize)
 {
     if (depth > DepthSoftLimit) {
         depth = DepthSoftLimit;
     }
 
-    std::ostringstream ss;
+    size_t len = 0;
+    buf[0] = '\0';
 
     if (style_ == Style::Hierarchical) {
-        ss << "|";
-        for (UInt32 i = 0; i <= depth; i++) {
-            ss << "-";
-        }
-        ss << " ";
+        AppendIndent(buf, bufSize, len, depth + 1);
     }
 
-    ss << message;
-
-    return ss.str();
+    Append(buf, bufSize, len, "%s", message);
 }
 
-std::string Tracer::FormatOperationEnd(const Operation& op, OSStatus status, UInt32 depth)
+void Tracer::FormatOperationEnd(const Operation& op,
+    OSStatus status,
+    UInt32 depth,
+    char* buf,
+    size_t bufSize)
 {
     if (depth > DepthSoftLimit) {
         depth = DepthSoftLimit;
     }
 
-    std::ostringstream ss;
+    size_t len = 0;
+    buf[0] = '\0';
 
     if (style_ == Style::Hierarchical) {
-        ss << "|";
-        for (UInt32 i = 0; i < depth; i++) {
-            ss << "-";
-        }
-        ss << " ";
+        AppendIndent(buf, bufSize, len, depth);
     }
 
-    ss << op.Name << " end";
+    StringBuffer strBuf;
 
-    ss << " status=" << StatusToString(status);
+    Append(buf,
+        bufSize,
+        len,
+        "%s end status=%s",
+        op.Name,
+        StatusToString(status, strBuf).data());
 
     if (status == kAudioHardwareNoError && op.OutDataSize != nullptr) {
-        ss << " outSize=" << *op.OutDataSize;
+        Append(buf, bufSize, len, " outSize=%u", unsigned(*op.OutDataSize));
     }
+}
+
+std::string Tracer::FormatOperationBegin(const Operation& op, UInt32 depth)
+{
+    // Not overridden, switch to buffer variant.
+    legacyFormatHooks_.fetch_and(~UInt32(LegacyFormatBegin), std::memory_order_relaxed);
+
+    char str[MaxMessageLen];
+    FormatOperationBegin(op, depth, str, sizeof(str));
 
-    return ss.str();
+    return str;
+}
+
+std::string Tracer::FormatMessage(const char* message, UInt32 depth)
+{
+    legacyFormatHooks_.fetch_and(~UInt32(LegacyFormatMessage), std::memory_order_relaxed);
+
+    char str[MaxMessageLen];
+    FormatMessage(message, depth, str, sizeof(str));
+
+    return str;
+}
+
+std::string Tracer::FormatOperationEnd(const Operation& op, OSStatus status, UInt32 depth)
+{
+    legacyFormatHooks_.fetch_and(~UInt32(LegacyFormatEnd), std::memory_order_relaxed);
+
+    char str[MaxMessageLen];
+    FormatOperationEnd(op, status, depth, str, sizeof(str));
+
+    return str;
 }
 
 void Tracer::Print(const char* message)
@@ -262,4 +391,62 @@ bool Tracer::ShouldIgnore(const Operation& operation)
     return false;
 }
 
+// Operation passes filter if it's not too deep and, if filter restricts objects
+// or selectors, if either the operation or one of its parents matches them.
+bool Tracer::IsFiltered(const Operation& op, ThreadLocalState& threadState)
+{
+    if (!hasFilter_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    auto readLock = filter_.GetReadLock();
+
+    const auto& filter = readLock.GetReference();
+    const UInt32 depth = threadState.DepthCounter;
+
+    if (filter.Source.MaxDepth != 0 && depth > filter.Source.MaxDepth) {
+        return true;
+    }
+
+    if (!filter.Restricted ||
+        (threadState.MatchCounter != 0 && depth > threadState.MatchCounter)) {
+        return false;
+    }
+
+    if (!filter.Source.ObjectIDs.empty()) {
+        const AudioObjectID objectID = op.ObjectID;
+
+        if (objectID < MaxBitsetObjectID) {
+            if (objectID / 64 >= filter.ObjectBits.size() ||
+                !(filter.ObjectBits[objectID / 64] & (UInt64(1) << (objectID % 64)))) {
+                return true;
+            }
+        } else if (!filter.LargeObjectIDs.count(objectID)) {
+            return true;
+        }
+    }
+
+    if (!filter.Selectors.empty()) {
+        if (!op.PropertyAddress ||
+            !filter.Selectors.count(op.PropertyAddress->mSelector)) {
+            return true;
+        }
+    }
+
+    threadState.MatchCounter = depth;
+
+    return false;
+}
+
+bool Tracer::IsMessageFiltered(const ThreadLocalState& threadState)
+{
+    if (threadState.MatchCounter != 0 || !hasFilter_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    auto readLock = filter_.GetReadLock();
+
+    return readLock.GetReference().Restricted;
+}
+
 } // namespace aspl
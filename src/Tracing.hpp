@@ -0,0 +1,72 @@
+// Copyright (c) libASPL authors
+// Licensed under MIT
+
+#pragma once
+
+#include <aspl/Tracer.hpp>
+
+// Tracing macros used by library code instead of calling Tracer directly.
+//
+// Arguments of ASPL_TRACE_MESSAGE() are evaluated only if the message is
+// going to be emitted, i.e. when tracer is not in Mode::Noop. This way
+// formatting helpers like Convert::ToString() don't allocate strings just
+// to be dropped by a disabled tracer.
+//
+// If library is built with ASPL_ENABLE_TRACING=0 (CMake option ENABLE_TRACING),
+// all macros compile to nothing, including construction of operation info.
+// Arguments are still type-checked.
+
+#ifndef ASPL_ENABLE_TRACING
+#define ASPL_ENABLE_TRACING 1
+#endif
+
+#if ASPL_ENABLE_TRACING
+
+#define ASPL_TRACE_BEGIN(tracer, operation)                                              \
+    do {                                                                                 \
+        auto&& aspl_tracer_ = (tracer);                                                  \
+        if (aspl_tracer_->IsEnabled()) {                                                 \
+            aspl_tracer_->OperationBegin(operation);                                     \
+        }                                                                                \
+    } while (0)
+
+#define ASPL_TRACE_MESSAGE(tracer, ...)                                                  \
+    do {                                                                                 \
+        auto&& aspl_tracer_ = (tracer);                                                  \
+        if (aspl_tracer_->IsEnabled()) {                                                 \
+            aspl_tracer_->Message(__VA_ARGS__);                                          \
+        }                                                                                \
+    } while (0)
+
+#define ASPL_TRACE_END(tracer, operation, status)                                        \
+    do {                                                                                 \
+        auto&& aspl_tracer_ = (tracer);                                                  \
+        if (aspl_tracer_->IsEnabled()) {                                                 \
+            aspl_tracer_->OperationEnd(operation, status);                               \
+        }                                                                                \
+    } while (0)
+
+#else // !ASPL_ENABLE_TRACING
+
+#define ASPL_TRACE_BEGIN(tracer, operation)                                              \
+    do {                                                                                 \
+        if (false) {                                                                     \
+            (tracer)->OperationBegin(operation);                                         \
+        }                                                                                \
+    } while (0)
+
+#define ASPL_TRACE_MESSAGE(tracer, ...)                                                  \
+    do {                                                                                 \
+        if (false) {                                                                     \
+            (tracer)->Message(__VA_ARGS__);                                              \
+        }                                                                                \
+    } while (0)
+
+#define ASPL_TRACE_END(tracer, operation, status)                                        \
+    do {                                                                                 \
+        if (false) {                                                                     \
+            (tracer)->OperationEnd(operation, status);                                   \
+        }                                                                                \
+    } while (0)
+
+#endif // ASPL_ENABLE_TRACING
@@ -5,23 +5,68 @@
 #include <aspl/VolumeControl.hpp>
 
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "VolumeCurve.hpp"
 
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace aspl {
 
+namespace {
+
+// Get curve for given ranges.
+// Curves are immutable, so controls with the same ranges share one instance.
+// Cache holds weak references, and curve is freed with its last control.
+std::shared_ptr<const VolumeCurve> GetSharedCurve(const VolumeControlParameters& params)
+{
+    using Key = std::tuple<SInt32, SInt32, Float32, Float32>;
+
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<const VolumeCurve>> cache;
+
+    const Key key(params.MinRawVolume,
+        params.MaxRawVolume,
+        params.MinDecibelVolume,
+        params.MaxDecibelVolume);
+
+    std::lock_guard lock(mutex);
+
+    if (auto curve = cache[key].lock()) {
+        return curve;
+    }
+
+    // Drop entries of freed curves.
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->first != key && it->second.expired()) {
+            it = cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto curve = std::make_shared<VolumeCurve>();
+    curve->AddRange(params.MinRawVolume,
+        params.MaxRawVolume,
+        params.MinDecibelVolume,
+        params.MaxDecibelVolume);
+
+    cache[key] = curve;
+
+    return curve;
+}
+
+} // namespace
+
 VolumeControl::VolumeControl(std::shared_ptr<const Context> context,
     const VolumeControlParameters& params)
     : Object(std::move(context), "VolumeControl")
     , params_(params)
-    , volumeCurve_(std::make_unique<VolumeCurve>())
+    , volumeCurve_(GetSharedCurve(params_))
     , rawVolume_(params_.MaxRawVolume)
 {
-    volumeCurve_->AddRange(params_.MinRawVolume,
-        params_.MaxRawVolume,
-        params_.MinDecibelVolume,
-        params_.MaxDecibelVolume);
 }
 
 AudioObjectPropertyScope VolumeControl::GetScope() const
@@ -47,21 +92,21 @@ OSStatus VolumeControl::SetRawValue(SInt32 value)
     op.Name = "VolumeControl::SetRawValue()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     OSStatus status = kAudioHardwareNoError;
 
     if (value == GetRawValue()) {
-        GetContext()->Tracer->Message("value not changed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "value not changed");
         goto end;
     }
 
-    GetContext()->Tracer->Message(
-        "setting raw value to %s", Convert::ToString(value).c_str());
+    ASPL_TRACE_MESSAGE(
+        GetTracer(), "setting raw value to %s", Convert::ToString(value).c_str());
 
     status = SetRawValueImpl(value);
     if (status != kAudioHardwareNoError) {
-        GetContext()->Tracer->Message("SetRawValueImpl() failed");
+        ASPL_TRACE_MESSAGE(GetTracer(), "SetRawValueImpl() failed");
         goto end;
     }
 
@@ -71,7 +116,7 @@ OSStatus VolumeControl::SetRawValue(SInt32 value)
         GetElement());
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -97,14 +142,14 @@ OSStatus VolumeControl::SetDecibelValue(Float32 value)
     op.Name = "VolumeControl::SetDecibelValue()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     value = std::min(value, volumeCurve_->GetMaximumDB());
     value = std::max(value, volumeCurve_->GetMinimumDB());
 
     const OSStatus status = SetRawValue(volumeCurve_->ConvertDBToRaw(value));
 
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
@@ -120,14 +165,14 @@ OSStatus VolumeControl::SetScalarValue(Float32 value)
     op.Name = "VolumeControl::SetScalarValue()";
     op.ObjectID = GetID();
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     value = std::min(value, 1.0f);
     value = std::max(value, 0.0f);
 
     const OSStatus status = SetRawValue(volumeCurve_->ConvertScalarToRaw(value));
 
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
 
     return status;
 }
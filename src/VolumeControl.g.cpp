@@ -2,7 +2,7 @@
 
 // Generator: generate-accessors.py
 // Source: VolumeControl.json
-// Timestamp: Sun Apr 13 14:12:49 2025 UTC
+// Timestamp: Mon Oct 19 08:16:50 2026 UTC
 
 // Copyright (c) libASPL authors
 // Licensed under MIT
@@ -10,7 +10,9 @@
 #include <aspl/VolumeControl.hpp>
 
 #include "Compare.hpp"
+#include "Completion.hpp"
 #include "Convert.hpp"
+#include "Tracing.hpp"
 #include "Traits.hpp"
 
 #include <algorithm>
@@ -53,10 +55,10 @@ Boolean VolumeControl::HasProperty(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         result = false;
         goto end;
     }
@@ -65,43 +67,43 @@ Boolean VolumeControl::HasProperty(AudioObjectID objectID,
         switch (address->mSelector) {
         case kAudioControlPropertyScope:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioControlPropertyElement:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioLevelControlPropertyScalarValue:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioLevelControlPropertyDecibelValue:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioLevelControlPropertyDecibelRange:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioLevelControlPropertyConvertScalarToDecibels:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
         case kAudioLevelControlPropertyConvertDecibelsToScalar:
             {
-                GetContext()->Tracer->Message("returning HasProperty=true");
+                ASPL_TRACE_MESSAGE(GetTracer(), "returning HasProperty=true");
                 result = true;
             }
             goto end;
@@ -111,7 +113,7 @@ Boolean VolumeControl::HasProperty(AudioObjectID objectID,
     result = Object::HasProperty(objectID, clientPID, address);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, kAudioHardwareNoError);
+    ASPL_TRACE_END(GetTracer(), op, kAudioHardwareNoError);
     return result;
 }
 
@@ -129,10 +131,10 @@ OSStatus VolumeControl::IsPropertySettable(AudioObjectID objectID,
     op.ClientPID = clientPID;
     op.PropertyAddress = address;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -142,70 +144,70 @@ OSStatus VolumeControl::IsPropertySettable(AudioObjectID objectID,
         case kAudioControlPropertyScope:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioControlPropertyElement:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyScalarValue:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyDecibelValue:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=true");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=true");
                     *outIsSettable = true;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyDecibelRange:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyConvertScalarToDecibels:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyConvertDecibelsToScalar:
             {
                 if (outIsSettable) {
-                    GetContext()->Tracer->Message("returning IsSettable=false");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning IsSettable=false");
                     *outIsSettable = false;
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -215,7 +217,7 @@ OSStatus VolumeControl::IsPropertySettable(AudioObjectID objectID,
     status = Object::IsPropertySettable(objectID, clientPID, address, outIsSettable);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -238,10 +240,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
     op.QualifierData = qualifierData;
     op.OutDataSize = outDataSize;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -252,10 +254,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyScope);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -263,10 +265,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyElement);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -274,10 +276,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -285,10 +287,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -296,10 +298,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioValueRange);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -307,10 +309,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -318,10 +320,10 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
             {
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
-                    GetContext()->Tracer->Message("returning PropertySize=%u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "returning PropertySize=%u",
                         unsigned(*outDataSize));
                 } else {
-                    GetContext()->Tracer->Message("output buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "output buffer is null");
                 }
             }
             goto end;
@@ -332,7 +334,7 @@ OSStatus VolumeControl::GetPropertyDataSize(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, outDataSize);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -359,10 +361,10 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
     op.OutDataSize = outDataSize;
     op.OutData = outData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -372,7 +374,7 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
         case kAudioControlPropertyScope:
             {
                 if (inDataSize < sizeof(AudioObjectPropertyScope)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectPropertyScope)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -381,25 +383,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyScope);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetScope();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectPropertyScope*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Scope=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioControlPropertyElement:
             {
                 if (inDataSize < sizeof(AudioObjectPropertyElement)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioObjectPropertyElement)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -408,25 +410,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioObjectPropertyElement);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetElement();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioObjectPropertyElement*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning Element=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyScalarValue:
             {
                 if (inDataSize < sizeof(Float32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(Float32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -435,25 +437,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetScalarValue();
                     Convert::ToFoundation(
                         value,
                         *static_cast<Float32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ScalarValue=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyDecibelValue:
             {
                 if (inDataSize < sizeof(Float32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(Float32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -462,25 +464,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetDecibelValue();
                     Convert::ToFoundation(
                         value,
                         *static_cast<Float32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DecibelValue=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyDecibelRange:
             {
                 if (inDataSize < sizeof(AudioValueRange)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(AudioValueRange)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -489,25 +491,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(AudioValueRange);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     const auto value = GetDecibelRange();
                     Convert::ToFoundation(
                         value,
                         *static_cast<AudioValueRange*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DecibelRange=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyConvertScalarToDecibels:
             {
                 if (inDataSize < sizeof(Float32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(Float32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -516,7 +518,7 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     std::remove_cv_t<std::remove_reference_t<method_return_type_t<
@@ -524,25 +526,25 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                     Convert::FromFoundation(
                         *static_cast<const Float32*>(outData),
                         inputValue);
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "obtained input ScalarToDecibels=%s",
                         Convert::ToString(inputValue).c_str());
                     const auto value = ConvertScalarToDecibels(inputValue);
                     Convert::ToFoundation(
                         value,
                         *static_cast<Float32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning ScalarToDecibels=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
         case kAudioLevelControlPropertyConvertDecibelsToScalar:
             {
                 if (inDataSize < sizeof(Float32)) {
-                    GetContext()->Tracer->Message("not enough space: need %u, avail %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "not enough space: need %u, avail %u",
                         unsigned(sizeof(Float32)),
                         unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
@@ -551,7 +553,7 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                 if (outDataSize) {
                     *outDataSize = sizeof(Float32);
                 } else {
-                    GetContext()->Tracer->Message("size buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "size buffer is null");
                 }
                 if (outData) {
                     std::remove_cv_t<std::remove_reference_t<method_return_type_t<
@@ -559,18 +561,18 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
                     Convert::FromFoundation(
                         *static_cast<const Float32*>(outData),
                         inputValue);
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "obtained input DecibelsToScalar=%s",
                         Convert::ToString(inputValue).c_str());
                     const auto value = ConvertDecibelsToScalar(inputValue);
                     Convert::ToFoundation(
                         value,
                         *static_cast<Float32*>(outData));
-                    GetContext()->Tracer->Message(
+                    ASPL_TRACE_MESSAGE(GetTracer(),
                         "returning DecibelsToScalar=%s",
                         Convert::ToString(value).c_str());
                 } else {
-                    GetContext()->Tracer->Message("data buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "data buffer is null");
                 }
             }
             goto end;
@@ -582,7 +584,7 @@ OSStatus VolumeControl::GetPropertyData(AudioObjectID objectID,
         inDataSize, outDataSize, outData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
@@ -606,10 +608,10 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
     op.InDataSize = inDataSize;
     op.InData = inData;
 
-    GetContext()->Tracer->OperationBegin(op);
+    ASPL_TRACE_BEGIN(GetTracer(), op);
 
     if (!address) {
-        GetContext()->Tracer->Message("address is null");
+        ASPL_TRACE_MESSAGE(GetTracer(), "address is null");
         status = kAudioHardwareIllegalOperationError;
         goto end;
     }
@@ -619,13 +621,13 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
         case kAudioLevelControlPropertyScalarValue:
             {
                 if (inDataSize != sizeof(Float32)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(Float32)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -634,12 +636,12 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const Float32*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting ScalarValue=%s",
                     Convert::ToString(value).c_str());
                 status = SetScalarValue(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -647,13 +649,13 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
         case kAudioLevelControlPropertyDecibelValue:
             {
                 if (inDataSize != sizeof(Float32)) {
-                    GetContext()->Tracer->Message("invalid size: should be %u, got %u",
+                    ASPL_TRACE_MESSAGE(GetTracer(), "invalid size: should be %u, got %u",
                         unsigned(sizeof(Float32)), unsigned(inDataSize));
                     status = kAudioHardwareBadPropertySizeError;
                     goto end;
                 }
                 if (!inData) {
-                    GetContext()->Tracer->Message("input buffer is null");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "input buffer is null");
                     status = kAudioHardwareIllegalOperationError;
                     goto end;
                 }
@@ -662,12 +664,12 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
                 Convert::FromFoundation(
                     *static_cast<const Float32*>(inData),
                     value);
-                GetContext()->Tracer->Message(
+                ASPL_TRACE_MESSAGE(GetTracer(),
                     "setting DecibelValue=%s",
                     Convert::ToString(value).c_str());
                 status = SetDecibelValue(std::move(value));
                 if (status != kAudioHardwareNoError) {
-                    GetContext()->Tracer->Message("setter failed");
+                    ASPL_TRACE_MESSAGE(GetTracer(), "setter failed");
                     goto end;
                 }
             }
@@ -679,7 +681,7 @@ OSStatus VolumeControl::SetPropertyData(AudioObjectID objectID,
         objectID, clientPID, address, qualifierDataSize, qualifierData, inDataSize, inData);
 
 end:
-    GetContext()->Tracer->OperationEnd(op, status);
+    ASPL_TRACE_END(GetTracer(), op, status);
     return status;
 }
 
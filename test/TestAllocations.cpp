@@ -0,0 +1,196 @@
+#include <aspl/Driver.hpp>
+
+#include "AllocationTracer.hpp"
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr UInt32 TestBufferSize = 256;
+constexpr UInt32 TestNumClients = 2;
+constexpr UInt32 TestNumCycles = 10;
+
+// Operations that are invoked on realtime thread during I/O cycle.
+const char* RealtimeOperations[] = {
+    "Device::GetZeroTimeStamp()",
+    "Device::WillDoIOOperation()",
+    "Device::DoIOOperation()",
+};
+
+class RecordingTracer : public aspl::Tracer
+{
+public:
+    std::vector<std::string> names;
+
+    RecordingTracer()
+        : aspl::Tracer(aspl::Tracer::Mode::Custom)
+    {
+    }
+
+    void OperationBegin(const Operation& operation) override
+    {
+        names.push_back(operation.Name);
+    }
+};
+
+} // anonymous namespace
+
+struct AllocationsTest : ::testing::Test
+{
+    std::shared_ptr<aspl::AllocationTracer> tracer =
+        std::make_shared<aspl::AllocationTracer>(std::make_shared<TestTracer>());
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        tracer, nullptr, std::make_shared<aspl::SimulatedClock>());
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<aspl::Device> CreateDevice()
+    {
+        aspl::DeviceParameters params;
+        params.ZeroTimeStampPeriod = TestBufferSize;
+        params.EnableRealtimeTracing = true;
+
+        auto device = std::make_shared<aspl::Device>(context, params);
+
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+};
+
+TEST_F(AllocationsTest, Attribution)
+{
+    aspl::Tracer::Operation outer;
+    outer.Name = "Outer";
+
+    aspl::Tracer::Operation inner;
+    inner.Name = "Inner";
+
+    tracer->OperationBegin(outer);
+    void* outerPtr = ::operator new(100);
+
+    tracer->OperationBegin(inner);
+    void* innerPtr1 = ::operator new(10);
+    void* innerPtr2 = ::operator new(20);
+    ::operator delete(innerPtr1);
+    ::operator delete(innerPtr2);
+    tracer->OperationEnd(inner, kAudioHardwareNoError);
+
+    ::operator delete(outerPtr);
+    tracer->OperationEnd(outer, kAudioHardwareNoError);
+
+    // allocations outside of operations are ignored
+    ::operator delete(::operator new(1000));
+
+    const auto outerReport = tracer->GetOperationReport("Outer");
+
+    EXPECT_EQ(1, outerReport.NumCalls);
+    EXPECT_EQ(1, outerReport.NumAllocations);
+    EXPECT_EQ(100, outerReport.NumBytes);
+
+    const auto innerReport = tracer->GetOperationReport("Inner");
+
+    EXPECT_EQ(1, innerReport.NumCalls);
+    EXPECT_EQ(2, innerReport.NumAllocations);
+    EXPECT_EQ(30, innerReport.NumBytes);
+
+    const auto report = tracer->GetReport();
+
+    ASSERT_EQ(2, report.size());
+    EXPECT_EQ("Inner", report[0].OperationName);
+    EXPECT_EQ("Outer", report[1].OperationName);
+
+    tracer->Reset();
+
+    EXPECT_TRUE(tracer->GetReport().empty());
+}
+
+TEST_F(AllocationsTest, Forwarding)
+{
+    auto recordingTracer = std::make_shared<RecordingTracer>();
+    auto allocTracer = std::make_shared<aspl::AllocationTracer>(recordingTracer);
+
+    aspl::Tracer::Operation op;
+    op.Name = "Op";
+
+    allocTracer->OperationBegin(op);
+    allocTracer->Message("message %d", 1);
+    allocTracer->OperationEnd(op, kAudioHardwareNoError);
+
+    ASSERT_EQ(1, recordingTracer->names.size());
+    EXPECT_EQ("Op", recordingTracer->names[0]);
+
+    // allocations made by inner tracer are excluded
+    EXPECT_EQ(0, allocTracer->GetOperationReport("Op").NumAllocations);
+}
+
+TEST_F(AllocationsTest, Selectors)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.QueryProperties(device->GetID()));
+
+    bool foundStreams = false;
+    bool foundVirtualFormat = false;
+
+    for (const auto& entry : tracer->GetReport()) {
+        if (entry.OperationName == "Device::GetPropertyData()" &&
+            entry.Selector == kAudioDevicePropertyStreams) {
+            EXPECT_EQ(1, entry.NumCalls);
+            foundStreams = true;
+        }
+        if (entry.OperationName == "Stream::GetPropertyData()" &&
+            entry.Selector == kAudioStreamPropertyVirtualFormat) {
+            // one input and one output stream
+            EXPECT_EQ(2, entry.NumCalls);
+            foundVirtualFormat = true;
+        }
+    }
+
+    EXPECT_TRUE(foundStreams);
+    EXPECT_TRUE(foundVirtualFormat);
+}
+
+TEST_F(AllocationsTest, Realtime)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulatorParameters params;
+    params.NumClients = TestNumClients;
+    params.BufferFrameSize = TestBufferSize;
+
+    aspl::HostSimulator simulator(driver, params);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+
+    tracer->Reset();
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(TestNumCycles));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    for (const char* name : RealtimeOperations) {
+        const auto report = tracer->GetOperationReport(name);
+
+        EXPECT_GT(report.NumCalls, 0) << name;
+        EXPECT_EQ(0, report.NumAllocations) << name;
+        EXPECT_EQ(0, report.NumBytes) << name;
+    }
+}
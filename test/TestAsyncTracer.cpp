@@ -0,0 +1,261 @@
+#include <aspl/AsyncTracer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+// Temporary file is used instead of pipe, so that writer thread never blocks.
+class OutputFile
+{
+public:
+    OutputFile()
+        : fp_(tmpfile())
+    {
+    }
+
+    ~OutputFile()
+    {
+        fclose(fp_);
+    }
+
+    int GetDescriptor() const
+    {
+        return fileno(fp_);
+    }
+
+    std::string Read() const
+    {
+        std::string result;
+
+        char buf[4096];
+        off_t offset = 0;
+
+        for (;;) {
+            const ssize_t ret = pread(fileno(fp_), buf, sizeof(buf), offset);
+            if (ret <= 0) {
+                break;
+            }
+            result.append(buf, size_t(ret));
+            offset += ret;
+        }
+
+        return result;
+    }
+
+    size_t CountLines() const
+    {
+        const auto str = Read();
+
+        return size_t(std::count(str.begin(), str.end(), '\n'));
+    }
+
+private:
+    FILE* fp_;
+};
+
+aspl::AsyncTracerParameters MakeParams(const OutputFile& file)
+{
+    aspl::AsyncTracerParameters params;
+    params.Mode = aspl::Tracer::Mode::Stderr;
+    params.Style = aspl::Tracer::Style::Flat;
+    params.FileDescriptor = file.GetDescriptor();
+    params.PollInterval = 1000;
+
+    return params;
+}
+
+} // anonymous namespace
+
+TEST(AsyncTracerTest, Messages)
+{
+    OutputFile file;
+
+    aspl::AsyncTracer tracer(MakeParams(file));
+
+    tracer.Message("foo %d", 1);
+    tracer.Message("bar %d", 2);
+    tracer.Message("baz %d", 3);
+
+    tracer.Flush();
+
+    EXPECT_EQ("[aspl] foo 1\n[aspl] bar 2\n[aspl] baz 3\n", file.Read());
+
+    const auto stats = tracer.GetStats();
+
+    EXPECT_EQ(3, stats.NumQueuedMessages);
+    EXPECT_EQ(0, stats.NumDroppedMessages);
+    EXPECT_EQ(3, stats.NumWrittenMessages);
+    EXPECT_GE(stats.NumWriteCalls, 1);
+}
+
+TEST(AsyncTracerTest, Operations)
+{
+    OutputFile file;
+
+    aspl::AsyncTracer tracer(MakeParams(file));
+
+    aspl::Tracer::Operation op;
+    op.Name = "Test::Op()";
+    op.ObjectID = 123;
+
+    tracer.OperationBegin(op);
+    tracer.Message("message");
+    tracer.OperationEnd(op, kAudioHardwareNoError);
+
+    tracer.Flush();
+
+    EXPECT_EQ(3, file.CountLines());
+    EXPECT_NE(std::string::npos, file.Read().find("Test::Op() begin objectID=123"));
+}
+
+TEST(AsyncTracerTest, Noop)
+{
+    OutputFile file;
+
+    auto params = MakeParams(file);
+    params.Mode = aspl::Tracer::Mode::Noop;
+
+    aspl::AsyncTracer tracer(params);
+
+    EXPECT_FALSE(tracer.IsEnabled());
+
+    tracer.Message("foo");
+    tracer.Flush();
+
+    EXPECT_EQ("", file.Read());
+    EXPECT_EQ(0, tracer.GetStats().NumQueuedMessages);
+}
+
+TEST(AsyncTracerTest, Truncation)
+{
+    OutputFile file;
+
+    auto params = MakeParams(file);
+    params.MaxMessageLen = 64;
+
+    aspl::AsyncTracer tracer(params);
+
+    const std::string longMessage(200, 'x');
+
+    tracer.Message("%s", longMessage.c_str());
+    tracer.Flush();
+
+    const auto str = file.Read();
+
+    ASSERT_EQ(63, str.size());
+    EXPECT_EQ('\n', str.back());
+    EXPECT_EQ(0, str.find("[aspl] xxx"));
+}
+
+TEST(AsyncTracerTest, Drops)
+{
+    OutputFile file;
+
+    {
+        auto params = MakeParams(file);
+        params.QueueSize = 4;
+        params.PollInterval = 200000;
+
+        aspl::AsyncTracer tracer(params);
+
+        // let writer thread fall asleep on empty queue
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        for (int n = 0; n < 10; n++) {
+            tracer.Message("message %d", n);
+        }
+
+        const auto stats = tracer.GetStats();
+
+        EXPECT_EQ(4, stats.NumQueuedMessages);
+        EXPECT_EQ(6, stats.NumDroppedMessages);
+    }
+
+    // queued messages and drop report are written on destruction
+    const auto str = file.Read();
+
+    EXPECT_EQ(5, file.CountLines());
+    EXPECT_NE(std::string::npos, str.find("[aspl] message 3\n"));
+    EXPECT_EQ(std::string::npos, str.find("[aspl] message 4\n"));
+    EXPECT_NE(std::string::npos, str.find("[aspl] dropped 6 messages\n"));
+}
+
+TEST(AsyncTracerTest, FlushOnDestruction)
+{
+    OutputFile file;
+
+    {
+        auto params = MakeParams(file);
+        params.PollInterval = 200000;
+
+        aspl::AsyncTracer tracer(params);
+
+        for (int n = 0; n < 100; n++) {
+            tracer.Message("message %d", n);
+        }
+    }
+
+    EXPECT_EQ(100, file.CountLines());
+}
+
+TEST(AsyncTracerTest, ManyThreads)
+{
+    constexpr int NumThreads = 4;
+    constexpr int NumMessages = 5000;
+
+    OutputFile file;
+
+    aspl::AsyncTracerStats stats;
+
+    {
+        auto params = MakeParams(file);
+        params.QueueSize = 256;
+
+        aspl::AsyncTracer tracer(params);
+
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < NumThreads; t++) {
+            threads.emplace_back([&tracer, t] {
+                for (int n = 0; n < NumMessages; n++) {
+                    tracer.Message("thread %d message %d", t, n);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        tracer.Flush();
+
+        stats = tracer.GetStats();
+    }
+
+    EXPECT_EQ(
+        NumThreads * NumMessages, stats.NumQueuedMessages + stats.NumDroppedMessages);
+    EXPECT_EQ(stats.NumQueuedMessages, stats.NumWrittenMessages);
+
+    // every queued message is written as a whole line
+    const auto str = file.Read();
+
+    size_t numMessageLines = 0;
+    size_t pos = 0;
+
+    while ((pos = str.find("[aspl] thread ", pos)) != std::string::npos) {
+        numMessageLines++;
+        pos++;
+    }
+
+    EXPECT_EQ(stats.NumQueuedMessages, numMessageLines);
+}
@@ -0,0 +1,182 @@
+#include <aspl/Driver.hpp>
+
+#include "TestTracer.hpp"
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr UInt32 TestClientID = 111;
+
+} // anonymous namespace
+
+struct BridgeTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(tracer);
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<aspl::Device> CreateDevice()
+    {
+        auto device = std::make_shared<aspl::Device>(context);
+        plugin->AddDevice(device);
+        return device;
+    }
+
+    OSStatus StartIO(AudioObjectID deviceID)
+    {
+        return driver->GetPluginInterface().StartIO(
+            driver->GetReference(), deviceID, TestClientID);
+    }
+
+    OSStatus StopIO(AudioObjectID deviceID)
+    {
+        return driver->GetPluginInterface().StopIO(
+            driver->GetReference(), deviceID, TestClientID);
+    }
+
+    OSStatus GetZeroTimeStamp(AudioObjectID deviceID)
+    {
+        Float64 sampleTime = 0;
+        UInt64 hostTime = 0;
+        UInt64 seed = 0;
+
+        return driver->GetPluginInterface().GetZeroTimeStamp(driver->GetReference(),
+            deviceID,
+            TestClientID,
+            &sampleTime,
+            &hostTime,
+            &seed);
+    }
+};
+
+TEST_F(BridgeTest, NotRunning)
+{
+    auto device = CreateDevice();
+
+    // device is found via dispatcher
+    EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(device->GetID()));
+
+    // unknown device
+    EXPECT_EQ(kAudioHardwareBadObjectError, GetZeroTimeStamp(device->GetID() + 100));
+}
+
+TEST_F(BridgeTest, RunningBypassesDispatcher)
+{
+    auto device = CreateDevice();
+    const auto deviceID = device->GetID();
+
+    ASSERT_EQ(kAudioHardwareNoError, StartIO(deviceID));
+
+    // while running, device is resolved without dispatcher
+    context->Dispatcher->UnregisterObject(deviceID);
+
+    EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(deviceID));
+
+    context->Dispatcher->RegisterObject(*device, deviceID);
+
+    ASSERT_EQ(kAudioHardwareNoError, StopIO(deviceID));
+
+    // after stop, dispatcher is used again
+    context->Dispatcher->UnregisterObject(deviceID);
+
+    EXPECT_EQ(kAudioHardwareBadObjectError, GetZeroTimeStamp(deviceID));
+
+    context->Dispatcher->RegisterObject(*device, deviceID);
+}
+
+TEST_F(BridgeTest, NestedStart)
+{
+    auto device = CreateDevice();
+    const auto deviceID = device->GetID();
+
+    ASSERT_EQ(kAudioHardwareNoError, StartIO(deviceID));
+    ASSERT_EQ(kAudioHardwareNoError, StartIO(deviceID));
+
+    context->Dispatcher->UnregisterObject(deviceID);
+    context->Dispatcher->RegisterObject(*device, deviceID);
+
+    // device remains pinned until last stop
+    ASSERT_EQ(kAudioHardwareNoError, StopIO(deviceID));
+
+    context->Dispatcher->UnregisterObject(deviceID);
+    EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(deviceID));
+    context->Dispatcher->RegisterObject(*device, deviceID);
+
+    ASSERT_EQ(kAudioHardwareNoError, StopIO(deviceID));
+
+    context->Dispatcher->UnregisterObject(deviceID);
+    EXPECT_EQ(kAudioHardwareBadObjectError, GetZeroTimeStamp(deviceID));
+    context->Dispatcher->RegisterObject(*device, deviceID);
+}
+
+TEST_F(BridgeTest, FailedStart)
+{
+    auto device = CreateDevice();
+    const auto deviceID = device->GetID();
+
+    ASSERT_EQ(kAudioHardwareNoError, StartIO(deviceID));
+    ASSERT_EQ(kAudioHardwareNoError, StopIO(deviceID));
+
+    // failed start doesn't pin device
+    EXPECT_EQ(kAudioHardwareBadObjectError, StartIO(deviceID + 100));
+    EXPECT_EQ(kAudioHardwareBadObjectError, GetZeroTimeStamp(deviceID + 100));
+}
+
+TEST_F(BridgeTest, KeepsDeviceAlive)
+{
+    auto device = CreateDevice();
+    const auto deviceID = device->GetID();
+
+    std::weak_ptr<aspl::Device> weakDevice = device;
+
+    ASSERT_EQ(kAudioHardwareNoError, StartIO(deviceID));
+
+    plugin->RemoveDevice(device);
+    device.reset();
+
+    // pinned device is not destroyed while I/O is running
+    EXPECT_FALSE(weakDevice.expired());
+    EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(deviceID));
+
+    ASSERT_EQ(kAudioHardwareNoError, StopIO(deviceID));
+
+    EXPECT_TRUE(weakDevice.expired());
+}
+
+TEST_F(BridgeTest, ManyDevices)
+{
+    // more running devices than cache slots
+    std::vector<std::shared_ptr<aspl::Device>> devices;
+
+    for (int n = 0; n < 40; n++) {
+        devices.push_back(CreateDevice());
+        ASSERT_EQ(kAudioHardwareNoError, StartIO(devices.back()->GetID()));
+    }
+
+    // devices without slot are found via dispatcher
+    for (const auto& device : devices) {
+        EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(device->GetID()));
+    }
+
+    for (const auto& device : devices) {
+        ASSERT_EQ(kAudioHardwareNoError, StopIO(device->GetID()));
+    }
+
+    // slots are reused
+    for (const auto& device : devices) {
+        ASSERT_EQ(kAudioHardwareNoError, StartIO(device->GetID()));
+        EXPECT_EQ(kAudioHardwareNoError, GetZeroTimeStamp(device->GetID()));
+        ASSERT_EQ(kAudioHardwareNoError, StopIO(device->GetID()));
+    }
+}
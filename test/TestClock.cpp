@@ -0,0 +1,153 @@
+#include <aspl/Clock.hpp>
+#include <aspl/Device.hpp>
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+struct ClockTest : ::testing::Test
+{
+    static constexpr UInt32 TestSampleRate = 48000;
+    static constexpr UInt32 TestPeriod = 480;
+
+    // 1 tick = 1 ns, 1 period = 10 ms
+    static constexpr UInt64 TicksPerPeriod = 10000000;
+
+    static constexpr UInt64 StartTime = 1000;
+
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::SimulatedClock> clock =
+        std::make_shared<aspl::SimulatedClock>(1000000000.0, StartTime);
+
+    std::shared_ptr<aspl::Context> context =
+        std::make_shared<aspl::Context>(tracer, nullptr, clock);
+
+    std::shared_ptr<aspl::Device> device;
+
+    void SetUp() override
+    {
+        aspl::DeviceParameters params;
+        params.SampleRate = TestSampleRate;
+        params.ZeroTimeStampPeriod = TestPeriod;
+
+        device = std::make_shared<aspl::Device>(context, params);
+    }
+
+    void ExpectZeroTimeStamp(Float64 expectedSampleTime, UInt64 expectedHostTime)
+    {
+        Float64 sampleTime = 0;
+        UInt64 hostTime = 0;
+        UInt64 seed = 0;
+
+        ASSERT_EQ(kAudioHardwareNoError,
+            device->GetZeroTimeStamp(device->GetID(), 0, &sampleTime, &hostTime, &seed));
+
+        EXPECT_EQ(expectedSampleTime, sampleTime);
+        EXPECT_EQ(expectedHostTime, hostTime);
+        EXPECT_EQ(1, seed);
+    }
+};
+
+TEST_F(ClockTest, Simulated)
+{
+    aspl::SimulatedClock clock(1000.0, 100);
+
+    EXPECT_EQ(1000.0, clock.GetHostClockFrequency());
+    EXPECT_EQ(100, clock.GetHostTime());
+
+    clock.AdvanceHostTime(10);
+    EXPECT_EQ(110, clock.GetHostTime());
+
+    clock.AdvanceFrames(441, 44100);
+    EXPECT_EQ(120, clock.GetHostTime());
+
+    clock.SetHostTime(5);
+    EXPECT_EQ(5, clock.GetHostTime());
+}
+
+TEST_F(ClockTest, Monotonic)
+{
+    aspl::MonotonicClock clock;
+
+    EXPECT_EQ(1000000000.0, clock.GetHostClockFrequency());
+
+    UInt64 prevTime = clock.GetHostTime();
+    EXPECT_NE(0, prevTime);
+
+    for (int n = 0; n < 1000; n++) {
+        const UInt64 curTime = clock.GetHostTime();
+        EXPECT_GE(curTime, prevTime);
+        prevTime = curTime;
+    }
+}
+
+TEST_F(ClockTest, DefaultClock)
+{
+    auto defaultContext = std::make_shared<aspl::Context>(tracer);
+
+    ASSERT_TRUE(defaultContext->Clock);
+    EXPECT_GT(defaultContext->Clock->GetHostClockFrequency(), 0);
+}
+
+TEST_F(ClockTest, ZeroTimeStamp)
+{
+    ASSERT_EQ(kAudioHardwareNoError, device->StartIO(device->GetID(), 0));
+
+    ExpectZeroTimeStamp(0, StartTime);
+
+    // less than one period
+    clock->AdvanceHostTime(TicksPerPeriod / 2);
+    ExpectZeroTimeStamp(0, StartTime);
+
+    // exactly one period since start
+    clock->AdvanceHostTime(TicksPerPeriod / 2);
+    ExpectZeroTimeStamp(TestPeriod, StartTime + TicksPerPeriod);
+
+    // frame-based advance
+    clock->AdvanceFrames(TestPeriod, TestSampleRate);
+    ExpectZeroTimeStamp(TestPeriod * 2, StartTime + TicksPerPeriod * 2);
+
+    ASSERT_EQ(kAudioHardwareNoError, device->StopIO(device->GetID(), 0));
+}
+
+TEST_F(ClockTest, ZeroTimeStampCatchUp)
+{
+    ASSERT_EQ(kAudioHardwareNoError, device->StartIO(device->GetID(), 0));
+
+    ExpectZeroTimeStamp(0, StartTime);
+
+    // jump three periods ahead, zero timestamp advances one period per call
+    clock->AdvanceHostTime(TicksPerPeriod * 3);
+
+    ExpectZeroTimeStamp(TestPeriod, StartTime + TicksPerPeriod);
+    ExpectZeroTimeStamp(TestPeriod * 2, StartTime + TicksPerPeriod * 2);
+    ExpectZeroTimeStamp(TestPeriod * 3, StartTime + TicksPerPeriod * 3);
+    ExpectZeroTimeStamp(TestPeriod * 3, StartTime + TicksPerPeriod * 3);
+
+    ASSERT_EQ(kAudioHardwareNoError, device->StopIO(device->GetID(), 0));
+}
+
+TEST_F(ClockTest, ZeroTimeStampRestart)
+{
+    ASSERT_EQ(kAudioHardwareNoError, device->StartIO(device->GetID(), 0));
+
+    clock->AdvanceHostTime(TicksPerPeriod);
+    ExpectZeroTimeStamp(TestPeriod, StartTime + TicksPerPeriod);
+
+    ASSERT_EQ(kAudioHardwareNoError, device->StopIO(device->GetID(), 0));
+
+    // anchor is reset when I/O is restarted
+    clock->AdvanceHostTime(TicksPerPeriod / 4);
+
+    const UInt64 restartTime = clock->GetHostTime();
+
+    ASSERT_EQ(kAudioHardwareNoError, device->StartIO(device->GetID(), 0));
+
+    ExpectZeroTimeStamp(0, restartTime);
+
+    clock->AdvanceHostTime(TicksPerPeriod);
+    ExpectZeroTimeStamp(TestPeriod, restartTime + TicksPerPeriod);
+
+    ASSERT_EQ(kAudioHardwareNoError, device->StopIO(device->GetID(), 0));
+}
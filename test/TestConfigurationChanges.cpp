@@ -0,0 +1,362 @@
+#include <aspl/Driver.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+namespace {
+
+bool IsReady(const std::future<OSStatus>& future)
+{
+    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+} // anonymous namespace
+
+struct ConfigurationChangesTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(tracer);
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<aspl::Device> CreateDevice(bool coalesce = true)
+    {
+        aspl::DeviceParameters params;
+        params.CoalesceConfigurationChanges = coalesce;
+
+        auto device = std::make_shared<aspl::Device>(context, params);
+
+        device->AddStreamAsync(aspl::Direction::Output);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+};
+
+TEST_F(ConfigurationChangesTest, Coalesce)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<int> order;
+
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+    device->RequestConfigurationChange([&] { order.push_back(3); });
+
+    // all changes are merged into one HAL request
+    EXPECT_EQ(1, simulator.GetConfigurationRequestCount());
+    EXPECT_TRUE(order.empty());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), order);
+
+    // after request is performed, new request is sent
+    device->RequestConfigurationChange([&] { order.push_back(4); });
+
+    EXPECT_EQ(2, simulator.GetConfigurationRequestCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), order);
+}
+
+TEST_F(ConfigurationChangesTest, NoCoalesce)
+{
+    auto device = CreateDevice(false);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<int> order;
+
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+
+    EXPECT_EQ(2, simulator.GetConfigurationRequestCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({1, 2}), order);
+}
+
+TEST_F(ConfigurationChangesTest, Setters)
+{
+    auto device = CreateDevice();
+    auto stream = device->GetStreamByIndex(aspl::Direction::Output, 0);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    ASSERT_EQ(kAudioHardwareNoError, device->SetZeroTimeStampPeriodAsync(960));
+    ASSERT_EQ(kAudioHardwareNoError, device->SetLatencyAsync(123));
+    ASSERT_EQ(kAudioHardwareNoError, device->SetSafetyOffsetAsync(456));
+    ASSERT_EQ(kAudioHardwareNoError, stream->SetLatencyAsync(789));
+
+    EXPECT_EQ(1, simulator.GetConfigurationRequestCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(960, device->GetZeroTimeStampPeriod());
+    EXPECT_EQ(123, device->GetLatency());
+    EXPECT_EQ(456, device->GetSafetyOffset());
+    EXPECT_EQ(789, stream->GetLatency());
+}
+
+TEST_F(ConfigurationChangesTest, Batch)
+{
+    auto device = CreateDevice(false);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<int> order;
+
+    device->BeginConfigurationBatch();
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+
+    device->BeginConfigurationBatch();
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+    device->EndConfigurationBatch();
+
+    device->RequestConfigurationChange([&] { order.push_back(3); });
+
+    // nothing is sent until outermost batch ends
+    EXPECT_EQ(0, simulator.GetConfigurationRequestCount());
+
+    device->EndConfigurationBatch();
+
+    EXPECT_EQ(1, simulator.GetConfigurationRequestCount());
+    EXPECT_TRUE(order.empty());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), order);
+}
+
+TEST_F(ConfigurationChangesTest, BatchInPlace)
+{
+    // device is not published, so changes are applied in-place
+    auto device = std::make_shared<aspl::Device>(context);
+
+    std::vector<int> order;
+
+    device->BeginConfigurationBatch();
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+
+    EXPECT_TRUE(order.empty());
+
+    device->EndConfigurationBatch();
+
+    EXPECT_EQ(std::vector<int>({1, 2}), order);
+}
+
+TEST_F(ConfigurationChangesTest, Abort)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<int> order;
+
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+
+    ASSERT_EQ(1, simulator.GetConfigurationRequestCount());
+
+    // all merged changes are aborted together
+    ASSERT_EQ(kAudioHardwareNoError,
+        device->AbortConfigurationChange(device->GetID(), 0, nullptr));
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_TRUE(order.empty());
+
+    // new request is not merged into aborted one
+    device->RequestConfigurationChange([&] { order.push_back(3); });
+
+    EXPECT_EQ(2, simulator.GetConfigurationRequestCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({3}), order);
+}
+
+TEST_F(ConfigurationChangesTest, RemoveDevice)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<int> order;
+
+    device->RequestConfigurationChange([&] { order.push_back(1); });
+    device->RequestConfigurationChange([&] { order.push_back(2); });
+
+    // pending changes are applied when device is removed
+    plugin->RemoveDevice(device);
+
+    EXPECT_EQ(std::vector<int>({1, 2}), order);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(std::vector<int>({1, 2}), order);
+}
+
+TEST_F(ConfigurationChangesTest, Result)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    auto result1 = device->RequestConfigurationChangeWithResult(
+        [] { return kAudioHardwareNoError; });
+    auto result2 = device->RequestConfigurationChangeWithResult(
+        [] { return kAudioHardwareIllegalOperationError; });
+
+    EXPECT_FALSE(IsReady(result1));
+    EXPECT_FALSE(IsReady(result2));
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    ASSERT_TRUE(IsReady(result1));
+    ASSERT_TRUE(IsReady(result2));
+
+    EXPECT_EQ(kAudioHardwareNoError, result1.get());
+    EXPECT_EQ(kAudioHardwareIllegalOperationError, result2.get());
+}
+
+TEST_F(ConfigurationChangesTest, ResultAborted)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    bool invoked = false;
+
+    auto result = device->RequestConfigurationChangeWithResult([&] {
+        invoked = true;
+        return kAudioHardwareNoError;
+    });
+
+    EXPECT_FALSE(IsReady(result));
+
+    ASSERT_EQ(kAudioHardwareNoError,
+        device->AbortConfigurationChange(device->GetID(), 0, nullptr));
+
+    ASSERT_TRUE(IsReady(result));
+    EXPECT_EQ(aspl::Device::ConfigurationChangeAbortedError, result.get());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_FALSE(invoked);
+}
+
+TEST_F(ConfigurationChangesTest, ResultInPlace)
+{
+    // device is not published, so changes are applied in-place
+    auto device = std::make_shared<aspl::Device>(context);
+
+    auto result = device->RequestConfigurationChangeWithResult(
+        [] { return kAudioHardwareNoError; });
+
+    ASSERT_TRUE(IsReady(result));
+    EXPECT_EQ(kAudioHardwareNoError, result.get());
+}
+
+TEST_F(ConfigurationChangesTest, SetterResult)
+{
+    auto device = CreateDevice();
+    auto stream = device->GetStreamByIndex(aspl::Direction::Output, 0);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::future<OSStatus> deviceResult;
+    std::future<OSStatus> streamResult;
+
+    ASSERT_EQ(kAudioHardwareNoError, device->SetLatencyAsync(123, &deviceResult));
+    ASSERT_EQ(kAudioHardwareNoError, stream->SetLatencyAsync(456, &streamResult));
+
+    EXPECT_FALSE(IsReady(deviceResult));
+    EXPECT_FALSE(IsReady(streamResult));
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    ASSERT_TRUE(IsReady(deviceResult));
+    ASSERT_TRUE(IsReady(streamResult));
+
+    EXPECT_EQ(kAudioHardwareNoError, deviceResult.get());
+    EXPECT_EQ(kAudioHardwareNoError, streamResult.get());
+
+    EXPECT_EQ(123, device->GetLatency());
+    EXPECT_EQ(456, stream->GetLatency());
+}
+
+TEST_F(ConfigurationChangesTest, SetterResultImmediate)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::future<OSStatus> result;
+
+    // value not changed
+    ASSERT_EQ(kAudioHardwareNoError,
+        device->SetLatencyAsync(device->GetLatency(), &result));
+
+    ASSERT_TRUE(IsReady(result));
+    EXPECT_EQ(kAudioHardwareNoError, result.get());
+
+    // value is invalid
+    ASSERT_EQ(kAudioHardwareUnsupportedOperationError,
+        device->SetNominalSampleRateAsync(12345, &result));
+
+    ASSERT_TRUE(IsReady(result));
+    EXPECT_EQ(kAudioHardwareUnsupportedOperationError, result.get());
+
+    EXPECT_EQ(0, simulator.GetConfigurationRequestCount());
+}
+
+TEST_F(ConfigurationChangesTest, StreamResultWithoutDevice)
+{
+    auto stream = std::make_shared<aspl::Stream>(context, nullptr);
+
+    std::future<OSStatus> result;
+
+    ASSERT_EQ(kAudioHardwareNoError, stream->SetLatencyAsync(123, &result));
+
+    ASSERT_TRUE(IsReady(result));
+    EXPECT_EQ(aspl::Device::ConfigurationChangeAbortedError, result.get());
+}
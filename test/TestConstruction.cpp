@@ -1,6 +1,8 @@
 #include <aspl/Device.hpp>
+#include <aspl/Driver.hpp>
 #include <aspl/Plugin.hpp>
 
+#include "HostSimulator.hpp"
 #include "TestTracer.hpp"
 
 #include <gtest/gtest.h>
@@ -39,6 +41,130 @@ TEST_F(ConstructionTest, Device)
     ASSERT_FALSE(plugin->GetDeviceByID(device->GetID()));
 }
 
+TEST_F(ConstructionTest, DeviceUID)
+{
+    const auto plugin = std::make_shared<aspl::Plugin>(context);
+
+    aspl::DeviceParameters devParams;
+
+    devParams.DeviceUID = "uid1";
+    const auto device1 = std::make_shared<aspl::Device>(context, devParams);
+
+    devParams.DeviceUID = "uid2";
+    const auto device2 = std::make_shared<aspl::Device>(context, devParams);
+
+    plugin->AddDevice(device1);
+    plugin->AddDevice(device2);
+
+    EXPECT_EQ(device1->GetID(), plugin->GetDeviceIDByUID("uid1"));
+    EXPECT_EQ(device2->GetID(), plugin->GetDeviceIDByUID("uid2"));
+    EXPECT_EQ(kAudioObjectUnknown, plugin->GetDeviceIDByUID("uid3"));
+
+    // device with the same UID replaces previous one in lookups
+    devParams.DeviceUID = "uid1";
+    const auto device3 = std::make_shared<aspl::Device>(context, devParams);
+
+    plugin->AddDevice(device3);
+    EXPECT_EQ(device3->GetID(), plugin->GetDeviceIDByUID("uid1"));
+
+    // removing replaced device doesn't affect lookups
+    plugin->RemoveDevice(device1);
+    EXPECT_EQ(device3->GetID(), plugin->GetDeviceIDByUID("uid1"));
+
+    plugin->RemoveDevice(device3);
+    EXPECT_EQ(kAudioObjectUnknown, plugin->GetDeviceIDByUID("uid1"));
+
+    plugin->RemoveDevice(device2);
+    EXPECT_EQ(kAudioObjectUnknown, plugin->GetDeviceIDByUID("uid2"));
+}
+
+TEST_F(ConstructionTest, DeviceBatch)
+{
+    constexpr UInt32 NumDevices = 10;
+
+    const auto plugin = std::make_shared<aspl::Plugin>(context);
+    const auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::HostSimulator simulator(driver);
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    std::vector<std::shared_ptr<aspl::Device>> devices;
+
+    for (UInt32 n = 0; n < NumDevices; n++) {
+        aspl::DeviceParameters devParams;
+        devParams.DeviceUID = "uid" + std::to_string(n);
+
+        devices.push_back(std::make_shared<aspl::Device>(context, devParams));
+    }
+
+    const auto numNotifications = simulator.GetNotificationCount();
+
+    plugin->BeginDeviceBatch();
+
+    for (const auto& device : devices) {
+        plugin->AddDevice(device);
+        EXPECT_TRUE(device->HasOwner());
+    }
+
+    // changes are not visible until batch end
+    EXPECT_EQ(0, plugin->GetDeviceCount());
+    EXPECT_EQ(0, plugin->GetDeviceIDs().size());
+    EXPECT_EQ(kAudioObjectUnknown, plugin->GetDeviceIDByUID("uid0"));
+    EXPECT_EQ(numNotifications, simulator.GetNotificationCount());
+
+    plugin->EndDeviceBatch();
+
+    // single notification per batch
+    EXPECT_EQ(numNotifications + 1, simulator.GetNotificationCount());
+
+    ASSERT_EQ(NumDevices, plugin->GetDeviceCount());
+    ASSERT_EQ(NumDevices, plugin->GetDeviceIDs().size());
+    ASSERT_EQ(NumDevices, plugin->GetOwnedObjectIDs().size());
+
+    for (UInt32 n = 0; n < NumDevices; n++) {
+        EXPECT_EQ(devices[n], plugin->GetDeviceByIndex(n));
+        EXPECT_EQ(devices[n], plugin->GetDeviceByID(devices[n]->GetID()));
+        EXPECT_EQ(devices[n]->GetID(),
+            plugin->GetDeviceIDByUID("uid" + std::to_string(n)));
+    }
+
+    // mixed batch, including device added and removed within batch
+    plugin->BeginDeviceBatch();
+
+    plugin->RemoveDevices({devices[0], devices[1]});
+    plugin->RemoveDevice(devices[2]);
+    plugin->AddDevice(devices[0]);
+    plugin->RemoveDevice(devices[0]);
+
+    plugin->EndDeviceBatch();
+
+    EXPECT_EQ(numNotifications + 2, simulator.GetNotificationCount());
+
+    ASSERT_EQ(NumDevices - 3, plugin->GetDeviceCount());
+    ASSERT_EQ(NumDevices - 3, plugin->GetOwnedObjectIDs().size());
+
+    for (UInt32 n = 0; n < NumDevices; n++) {
+        EXPECT_EQ(n >= 3, plugin->HasDevice(devices[n]));
+        EXPECT_EQ(n >= 3, devices[n]->HasOwner());
+    }
+
+    EXPECT_EQ(devices[3], plugin->GetDeviceByIndex(0));
+    EXPECT_EQ(kAudioObjectUnknown, plugin->GetDeviceIDByUID("uid0"));
+
+    // empty batch doesn't notify
+    plugin->BeginDeviceBatch();
+    plugin->EndDeviceBatch();
+
+    EXPECT_EQ(numNotifications + 2, simulator.GetNotificationCount());
+
+    // multiple devices at once
+    plugin->AddDevices({devices[0], devices[1], devices[2]});
+
+    EXPECT_EQ(numNotifications + 3, simulator.GetNotificationCount());
+    EXPECT_EQ(NumDevices, plugin->GetDeviceCount());
+    EXPECT_EQ(devices[0], plugin->GetDeviceByIndex(NumDevices - 3));
+}
+
 TEST_F(ConstructionTest, StreamAndControls)
 {
     const auto device = std::make_shared<aspl::Device>(context);
@@ -229,6 +355,44 @@ TEST_F(ConstructionTest, VolumeControl)
     }
 }
 
+TEST_F(ConstructionTest, VolumeControlRanges)
+{
+    aspl::VolumeControlParameters params1;
+    params1.MinRawVolume = 0;
+    params1.MaxRawVolume = 96;
+    params1.MinDecibelVolume = -96.0f;
+    params1.MaxDecibelVolume = 0.0f;
+
+    aspl::VolumeControlParameters params2;
+    params2.MinRawVolume = 10;
+    params2.MaxRawVolume = 50;
+    params2.MinDecibelVolume = -40.0f;
+    params2.MaxDecibelVolume = 6.0f;
+
+    // controls with same ranges share curve, and others have their own
+    auto control1 = std::make_shared<aspl::VolumeControl>(context, params1);
+    const auto control2 = std::make_shared<aspl::VolumeControl>(context, params2);
+    const auto control3 = std::make_shared<aspl::VolumeControl>(context, params1);
+
+    for (const auto& control : {control1, control3}) {
+        EXPECT_EQ(0, control->GetRawRange().mMinimum);
+        EXPECT_EQ(96, control->GetRawRange().mMaximum);
+        EXPECT_EQ(-96.0, control->GetDecibelRange().mMinimum);
+        EXPECT_EQ(0.0, control->GetDecibelRange().mMaximum);
+    }
+
+    EXPECT_EQ(10, control2->GetRawRange().mMinimum);
+    EXPECT_EQ(50, control2->GetRawRange().mMaximum);
+    EXPECT_EQ(-40.0, control2->GetDecibelRange().mMinimum);
+    EXPECT_EQ(6.0, control2->GetDecibelRange().mMaximum);
+
+    // shared curve is still valid after other control is gone
+    control1.reset();
+
+    EXPECT_EQ(kAudioHardwareNoError, control3->SetDecibelValue(-48.0f));
+    EXPECT_EQ(-48.0f, control3->GetDecibelValue());
+}
+
 TEST_F(ConstructionTest, MuteControl)
 {
     const auto device = std::make_shared<aspl::Device>(context);
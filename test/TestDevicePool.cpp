@@ -0,0 +1,170 @@
+#include <aspl/DevicePool.hpp>
+#include <aspl/Plugin.hpp>
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+struct DevicePoolTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(tracer);
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    aspl::DevicePoolParameters PoolParams()
+    {
+        aspl::DevicePoolParameters params;
+        params.Device.ModelUID = "TestModel";
+        params.Device.DeviceUID = "IgnoredUID";
+        params.Streams.resize(2);
+        params.Streams[0].Direction = aspl::Direction::Input;
+        params.Streams[1].Direction = aspl::Direction::Output;
+        params.Size = 3;
+
+        return params;
+    }
+};
+
+TEST_F(DevicePoolTest, Refill)
+{
+    aspl::DevicePool pool(context, PoolParams());
+
+    EXPECT_EQ(0, pool.GetStats().NumReady);
+
+    pool.Refill();
+
+    EXPECT_EQ(3, pool.GetStats().NumReady);
+
+    // already full
+    pool.Refill();
+
+    EXPECT_EQ(3, pool.GetStats().NumReady);
+}
+
+TEST_F(DevicePoolTest, Acquire)
+{
+    aspl::DevicePool pool(context, PoolParams());
+
+    pool.Refill();
+
+    auto device = pool.Acquire();
+
+    ASSERT_TRUE(device);
+    EXPECT_EQ(1, device->GetStreamCount(aspl::Direction::Input));
+    EXPECT_EQ(1, device->GetStreamCount(aspl::Direction::Output));
+    EXPECT_EQ(1, device->GetVolumeControlCount(kAudioObjectPropertyScopeInput));
+    EXPECT_EQ(1, device->GetVolumeControlCount(kAudioObjectPropertyScopeOutput));
+
+    plugin->AddDevice(device);
+
+    EXPECT_EQ(device, plugin->GetDeviceByIndex(0));
+    EXPECT_EQ(device->GetID(), plugin->GetDeviceIDByUID(device->GetDeviceUID()));
+
+    const auto stats = pool.GetStats();
+
+    EXPECT_EQ(2, stats.NumReady);
+    EXPECT_EQ(1, stats.NumAcquired);
+    EXPECT_EQ(0, stats.NumMisses);
+}
+
+TEST_F(DevicePoolTest, AcquireEmpty)
+{
+    aspl::DevicePool pool(context, PoolParams());
+
+    auto device = pool.Acquire();
+
+    ASSERT_TRUE(device);
+    EXPECT_EQ(1, device->GetStreamCount(aspl::Direction::Output));
+
+    EXPECT_EQ(1, pool.GetStats().NumMisses);
+}
+
+TEST_F(DevicePoolTest, FreshIdentity)
+{
+    aspl::DevicePool pool(context, PoolParams());
+
+    std::set<AudioObjectID> ids;
+    std::set<std::string> uids;
+
+    for (int n = 0; n < 10; n++) {
+        pool.Refill();
+
+        auto device = pool.Acquire();
+
+        plugin->AddDevice(device);
+
+        EXPECT_TRUE(ids.insert(device->GetID()).second);
+        EXPECT_TRUE(uids.insert(device->GetDeviceUID()).second);
+
+        EXPECT_EQ(0, device->GetDeviceUID().find("TestModel:"));
+
+        plugin->RemoveDevice(device);
+        pool.Release(std::move(device));
+    }
+}
+
+TEST_F(DevicePoolTest, Release)
+{
+    aspl::DevicePool pool(context, PoolParams());
+
+    pool.Refill();
+
+    auto device = pool.Acquire();
+    const auto deviceID = device->GetID();
+
+    std::weak_ptr<aspl::Device> weakDevice = device;
+
+    plugin->AddDevice(device);
+    plugin->RemoveDevice(device);
+
+    pool.Release(std::move(device));
+
+    // destruction is deferred until refill
+    EXPECT_FALSE(weakDevice.expired());
+    EXPECT_EQ(1, pool.GetStats().NumReleased);
+
+    pool.Refill();
+
+    EXPECT_TRUE(weakDevice.expired());
+    EXPECT_FALSE(context->Dispatcher->FindObject(deviceID));
+
+    const auto stats = pool.GetStats();
+
+    EXPECT_EQ(0, stats.NumReleased);
+    EXPECT_EQ(3, stats.NumReady);
+}
+
+TEST_F(DevicePoolTest, Factory)
+{
+    std::vector<std::string> uids;
+
+    aspl::DevicePool pool(context,
+        PoolParams(),
+        [&uids](const std::shared_ptr<const aspl::Context>& context,
+            const aspl::DeviceParameters& params) {
+            uids.push_back(params.DeviceUID);
+
+            auto device = std::make_shared<aspl::Device>(context, params);
+            device->AddStreamAsync(aspl::Direction::Output);
+
+            return device;
+        });
+
+    pool.Refill();
+
+    ASSERT_EQ(3, uids.size());
+
+    auto device = pool.Acquire();
+
+    EXPECT_EQ(1, device->GetStreamCount(aspl::Direction::Output));
+    EXPECT_EQ(0, device->GetStreamCount(aspl::Direction::Input));
+    EXPECT_NE(uids.end(), std::find(uids.begin(), uids.end(), device->GetDeviceUID()));
+}
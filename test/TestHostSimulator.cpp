@@ -0,0 +1,293 @@
+#include <aspl/Driver.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+class CountingHandler : public aspl::IORequestHandler
+{
+public:
+    UInt32 numReadClientInput = 0;
+    UInt32 numProcessClientInput = 0;
+    UInt32 numProcessClientOutput = 0;
+    UInt32 numWriteClientOutput = 0;
+    UInt32 numProcessMixedOutput = 0;
+    UInt32 numWriteMixedOutput = 0;
+
+    std::vector<Float64> zeroTimestamps;
+    std::vector<Float64> outputTimestamps;
+
+    void OnReadClientInput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        void* bytes,
+        UInt32 bytesCount) override
+    {
+        numReadClientInput++;
+    }
+
+    void OnProcessClientInput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount,
+        UInt32 channelCount) override
+    {
+        numProcessClientInput++;
+    }
+
+    void OnProcessClientOutput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount,
+        UInt32 channelCount) override
+    {
+        numProcessClientOutput++;
+    }
+
+    void OnWriteClientOutput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const Float32* frames,
+        UInt32 frameCount,
+        UInt32 channelCount) override
+    {
+        numWriteClientOutput++;
+    }
+
+    void OnProcessMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount,
+        UInt32 channelCount) override
+    {
+        numProcessMixedOutput++;
+    }
+
+    void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const void* bytes,
+        UInt32 bytesCount) override
+    {
+        numWriteMixedOutput++;
+
+        zeroTimestamps.push_back(zeroTimestamp);
+        outputTimestamps.push_back(timestamp);
+    }
+};
+
+class FailingControlHandler : public aspl::ControlRequestHandler
+{
+public:
+    UInt32 failClientID = 0;
+
+    std::shared_ptr<aspl::Client> OnAddClient(const aspl::ClientInfo& clientInfo) override
+    {
+        if (clientInfo.ClientID == failClientID) {
+            return nullptr;
+        }
+        return aspl::ControlRequestHandler::OnAddClient(clientInfo);
+    }
+};
+
+} // anonymous namespace
+
+struct HostSimulatorTest : ::testing::Test
+{
+    static constexpr UInt32 TestSampleRate = 48000;
+    static constexpr UInt32 TestBufferSize = 480;
+    static constexpr UInt32 TestNumClients = 3;
+
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        tracer, nullptr, std::make_shared<aspl::SimulatedClock>());
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<CountingHandler> handler = std::make_shared<CountingHandler>();
+
+    std::shared_ptr<aspl::Device> CreateDevice(bool enableMixing)
+    {
+        aspl::DeviceParameters params;
+        params.SampleRate = TestSampleRate;
+        params.ZeroTimeStampPeriod = TestBufferSize;
+        params.EnableMixing = enableMixing;
+
+        auto device = std::make_shared<aspl::Device>(context, params);
+
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+        device->SetIOHandler(handler);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+
+    aspl::HostSimulatorParameters SimulatorParams()
+    {
+        aspl::HostSimulatorParameters params;
+        params.NumClients = TestNumClients;
+        params.BufferFrameSize = TestBufferSize;
+
+        return params;
+    }
+};
+
+TEST_F(HostSimulatorTest, Mixing)
+{
+    constexpr UInt32 NumCycles = 10;
+
+    auto device = CreateDevice(true);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+
+    EXPECT_EQ(TestNumClients, device->GetClientCount());
+    EXPECT_TRUE(device->GetIsRunning());
+
+    // kAudioDevicePropertyDeviceIsRunning
+    EXPECT_EQ(1, simulator.GetNotificationCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+
+    // device-wide operations
+    EXPECT_EQ(NumCycles, handler->numReadClientInput);
+    EXPECT_EQ(NumCycles, handler->numProcessMixedOutput);
+    EXPECT_EQ(NumCycles, handler->numWriteMixedOutput);
+
+    // per-client operations
+    EXPECT_EQ(NumCycles * TestNumClients, handler->numProcessClientInput);
+    EXPECT_EQ(0, handler->numProcessClientOutput);
+    EXPECT_EQ(0, handler->numWriteClientOutput);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(0, device->GetClientCount());
+    EXPECT_FALSE(device->GetIsRunning());
+
+    const auto report = simulator.GetReport();
+
+    EXPECT_EQ(NumCycles, report.NumCycles);
+    EXPECT_EQ(0, report.NumFailedCalls);
+    EXPECT_EQ(10000000, report.DeadlineNs);
+    EXPECT_LE(report.MinLatencyNs, report.P50LatencyNs);
+    EXPECT_LE(report.P50LatencyNs, report.P99LatencyNs);
+    EXPECT_LE(report.P99LatencyNs, report.MaxLatencyNs);
+}
+
+TEST_F(HostSimulatorTest, NoMixing)
+{
+    constexpr UInt32 NumCycles = 10;
+
+    auto device = CreateDevice(false);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(NumCycles, handler->numReadClientInput);
+    EXPECT_EQ(NumCycles * TestNumClients, handler->numProcessClientInput);
+    EXPECT_EQ(NumCycles * TestNumClients, handler->numProcessClientOutput);
+    EXPECT_EQ(NumCycles * TestNumClients, handler->numWriteClientOutput);
+    EXPECT_EQ(0, handler->numProcessMixedOutput);
+    EXPECT_EQ(0, handler->numWriteMixedOutput);
+}
+
+TEST_F(HostSimulatorTest, Timestamps)
+{
+    constexpr UInt32 NumCycles = 5;
+
+    auto device = CreateDevice(true);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    // simulated clock is advanced by one buffer per cycle, so zero timestamp
+    // is advanced by one period per cycle
+    ASSERT_EQ(NumCycles, handler->zeroTimestamps.size());
+    ASSERT_EQ(NumCycles, handler->outputTimestamps.size());
+
+    for (UInt32 n = 0; n < NumCycles; n++) {
+        EXPECT_EQ(Float64(n * TestBufferSize), handler->zeroTimestamps[n]);
+        EXPECT_EQ(Float64((n + 1) * TestBufferSize), handler->outputTimestamps[n]);
+    }
+
+    // handler allocates when it appends timestamps
+    EXPECT_GT(simulator.GetReport().NumAllocations, 0);
+}
+
+TEST_F(HostSimulatorTest, ConfigurationChange)
+{
+    auto device = CreateDevice(true);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    // request is queued by host and performed later
+    ASSERT_EQ(kAudioHardwareNoError, device->SetZeroTimeStampPeriodAsync(960));
+
+    EXPECT_EQ(1, simulator.GetConfigurationRequestCount());
+    EXPECT_EQ(TestBufferSize, device->GetZeroTimeStampPeriod());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    EXPECT_EQ(960, device->GetZeroTimeStampPeriod());
+}
+
+TEST_F(HostSimulatorTest, StartFailure)
+{
+    auto device = CreateDevice(true);
+
+    auto controlHandler = std::make_shared<FailingControlHandler>();
+    controlHandler->failClientID = TestNumClients;
+    device->SetControlHandler(controlHandler);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+
+    // clients added and started before failure are stopped and removed
+    EXPECT_NE(kAudioHardwareNoError, simulator.Start());
+
+    EXPECT_EQ(0, device->GetClientCount());
+    EXPECT_FALSE(device->GetIsRunning());
+
+    controlHandler->failClientID = 0;
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start());
+
+    EXPECT_EQ(TestNumClients, device->GetClientCount());
+    EXPECT_TRUE(device->GetIsRunning());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(0, device->GetClientCount());
+}
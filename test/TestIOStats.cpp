@@ -0,0 +1,328 @@
+#include <aspl/Driver.hpp>
+#include <aspl/IOStats.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr UInt32 TestSampleRate = 48000;
+constexpr UInt32 TestBufferSize = 480;
+constexpr UInt32 TestNumClients = 2;
+
+// 1 tick is 1 nanosecond
+constexpr UInt64 TestCycleNs = UInt64(TestBufferSize) * 1000000000 / TestSampleRate;
+
+// advances simulated clock to emulate handler time
+class SlowHandler : public aspl::IORequestHandler
+{
+public:
+    explicit SlowHandler(std::shared_ptr<aspl::SimulatedClock> clock)
+        : clock_(clock)
+    {
+    }
+
+    UInt64 writeTimeNs = 1000;
+
+    void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const void* bytes,
+        UInt32 bytesCount) override
+    {
+        clock_->AdvanceHostTime(writeTimeNs);
+    }
+
+private:
+    std::shared_ptr<aspl::SimulatedClock> clock_;
+};
+
+AudioServerPlugInIOCycleInfo MakeCycleInfo(UInt64 cycleCounter, Float64 sampleTime)
+{
+    AudioServerPlugInIOCycleInfo cycleInfo = {};
+
+    cycleInfo.mIOCycleCounter = cycleCounter;
+    cycleInfo.mNominalIOBufferFrameSize = TestBufferSize;
+    cycleInfo.mMainHostTicksPerFrame = 1e9 / TestSampleRate;
+    cycleInfo.mCurrentTime.mSampleTime = sampleTime;
+    cycleInfo.mCurrentTime.mFlags = kAudioTimeStampSampleTimeValid;
+
+    return cycleInfo;
+}
+
+SInt64 GetDictionaryNumber(CFDictionaryRef dict, const char* key)
+{
+    CFStringRef keyRef =
+        CFStringCreateWithCString(kCFAllocatorDefault, key, kCFStringEncodingUTF8);
+
+    const auto valueRef = (CFNumberRef)CFDictionaryGetValue(dict, keyRef);
+
+    CFRelease(keyRef);
+
+    SInt64 value = -1;
+    if (valueRef) {
+        CFNumberGetValue(valueRef, kCFNumberSInt64Type, &value);
+    }
+
+    return value;
+}
+
+} // anonymous namespace
+
+struct IOStatsTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::SimulatedClock> clock =
+        std::make_shared<aspl::SimulatedClock>();
+
+    std::shared_ptr<aspl::Context> context =
+        std::make_shared<aspl::Context>(tracer, nullptr, clock);
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<SlowHandler> handler = std::make_shared<SlowHandler>(clock);
+
+    std::shared_ptr<aspl::Device> CreateDevice(bool enableStats = true)
+    {
+        aspl::DeviceParameters params;
+        params.SampleRate = TestSampleRate;
+        params.ZeroTimeStampPeriod = TestBufferSize;
+        params.EnableIOStats = enableStats;
+
+        auto device = std::make_shared<aspl::Device>(context, params);
+
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+        device->SetIOHandler(handler);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+
+    aspl::HostSimulatorParameters SimulatorParams()
+    {
+        aspl::HostSimulatorParameters params;
+        params.NumClients = TestNumClients;
+        params.BufferFrameSize = TestBufferSize;
+
+        return params;
+    }
+};
+
+TEST_F(IOStatsTest, Collector)
+{
+    aspl::IOStatsCollector collector(1e9);
+
+    UInt64 hostTime = 0;
+
+    // 100 operations, 1us..100us
+    for (UInt64 n = 0; n < 100; n++) {
+        collector.BeginOperation(MakeCycleInfo(n, Float64(n * TestBufferSize)),
+            hostTime,
+            hostTime,
+            TestCycleNs);
+
+        hostTime += (n + 1) * 1000;
+
+        collector.EndOperation(kAudioServerPlugInIOOperationWriteMix, hostTime);
+    }
+
+    const auto stats = collector.GetStats();
+
+    EXPECT_EQ(100, stats.NumCycles);
+    EXPECT_EQ(0, stats.NumLateCycles);
+    EXPECT_EQ(0, stats.NumOverruns);
+    EXPECT_EQ(0, stats.NumUnderruns);
+
+    EXPECT_EQ(100, stats.WriteMix.NumCalls);
+    EXPECT_EQ(1000, stats.WriteMix.MinTimeNs);
+    EXPECT_EQ(50500, stats.WriteMix.AvgTimeNs);
+    EXPECT_EQ(100000, stats.WriteMix.MaxTimeNs);
+
+    // p99 is 99us, but histogram has limited precision
+    EXPECT_GE(stats.WriteMix.P99TimeNs, 99000);
+    EXPECT_LE(stats.WriteMix.P99TimeNs, 100000);
+
+    EXPECT_EQ(0, stats.ReadInput.NumCalls);
+    EXPECT_EQ(0, stats.ReadInput.MinTimeNs);
+    EXPECT_EQ(0, stats.ReadInput.P99TimeNs);
+}
+
+TEST_F(IOStatsTest, CollectorCycles)
+{
+    aspl::IOStatsCollector collector(1e9);
+
+    // two operations in the same cycle
+    collector.BeginOperation(MakeCycleInfo(0, 0), 0, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationReadInput, 100);
+    collector.BeginOperation(MakeCycleInfo(0, 0), 100, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationWriteMix, 200);
+
+    EXPECT_EQ(1, collector.GetStats().NumCycles);
+
+    // cycle which doesn't fit into its duration
+    collector.BeginOperation(MakeCycleInfo(1, TestBufferSize), 0, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationReadInput, TestCycleNs / 2);
+    collector.BeginOperation(
+        MakeCycleInfo(1, TestBufferSize), TestCycleNs / 2, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationWriteMix, TestCycleNs * 2);
+
+    EXPECT_EQ(2, collector.GetStats().NumCycles);
+    EXPECT_EQ(1, collector.GetStats().NumOverruns);
+    EXPECT_EQ(0, collector.GetStats().NumUnderruns);
+
+    // cycle which is not contiguous with previous one
+    collector.BeginOperation(MakeCycleInfo(2, TestBufferSize * 5), 0, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationWriteMix, 0);
+
+    EXPECT_EQ(3, collector.GetStats().NumCycles);
+    EXPECT_EQ(1, collector.GetStats().NumUnderruns);
+
+    // cycle which started long after zero timestamp
+    collector.BeginOperation(
+        MakeCycleInfo(3, TestBufferSize * 6), TestCycleNs * 3, 0, TestCycleNs);
+    collector.EndOperation(kAudioServerPlugInIOOperationWriteMix, TestCycleNs * 3);
+
+    EXPECT_EQ(4, collector.GetStats().NumCycles);
+    EXPECT_EQ(1, collector.GetStats().NumLateCycles);
+    EXPECT_EQ(1, collector.GetStats().NumOverruns);
+    EXPECT_EQ(1, collector.GetStats().NumUnderruns);
+}
+
+TEST_F(IOStatsTest, Disabled)
+{
+    auto device = CreateDevice(false);
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(10));
+
+    EXPECT_EQ(0, device->GetIOStats().NumCycles);
+    EXPECT_EQ(0, device->GetIOStats().NumActiveClients);
+    EXPECT_TRUE(device->GetCustomProperties().empty());
+}
+
+TEST_F(IOStatsTest, Simulator)
+{
+    constexpr UInt64 NumCycles = 20;
+
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+
+    auto stats = device->GetIOStats();
+
+    EXPECT_EQ(NumCycles, stats.NumCycles);
+    EXPECT_EQ(0, stats.NumLateCycles);
+    EXPECT_EQ(0, stats.NumOverruns);
+    EXPECT_EQ(0, stats.NumUnderruns);
+    EXPECT_EQ(TestNumClients, stats.NumActiveClients);
+
+    EXPECT_EQ(NumCycles, stats.ReadInput.NumCalls);
+    EXPECT_EQ(NumCycles * TestNumClients, stats.ProcessInput.NumCalls);
+    EXPECT_EQ(NumCycles, stats.ProcessMix.NumCalls);
+    EXPECT_EQ(NumCycles, stats.WriteMix.NumCalls);
+
+    EXPECT_EQ(handler->writeTimeNs, stats.WriteMix.MinTimeNs);
+    EXPECT_EQ(handler->writeTimeNs, stats.WriteMix.MaxTimeNs);
+    EXPECT_EQ(handler->writeTimeNs, stats.WriteMix.AvgTimeNs);
+    EXPECT_EQ(handler->writeTimeNs, stats.WriteMix.P99TimeNs);
+    EXPECT_EQ(0, stats.ReadInput.MaxTimeNs);
+
+    // handler is slower than realtime
+    handler->writeTimeNs = TestCycleNs * 2;
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(1));
+
+    stats = device->GetIOStats();
+
+    EXPECT_EQ(NumCycles + 1, stats.NumCycles);
+    EXPECT_EQ(1, stats.NumOverruns);
+    EXPECT_EQ(TestCycleNs * 2, stats.WriteMix.MaxTimeNs);
+
+    // cycle arrives too late
+    handler->writeTimeNs = 0;
+    clock->AdvanceHostTime(TestCycleNs * 3);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(1));
+
+    stats = device->GetIOStats();
+
+    EXPECT_EQ(NumCycles + 2, stats.NumCycles);
+    EXPECT_GT(stats.NumLateCycles, 0);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(0, device->GetIOStats().NumActiveClients);
+}
+
+TEST_F(IOStatsTest, CustomProperty)
+{
+    auto device = CreateDevice();
+
+    aspl::HostSimulator simulator(driver, SimulatorParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(5));
+
+    const auto customProps = device->GetCustomProperties();
+
+    ASSERT_EQ(1, customProps.size());
+    EXPECT_EQ('iost', customProps[0].mSelector);
+    EXPECT_EQ(kAudioServerPlugInCustomPropertyDataTypeCFPropertyList,
+        customProps[0].mPropertyDataType);
+
+    AudioObjectPropertyAddress addr = {
+        'iost',
+        kAudioObjectPropertyScopeGlobal,
+        kAudioObjectPropertyElementMain,
+    };
+
+    // read-only
+    Boolean isSettable = true;
+    ASSERT_EQ(kAudioHardwareNoError,
+        device->IsPropertySettable(device->GetID(), 0, &addr, &isSettable));
+    EXPECT_FALSE(isSettable);
+
+    CFPropertyListRef value = nullptr;
+    UInt32 dataSize = 0;
+
+    ASSERT_EQ(kAudioHardwareNoError,
+        device->GetPropertyData(
+            device->GetID(), 0, &addr, 0, nullptr, sizeof(value), &dataSize, &value));
+    ASSERT_EQ(sizeof(value), dataSize);
+    ASSERT_TRUE(value);
+    ASSERT_EQ(CFDictionaryGetTypeID(), CFGetTypeID(value));
+
+    const auto dict = (CFDictionaryRef)value;
+
+    EXPECT_EQ(5, GetDictionaryNumber(dict, "NumCycles"));
+    EXPECT_EQ(0, GetDictionaryNumber(dict, "NumOverruns"));
+    EXPECT_EQ(TestNumClients, GetDictionaryNumber(dict, "NumActiveClients"));
+
+    CFStringRef keyRef =
+        CFStringCreateWithCString(kCFAllocatorDefault, "WriteMix", kCFStringEncodingUTF8);
+    const auto writeMix = (CFDictionaryRef)CFDictionaryGetValue(dict, keyRef);
+    CFRelease(keyRef);
+
+    ASSERT_TRUE(writeMix);
+    EXPECT_EQ(5, GetDictionaryNumber(writeMix, "NumCalls"));
+    EXPECT_EQ(SInt64(handler->writeTimeNs), GetDictionaryNumber(writeMix, "MaxTimeNs"));
+
+    CFRelease(value);
+}
@@ -0,0 +1,595 @@
+#include <aspl/JitterBuffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr UInt32 NumChannels = 2;
+constexpr UInt32 BytesPerFrame = NumChannels * sizeof(Float32);
+
+// Sample value is derived from sample time, so that any frame can be
+// validated independently.
+Float32 SampleValue(UInt64 sampleTime, UInt32 channel)
+{
+    return Float32((sampleTime % 1000000) * NumChannels + channel + 1);
+}
+
+std::vector<Float32> MakePacket(UInt64 sampleTime, UInt32 frameCount)
+{
+    std::vector<Float32> samples(frameCount * NumChannels);
+
+    for (UInt32 n = 0; n < frameCount; n++) {
+        for (UInt32 c = 0; c < NumChannels; c++) {
+            samples[n * NumChannels + c] = SampleValue(sampleTime + n, c);
+        }
+    }
+
+    return samples;
+}
+
+void WritePacket(aspl::JitterBuffer& buffer, UInt64 sampleTime, UInt32 frameCount)
+{
+    const auto samples = MakePacket(sampleTime, frameCount);
+
+    buffer.Write(sampleTime, samples.data(), UInt32(samples.size() * sizeof(Float32)));
+}
+
+std::vector<Float32> ReadWindow(
+    aspl::JitterBuffer& buffer, UInt64 sampleTime, UInt32 frameCount)
+{
+    std::vector<Float32> samples(frameCount * NumChannels, -1.0f);
+
+    buffer.Read(sampleTime, samples.data(), UInt32(samples.size() * sizeof(Float32)));
+
+    return samples;
+}
+
+bool IsFrameValid(const Float32* frame, UInt64 sampleTime)
+{
+    for (UInt32 c = 0; c < NumChannels; c++) {
+        if (frame[c] != SampleValue(sampleTime, c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsFrameSilent(const Float32* frame)
+{
+    for (UInt32 c = 0; c < NumChannels; c++) {
+        if (frame[c] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Simulates network with variable delay, losses, and duplicates,
+// and a reader that reads fixed-size windows with fixed latency.
+// All times are measured in frames.
+struct JitterSimulation
+{
+    UInt32 PacketFrames = 64;
+    UInt32 CycleFrames = 256;
+    UInt32 Latency = 1024;
+
+    UInt32 MinDelay = 100;
+    UInt32 MaxJitter = 500;
+
+    double LossRate = 0;
+    double DuplicateRate = 0;
+
+    UInt32 NumCycles = 1000;
+
+    // results
+    UInt64 NumSentPackets = 0;
+    UInt64 NumDroppedPackets = 0;
+    UInt64 NumDuplicatedPackets = 0;
+
+    UInt64 NumReadFrames = 0;
+    UInt64 NumValidFrames = 0;
+    UInt64 NumSilentFrames = 0;
+    UInt64 NumCorruptedFrames = 0;
+
+    void Run(aspl::JitterBuffer& buffer)
+    {
+        struct Arrival
+        {
+            UInt64 ArrivalTime;
+            UInt64 SampleTime;
+        };
+
+        std::mt19937 rng(12345);
+        std::uniform_int_distribution<UInt32> jitter(0, MaxJitter);
+        std::uniform_real_distribution<double> chance(0, 1);
+
+        const UInt64 duration = UInt64(NumCycles) * CycleFrames + Latency;
+
+        std::vector<Arrival> arrivals;
+
+        for (UInt64 sampleTime = 0; sampleTime < duration; sampleTime += PacketFrames) {
+            NumSentPackets++;
+
+            if (chance(rng) < LossRate) {
+                NumDroppedPackets++;
+                continue;
+            }
+
+            // packet is sent when its last frame is captured
+            const UInt64 sendTime = sampleTime + PacketFrames;
+
+            arrivals.push_back({sendTime + MinDelay + jitter(rng), sampleTime});
+
+            if (chance(rng) < DuplicateRate) {
+                NumDuplicatedPackets++;
+                arrivals.push_back({sendTime + MinDelay + jitter(rng), sampleTime});
+            }
+        }
+
+        std::stable_sort(arrivals.begin(),
+            arrivals.end(),
+            [](const Arrival& a, const Arrival& b) {
+                return a.ArrivalTime < b.ArrivalTime;
+            });
+
+        size_t nextArrival = 0;
+
+        for (UInt32 cycle = 0; cycle < NumCycles; cycle++) {
+            const UInt64 now = UInt64(cycle) * CycleFrames + Latency + CycleFrames;
+
+            while (nextArrival < arrivals.size() &&
+                   arrivals[nextArrival].ArrivalTime <= now) {
+                WritePacket(buffer, arrivals[nextArrival].SampleTime, PacketFrames);
+                nextArrival++;
+            }
+
+            const UInt64 readTime = now - Latency - CycleFrames;
+            const auto samples = ReadWindow(buffer, readTime, CycleFrames);
+
+            for (UInt32 n = 0; n < CycleFrames; n++) {
+                const Float32* frame = &samples[n * NumChannels];
+
+                NumReadFrames++;
+
+                if (IsFrameValid(frame, readTime + n)) {
+                    NumValidFrames++;
+                } else if (IsFrameSilent(frame)) {
+                    NumSilentFrames++;
+                } else {
+                    NumCorruptedFrames++;
+                }
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+TEST(JitterBufferTest, InOrder)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+
+    aspl::JitterBuffer buffer(params);
+
+    for (UInt64 pos = 0; pos < 512; pos += 64) {
+        WritePacket(buffer, 1000 + pos, 64);
+    }
+
+    const auto samples = ReadWindow(buffer, 1000, 512);
+
+    for (UInt32 n = 0; n < 512; n++) {
+        EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], 1000 + n));
+    }
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(8, stats.NumPackets);
+    EXPECT_EQ(0, stats.NumDuplicatePackets);
+    EXPECT_EQ(0, stats.NumLatePackets);
+    EXPECT_EQ(0, stats.NumOverflowPackets);
+    EXPECT_EQ(0, stats.NumLostFrames);
+    EXPECT_EQ(0, stats.Depth);
+}
+
+TEST(JitterBufferTest, Reorder)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+
+    aspl::JitterBuffer buffer(params);
+
+    // packets are written in reverse order and with an offset not aligned
+    // to read windows
+    for (SInt64 pos = 480; pos >= 0; pos -= 30) {
+        WritePacket(buffer, UInt64(pos), 30);
+    }
+
+    for (UInt64 pos = 0; pos < 500; pos += 100) {
+        const auto samples = ReadWindow(buffer, pos, 100);
+
+        for (UInt32 n = 0; n < 100; n++) {
+            EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], pos + n));
+        }
+    }
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(0, stats.NumLostFrames);
+    EXPECT_EQ(10, stats.Depth);
+}
+
+TEST(JitterBufferTest, Duplicate)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+
+    aspl::JitterBuffer buffer(params);
+
+    WritePacket(buffer, 0, 64);
+    WritePacket(buffer, 64, 64);
+    WritePacket(buffer, 0, 64);
+
+    // partial duplicate, only new frames are stored
+    {
+        const auto samples = MakePacket(96, 64);
+        EXPECT_EQ(32, buffer.Write(96, samples.data(), 64 * BytesPerFrame));
+    }
+
+    const auto samples = ReadWindow(buffer, 0, 160);
+
+    for (UInt32 n = 0; n < 160; n++) {
+        EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], n));
+    }
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(4, stats.NumPackets);
+    EXPECT_EQ(1, stats.NumDuplicatePackets);
+    EXPECT_EQ(0, stats.NumLostFrames);
+}
+
+TEST(JitterBufferTest, Late)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+
+    aspl::JitterBuffer buffer(params);
+
+    // window is read before packet arrives
+    ReadWindow(buffer, 0, 128);
+
+    // fully late
+    {
+        const auto samples = MakePacket(0, 64);
+        EXPECT_EQ(0, buffer.Write(0, samples.data(), 64 * BytesPerFrame));
+    }
+
+    // partially late
+    {
+        const auto samples = MakePacket(96, 64);
+        EXPECT_EQ(32, buffer.Write(96, samples.data(), 64 * BytesPerFrame));
+    }
+
+    // late frames are not stored
+    {
+        const auto samples = ReadWindow(buffer, 0, 128);
+
+        for (UInt32 n = 0; n < 128; n++) {
+            EXPECT_TRUE(IsFrameSilent(&samples[n * NumChannels]));
+        }
+    }
+
+    {
+        const auto samples = ReadWindow(buffer, 128, 32);
+
+        for (UInt32 n = 0; n < 32; n++) {
+            EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], 128 + n));
+        }
+    }
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(2, stats.NumLatePackets);
+    // second read of the same window is not counted
+    EXPECT_EQ(128, stats.NumLostFrames);
+}
+
+TEST(JitterBufferTest, Overflow)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 256;
+
+    aspl::JitterBuffer buffer(params);
+
+    ReadWindow(buffer, 0, 64);
+
+    // fits
+    WritePacket(buffer, 64, 192);
+    EXPECT_EQ(192, buffer.GetStats().Depth);
+
+    // partially overflows
+    {
+        const auto samples = MakePacket(256, 128);
+        EXPECT_EQ(64, buffer.Write(256, samples.data(), 128 * BytesPerFrame));
+    }
+
+    // fully overflows
+    {
+        const auto samples = MakePacket(320, 64);
+        EXPECT_EQ(0, buffer.Write(320, samples.data(), 64 * BytesPerFrame));
+    }
+
+    {
+        const auto samples = ReadWindow(buffer, 64, 256);
+
+        for (UInt32 n = 0; n < 256; n++) {
+            EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], 64 + n));
+        }
+    }
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(2, stats.NumOverflowPackets);
+    // first window was read before any writes
+    EXPECT_EQ(64, stats.NumLostFrames);
+    EXPECT_EQ(0, stats.Depth);
+}
+
+TEST(JitterBufferTest, ConcealSilence)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+    params.Concealment = aspl::ConcealmentMode::Silence;
+
+    aspl::JitterBuffer buffer(params);
+
+    WritePacket(buffer, 0, 64);
+    // packet 64..128 is lost
+    WritePacket(buffer, 128, 64);
+
+    const auto samples = ReadWindow(buffer, 0, 192);
+
+    for (UInt32 n = 0; n < 192; n++) {
+        if (n >= 64 && n < 128) {
+            EXPECT_TRUE(IsFrameSilent(&samples[n * NumChannels]));
+        } else {
+            EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], n));
+        }
+    }
+
+    EXPECT_EQ(64, buffer.GetStats().NumLostFrames);
+}
+
+TEST(JitterBufferTest, ConcealRepeat)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+    params.Concealment = aspl::ConcealmentMode::Repeat;
+    params.RepeatPeriod = 64;
+
+    aspl::JitterBuffer buffer(params);
+
+    WritePacket(buffer, 0, 64);
+    WritePacket(buffer, 64, 64);
+    // packets 128..256 are lost
+    WritePacket(buffer, 256, 64);
+
+    // first window
+    {
+        const auto samples = ReadWindow(buffer, 0, 96);
+
+        for (UInt32 n = 0; n < 96; n++) {
+            EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], n));
+        }
+    }
+
+    // second window, repeated frames are taken from buffer
+    // and from the window itself
+    {
+        const auto samples = ReadWindow(buffer, 96, 224);
+
+        for (UInt32 n = 0; n < 224; n++) {
+            const UInt64 pos = 96 + n;
+
+            if (pos < 128 || pos >= 256) {
+                EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], pos));
+            } else {
+                EXPECT_TRUE(IsFrameValid(&samples[n * NumChannels], 64 + pos % 64));
+            }
+        }
+    }
+
+    EXPECT_EQ(128, buffer.GetStats().NumLostFrames);
+}
+
+TEST(JitterBufferTest, Reset)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 1024;
+
+    aspl::JitterBuffer buffer(params);
+
+    WritePacket(buffer, 0, 64);
+    ReadWindow(buffer, 0, 32);
+
+    buffer.Reset();
+
+    EXPECT_EQ(0, buffer.GetStats().NumPackets);
+    EXPECT_EQ(0, buffer.GetStats().Depth);
+
+    const auto samples = ReadWindow(buffer, 32, 32);
+
+    for (UInt32 n = 0; n < 32; n++) {
+        EXPECT_TRUE(IsFrameSilent(&samples[n * NumChannels]));
+    }
+}
+
+TEST(JitterBufferTest, SimulatedJitter)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 4096;
+
+    aspl::JitterBuffer buffer(params);
+
+    JitterSimulation sim;
+    sim.MinDelay = 100;
+    sim.MaxJitter = 800;
+    sim.Latency = 1024;
+    sim.Run(buffer);
+
+    const auto stats = buffer.GetStats();
+
+    // delay never exceeds latency, so every frame is delivered in time
+    EXPECT_EQ(sim.NumReadFrames, sim.NumValidFrames);
+    EXPECT_EQ(0, sim.NumCorruptedFrames);
+    EXPECT_EQ(0, stats.NumLostFrames);
+    EXPECT_EQ(0, stats.NumLatePackets);
+    EXPECT_EQ(0, stats.NumOverflowPackets);
+    EXPECT_GT(stats.Depth, 0);
+    EXPECT_LE(stats.Depth, sim.Latency + sim.CycleFrames);
+}
+
+TEST(JitterBufferTest, SimulatedLossAndDuplicates)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 4096;
+
+    aspl::JitterBuffer buffer(params);
+
+    JitterSimulation sim;
+    sim.MinDelay = 100;
+    sim.MaxJitter = 800;
+    sim.Latency = 1024;
+    sim.LossRate = 0.1;
+    sim.DuplicateRate = 0.1;
+    sim.Run(buffer);
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_GT(sim.NumDroppedPackets, 0);
+    EXPECT_GT(sim.NumDuplicatedPackets, 0);
+
+    EXPECT_EQ(0, sim.NumCorruptedFrames);
+    EXPECT_EQ(sim.NumReadFrames, sim.NumValidFrames + sim.NumSilentFrames);
+
+    // every missing frame is counted as lost exactly once
+    EXPECT_EQ(sim.NumSilentFrames, stats.NumLostFrames);
+    EXPECT_GT(stats.NumLostFrames, 0);
+    EXPECT_GT(stats.NumDuplicatePackets, 0);
+}
+
+TEST(JitterBufferTest, SimulatedLatePackets)
+{
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 4096;
+
+    aspl::JitterBuffer buffer(params);
+
+    JitterSimulation sim;
+    sim.MinDelay = 100;
+    sim.MaxJitter = 2000;
+    sim.Latency = 512;
+    sim.Run(buffer);
+
+    const auto stats = buffer.GetStats();
+
+    EXPECT_EQ(0, sim.NumCorruptedFrames);
+    EXPECT_EQ(sim.NumSilentFrames, stats.NumLostFrames);
+    EXPECT_GT(stats.NumLatePackets, 0);
+    EXPECT_GT(stats.NumLostFrames, 0);
+}
+
+TEST(JitterBufferTest, Concurrent)
+{
+    constexpr UInt32 PacketFrames = 32;
+    constexpr UInt32 CycleFrames = 128;
+    constexpr UInt32 NumCycles = 20000;
+
+    aspl::JitterBufferParameters params;
+    params.BytesPerFrame = BytesPerFrame;
+    params.Capacity = 512;
+
+    aspl::JitterBuffer buffer(params);
+
+    std::atomic<UInt64> readPos = 0;
+    std::atomic<bool> stop = false;
+
+    // writer shuffles packets in small groups and writes them slightly
+    // ahead of reader, sometimes overlapping with the window being read
+    std::thread writer([&] {
+        std::mt19937 rng(777);
+        std::vector<UInt64> group;
+
+        UInt64 writePos = 0;
+
+        while (!stop) {
+            const UInt64 pos = readPos;
+
+            if (writePos < pos) {
+                writePos = pos;
+            }
+            if (writePos > pos + params.Capacity / 2) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            group.clear();
+            for (UInt32 n = 0; n < 4; n++) {
+                group.push_back(writePos + n * PacketFrames);
+            }
+            std::shuffle(group.begin(), group.end(), rng);
+
+            for (UInt64 sampleTime : group) {
+                WritePacket(buffer, sampleTime, PacketFrames);
+            }
+
+            writePos += 4 * PacketFrames;
+        }
+    });
+
+    UInt64 numValid = 0;
+    UInt64 numCorrupted = 0;
+
+    for (UInt32 cycle = 0; cycle < NumCycles; cycle++) {
+        const UInt64 sampleTime = UInt64(cycle) * CycleFrames;
+
+        const auto samples = ReadWindow(buffer, sampleTime, CycleFrames);
+
+        for (UInt32 n = 0; n < CycleFrames; n++) {
+            const Float32* frame = &samples[n * NumChannels];
+
+            if (IsFrameValid(frame, sampleTime + n)) {
+                numValid++;
+            } else if (!IsFrameSilent(frame)) {
+                numCorrupted++;
+            }
+        }
+
+        readPos = sampleTime + CycleFrames;
+    }
+
+    stop = true;
+    writer.join();
+
+    // frames may be missing, but never torn or misplaced
+    EXPECT_EQ(0, numCorrupted);
+    EXPECT_GT(numValid, 0);
+}
@@ -0,0 +1,131 @@
+#include <aspl/Driver.hpp>
+#include <aspl/MemoryResource.hpp>
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+
+#if ASPL_HAS_PMR
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::atomic<size_t> numAllocations = 0;
+    std::atomic<size_t> numDeallocations = 0;
+    std::atomic<size_t> numBytes = 0;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        numAllocations++;
+        numBytes += bytes;
+
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        numDeallocations++;
+        numBytes -= bytes;
+
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} // anonymous namespace
+
+struct MemoryResourceTest : ::testing::Test
+{
+    std::shared_ptr<CountingResource> resource = std::make_shared<CountingResource>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        std::make_shared<TestTracer>(), nullptr, nullptr, nullptr, resource);
+};
+
+TEST_F(MemoryResourceTest, DoubleBuffer)
+{
+    aspl::DoubleBuffer<aspl::Vector<int>> buffer(
+        std::allocator_arg, aspl::MakeAllocator(resource.get()));
+
+    EXPECT_EQ(resource.get(), buffer.Get().get_allocator().resource());
+
+    // value from global heap is copied into resource
+    aspl::Vector<int> heapValue({1, 2, 3}, aspl::MakeAllocator<int>(nullptr));
+
+    const size_t allocsBefore = resource->numAllocations;
+
+    buffer.Set(heapValue);
+
+    EXPECT_GT(resource->numAllocations, allocsBefore);
+
+    // copy made by getter uses resource too
+    auto value = buffer.Get();
+
+    EXPECT_EQ(resource.get(), value.get_allocator().resource());
+    EXPECT_EQ(3, value.size());
+
+    // moving value from same resource does not allocate
+    value.push_back(4);
+
+    const size_t allocsBeforeMove = resource->numAllocations;
+
+    buffer.Set(std::move(value));
+
+    EXPECT_EQ(allocsBeforeMove, resource->numAllocations);
+    EXPECT_EQ(4, buffer.GetReadLock().GetReference().size());
+}
+
+TEST_F(MemoryResourceTest, Objects)
+{
+    {
+        auto plugin = std::make_shared<aspl::Plugin>(context);
+        auto device = std::make_shared<aspl::Device>(context);
+
+        const size_t allocsBefore = resource->numAllocations;
+
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+        plugin->AddDevice(device);
+
+        // dispatcher, owned objects, and stream and control maps
+        EXPECT_GT(resource->numAllocations, allocsBefore);
+
+        EXPECT_EQ(2, device->GetStreamCount(aspl::Direction::Input) +
+                         device->GetStreamCount(aspl::Direction::Output));
+        EXPECT_EQ(device, context->Dispatcher->FindObject(device->GetID()));
+
+        plugin->RemoveDevice(device);
+    }
+
+    // after context and dispatcher are destroyed, everything is freed
+    context.reset();
+
+    EXPECT_EQ(0, resource->numBytes);
+    EXPECT_EQ(resource->numAllocations, resource->numDeallocations);
+}
+
+TEST_F(MemoryResourceTest, DefaultResource)
+{
+    auto defaultContext = std::make_shared<aspl::Context>(std::make_shared<TestTracer>());
+
+    EXPECT_FALSE(defaultContext->MemoryResource);
+
+    auto device = std::make_shared<aspl::Device>(defaultContext);
+    device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    EXPECT_EQ(1, device->GetStreamCount(aspl::Direction::Output));
+    EXPECT_EQ(0, resource->numAllocations);
+}
+
+#endif // ASPL_HAS_PMR
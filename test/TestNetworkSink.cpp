@@ -0,0 +1,229 @@
+#include <aspl/NetworkSink.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace {
+
+struct RtpPacket
+{
+    UInt8 Version = 0;
+    UInt8 PayloadType = 0;
+    UInt16 Sequence = 0;
+    UInt32 Timestamp = 0;
+    UInt32 SSRC = 0;
+    std::vector<UInt8> Payload;
+};
+
+bool ParsePacket(const UInt8* data, size_t size, RtpPacket& packet)
+{
+    if (size < aspl::NetworkSink::HeaderSize) {
+        return false;
+    }
+
+    packet.Version = data[0] >> 6;
+    packet.PayloadType = data[1] & 0x7f;
+    packet.Sequence = UInt16((data[2] << 8) | data[3]);
+    packet.Timestamp = (UInt32(data[4]) << 24) | (UInt32(data[5]) << 16) |
+                       (UInt32(data[6]) << 8) | data[7];
+    packet.SSRC = (UInt32(data[8]) << 24) | (UInt32(data[9]) << 16) |
+                  (UInt32(data[10]) << 8) | data[11];
+    packet.Payload.assign(data + aspl::NetworkSink::HeaderSize, data + size);
+
+    return true;
+}
+
+} // anonymous namespace
+
+struct NetworkSinkTest : ::testing::Test
+{
+    int receiver = -1;
+    UInt16 port = 0;
+
+    void SetUp() override
+    {
+        receiver = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        ASSERT_NE(-1, receiver);
+
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = 0;
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+        ASSERT_EQ(0, bind(receiver, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)));
+
+        socklen_t addrLen = sizeof(addr);
+        ASSERT_EQ(
+            0, getsockname(receiver, reinterpret_cast<sockaddr*>(&addr), &addrLen));
+
+        port = ntohs(addr.sin_port);
+
+        timeval timeout = {};
+        timeout.tv_sec = 1;
+        setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    void TearDown() override
+    {
+        if (receiver != -1) {
+            close(receiver);
+        }
+    }
+
+    aspl::NetworkSinkParameters MakeParams()
+    {
+        aspl::NetworkSinkParameters params;
+        params.Port = port;
+        params.BytesPerFrame = 8;
+        params.MaxPayloadSize = 100;
+        params.PayloadType = 100;
+        params.SSRC = 0x12345678;
+        params.PollInterval = 100;
+        return params;
+    }
+
+    std::vector<RtpPacket> Receive(size_t count)
+    {
+        std::vector<RtpPacket> packets;
+
+        while (packets.size() < count) {
+            UInt8 buf[2048];
+            const ssize_t ret = recv(receiver, buf, sizeof(buf), 0);
+            if (ret <= 0) {
+                break;
+            }
+
+            RtpPacket packet;
+            if (ParsePacket(buf, size_t(ret), packet)) {
+                packets.push_back(std::move(packet));
+            }
+        }
+
+        return packets;
+    }
+
+    void TestPackets(bool enableGSO)
+    {
+        auto params = MakeParams();
+        params.EnableGSO = enableGSO;
+
+        aspl::NetworkSink sink(params);
+
+        ASSERT_EQ(kAudioHardwareNoError, sink.Start());
+
+        // 125 frames of 8 bytes, split into 10 packets of 12 frames
+        // and 1 packet of 5 frames
+        std::vector<UInt8> samples(1000);
+        for (size_t n = 0; n < samples.size(); n++) {
+            samples[n] = UInt8(n);
+        }
+
+        sink.Write(500, samples.data(), UInt32(samples.size()));
+
+        const auto packets = Receive(11);
+        ASSERT_EQ(11, packets.size());
+
+        std::vector<UInt8> payload;
+
+        for (size_t n = 0; n < packets.size(); n++) {
+            EXPECT_EQ(2, packets[n].Version);
+            EXPECT_EQ(100, packets[n].PayloadType);
+            EXPECT_EQ(0x12345678, packets[n].SSRC);
+            EXPECT_EQ(n, packets[n].Sequence);
+            EXPECT_EQ(500 + n * 12, packets[n].Timestamp);
+            EXPECT_EQ(n < 10 ? 96 : 40, packets[n].Payload.size());
+
+            payload.insert(
+                payload.end(), packets[n].Payload.begin(), packets[n].Payload.end());
+        }
+
+        EXPECT_EQ(samples, payload);
+
+        sink.Stop();
+
+        const auto stats = sink.GetStats();
+
+        EXPECT_EQ(11, stats.NumQueuedPackets);
+        EXPECT_EQ(11, stats.NumSentPackets);
+        EXPECT_EQ(0, stats.NumDroppedPackets);
+        EXPECT_EQ(0, stats.NumFailedPackets);
+        EXPECT_GT(stats.NumSendCalls, 0);
+    }
+};
+
+TEST_F(NetworkSinkTest, Packets)
+{
+    TestPackets(false);
+}
+
+TEST_F(NetworkSinkTest, PacketsGSO)
+{
+    TestPackets(true);
+}
+
+TEST_F(NetworkSinkTest, NotStarted)
+{
+    aspl::NetworkSink sink(MakeParams());
+
+    std::vector<UInt8> samples(192);
+
+    // dropped
+    sink.Write(0, samples.data(), UInt32(samples.size()));
+
+    EXPECT_EQ(2, sink.GetStats().NumDroppedPackets);
+    EXPECT_EQ(0, sink.GetStats().NumQueuedPackets);
+
+    ASSERT_EQ(kAudioHardwareNoError, sink.Start());
+
+    sink.Write(24, samples.data(), UInt32(samples.size()));
+
+    const auto packets = Receive(2);
+    ASSERT_EQ(2, packets.size());
+
+    // sequence numbers account for dropped packets
+    EXPECT_EQ(2, packets[0].Sequence);
+    EXPECT_EQ(3, packets[1].Sequence);
+    EXPECT_EQ(24, packets[0].Timestamp);
+    EXPECT_EQ(36, packets[1].Timestamp);
+
+    sink.Stop();
+
+    EXPECT_EQ(2, sink.GetStats().NumSentPackets);
+}
+
+TEST_F(NetworkSinkTest, QueueOverflow)
+{
+    auto params = MakeParams();
+    params.QueueSize = 4;
+    params.PollInterval = 200000;
+
+    aspl::NetworkSink sink(params);
+
+    ASSERT_EQ(kAudioHardwareNoError, sink.Start());
+
+    // let sender thread find empty queue and go to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::vector<UInt8> samples(96 * 10);
+    sink.Write(0, samples.data(), UInt32(samples.size()));
+
+    // remaining packets are sent before stopping
+    sink.Stop();
+
+    const auto stats = sink.GetStats();
+
+    EXPECT_EQ(4, stats.NumQueuedPackets);
+    EXPECT_EQ(6, stats.NumDroppedPackets);
+    EXPECT_EQ(4, stats.NumSentPackets);
+
+    EXPECT_EQ(4, Receive(4).size());
+}
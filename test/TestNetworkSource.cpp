@@ -0,0 +1,311 @@
+#include <aspl/NetworkSink.hpp>
+#include <aspl/NetworkSource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr UInt32 BytesPerFrame = 8;
+
+aspl::NetworkSourceStreamParameters MakeStreamParams(UInt32 streamID, UInt32 latency)
+{
+    aspl::NetworkSourceStreamParameters params;
+    params.StreamID = streamID;
+    params.Latency = latency;
+    params.Buffer.BytesPerFrame = BytesPerFrame;
+    params.Buffer.Capacity = 4096;
+    return params;
+}
+
+aspl::NetworkSinkParameters MakeSinkParams(UInt16 port, UInt32 ssrc)
+{
+    aspl::NetworkSinkParameters params;
+    params.Port = port;
+    params.BytesPerFrame = BytesPerFrame;
+    params.MaxPayloadSize = 256;
+    params.SSRC = ssrc;
+    params.PollInterval = 100;
+    return params;
+}
+
+std::vector<UInt8> MakeSamples(size_t size, UInt8 seed)
+{
+    std::vector<UInt8> samples(size);
+    for (size_t n = 0; n < samples.size(); n++) {
+        samples[n] = UInt8(n * 7 + seed);
+    }
+    return samples;
+}
+
+// Wait until source routes given number of packets.
+bool WaitPackets(const aspl::NetworkSource& source, UInt64 count)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (source.GetStats().NumRoutedPackets + source.GetStats().NumUnknownPackets +
+               source.GetStats().NumInvalidPackets <
+           count) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return true;
+}
+
+void SendRaw(UInt16 port, const std::vector<UInt8>& packet)
+{
+    const int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    ASSERT_NE(-1, fd);
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+    ASSERT_EQ(ssize_t(packet.size()),
+        sendto(fd,
+            packet.data(),
+            packet.size(),
+            0,
+            reinterpret_cast<sockaddr*>(&addr),
+            sizeof(addr)));
+
+    close(fd);
+}
+
+} // anonymous namespace
+
+struct NetworkSourceTest : ::testing::Test
+{
+    aspl::NetworkSourceParameters MakeParams()
+    {
+        aspl::NetworkSourceParameters params;
+        params.Port = 0;
+        params.BatchSize = 8;
+        params.PollInterval = 1000;
+        params.SocketBufferSize = 1024 * 1024;
+        return params;
+    }
+};
+
+TEST_F(NetworkSourceTest, AddStream)
+{
+    aspl::NetworkSource source(MakeParams());
+
+    EXPECT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(1, 0)));
+    EXPECT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(2, 0)));
+
+    // duplicate
+    EXPECT_NE(kAudioHardwareNoError, source.AddStream(MakeStreamParams(1, 0)));
+
+    ASSERT_EQ(kAudioHardwareNoError, source.Start());
+    EXPECT_NE(0, source.GetPort());
+
+    // running
+    EXPECT_NE(kAudioHardwareNoError, source.AddStream(MakeStreamParams(3, 0)));
+
+    source.Stop();
+
+    EXPECT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(3, 0)));
+    EXPECT_EQ(3, source.GetStreamCount());
+}
+
+TEST_F(NetworkSourceTest, Loopback)
+{
+    // 1000 frames per stream, 32 frames per packet
+    constexpr UInt32 FrameCount = 1000;
+    constexpr UInt32 NumPackets = 32;
+
+    aspl::NetworkSource source(MakeParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(10, FrameCount)));
+    ASSERT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(20, FrameCount)));
+    ASSERT_EQ(kAudioHardwareNoError, source.Start());
+
+    aspl::NetworkSink sink1(MakeSinkParams(source.GetPort(), 10));
+    aspl::NetworkSink sink2(MakeSinkParams(source.GetPort(), 20));
+
+    ASSERT_EQ(kAudioHardwareNoError, sink1.Start());
+    ASSERT_EQ(kAudioHardwareNoError, sink2.Start());
+
+    const auto samples1 = MakeSamples(FrameCount * BytesPerFrame, 1);
+    const auto samples2 = MakeSamples(FrameCount * BytesPerFrame, 2);
+
+    // streams use different timestamps
+    sink1.Write(100, samples1.data(), UInt32(samples1.size()));
+    sink2.Write(0xfffffff0, samples2.data(), UInt32(samples2.size()));
+
+    ASSERT_TRUE(WaitPackets(source, NumPackets * 2));
+
+    EXPECT_EQ(NumPackets * 2, source.GetStats().NumRoutedPackets);
+    EXPECT_EQ(NumPackets, source.GetStreamStats(10).NumPackets);
+    EXPECT_EQ(NumPackets, source.GetStreamStats(20).NumPackets);
+
+    // first read is aligned to latency, so it returns all frames
+    // of every stream, regardless of device sample time
+    std::vector<UInt8> output(samples1.size());
+
+    EXPECT_EQ(FrameCount, source.Read(10, 5000, output.data(), UInt32(output.size())));
+    EXPECT_EQ(samples1, output);
+
+    EXPECT_EQ(FrameCount, source.Read(20, 5000, output.data(), UInt32(output.size())));
+    EXPECT_EQ(samples2, output);
+
+    // unknown stream
+    EXPECT_EQ(0, source.Read(30, 5000, output.data(), UInt32(output.size())));
+    EXPECT_EQ(std::vector<UInt8>(output.size()), output);
+
+    // send next frames, timestamp of stream 2 wraps around
+    sink1.Write(100 + FrameCount, samples2.data(), UInt32(samples2.size()));
+    sink2.Write(0xfffffff0 + FrameCount, samples1.data(), UInt32(samples1.size()));
+
+    ASSERT_TRUE(WaitPackets(source, NumPackets * 4));
+
+    EXPECT_EQ(FrameCount,
+        source.Read(10, 5000 + FrameCount, output.data(), UInt32(output.size())));
+    EXPECT_EQ(samples2, output);
+
+    EXPECT_EQ(FrameCount,
+        source.Read(20, 5000 + FrameCount, output.data(), UInt32(output.size())));
+    EXPECT_EQ(samples1, output);
+
+    // next frames weren't sent
+    EXPECT_EQ(0,
+        source.Read(10, 5000 + FrameCount * 2, output.data(), UInt32(output.size())));
+    EXPECT_EQ(FrameCount, source.GetStreamStats(10).NumLostFrames);
+
+    sink1.Stop();
+    sink2.Stop();
+    source.Stop();
+}
+
+TEST_F(NetworkSourceTest, UnknownAndInvalid)
+{
+    aspl::NetworkSource source(MakeParams());
+
+    ASSERT_EQ(kAudioHardwareNoError, source.AddStream(MakeStreamParams(1, 4)));
+    ASSERT_EQ(kAudioHardwareNoError, source.Start());
+
+    // truncated header
+    SendRaw(source.GetPort(), {0x80, 0x60, 0x00});
+
+    // unsupported version
+    SendRaw(source.GetPort(), std::vector<UInt8>(20, 0x00));
+
+    // unknown SSRC
+    SendRaw(source.GetPort(),
+        {0x80, 0x60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 3, 4, 5, 6, 7, 8});
+
+    // one CSRC and 4 frames
+    std::vector<UInt8> packet = {0x81, 0x60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 9, 9, 9};
+    const auto samples = MakeSamples(4 * BytesPerFrame, 3);
+    packet.insert(packet.end(), samples.begin(), samples.end());
+
+    SendRaw(source.GetPort(), packet);
+
+    ASSERT_TRUE(WaitPackets(source, 4));
+
+    const auto stats = source.GetStats();
+
+    EXPECT_EQ(4, stats.NumReceivedPackets);
+    EXPECT_EQ(2, stats.NumInvalidPackets);
+    EXPECT_EQ(1, stats.NumUnknownPackets);
+    EXPECT_EQ(1, stats.NumRoutedPackets);
+
+    std::vector<UInt8> output(samples.size());
+
+    EXPECT_EQ(4, source.Read(1, 0, output.data(), UInt32(output.size())));
+    EXPECT_EQ(samples, output);
+}
+
+TEST_F(NetworkSourceTest, LoopbackThroughputAndLatency)
+{
+    constexpr UInt32 NumStreams = 4;
+    constexpr UInt32 NumCycles = 500;
+    constexpr UInt32 CycleFrames = 128;
+
+    auto params = MakeParams();
+    params.BatchSize = 32;
+    params.SocketBufferSize = 4 * 1024 * 1024;
+
+    aspl::NetworkSource source(params);
+
+    for (UInt32 id = 0; id < NumStreams; id++) {
+        ASSERT_EQ(kAudioHardwareNoError,
+            source.AddStream(MakeStreamParams(id, CycleFrames * 4)));
+    }
+
+    ASSERT_EQ(kAudioHardwareNoError, source.Start());
+
+    std::vector<std::unique_ptr<aspl::NetworkSink>> sinks;
+
+    for (UInt32 id = 0; id < NumStreams; id++) {
+        auto sinkParams = MakeSinkParams(source.GetPort(), id);
+        sinkParams.MaxPayloadSize = CycleFrames * BytesPerFrame;
+
+        sinks.push_back(std::make_unique<aspl::NetworkSink>(sinkParams));
+        ASSERT_EQ(kAudioHardwareNoError, sinks.back()->Start());
+    }
+
+    std::vector<UInt8> samples(CycleFrames * BytesPerFrame, 0x55);
+    std::vector<UInt8> output(samples.size());
+
+    std::chrono::steady_clock::duration maxLatency = {};
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // Every cycle, each sink sends one packet, and we wait until all
+    // packets are delivered to source.
+    for (UInt32 cycle = 0; cycle < NumCycles; cycle++) {
+        const auto cycleStart = std::chrono::steady_clock::now();
+
+        for (auto& sink : sinks) {
+            sink->Write(cycle * CycleFrames, samples.data(), UInt32(samples.size()));
+        }
+
+        ASSERT_TRUE(WaitPackets(source, (cycle + 1) * NumStreams));
+
+        maxLatency = std::max(maxLatency, std::chrono::steady_clock::now() - cycleStart);
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - startTime;
+
+    for (UInt32 id = 0; id < NumStreams; id++) {
+        EXPECT_EQ(CycleFrames,
+            source.Read(id, 0, output.data(), UInt32(output.size())));
+        EXPECT_EQ(samples, output);
+    }
+
+    for (auto& sink : sinks) {
+        sink->Stop();
+        EXPECT_EQ(0, sink->GetStats().NumDroppedPackets);
+    }
+
+    source.Stop();
+
+    const auto stats = source.GetStats();
+
+    EXPECT_EQ(NumCycles * NumStreams, stats.NumReceivedPackets);
+    EXPECT_EQ(NumCycles * NumStreams, stats.NumRoutedPackets);
+    EXPECT_LE(stats.NumRecvCalls, stats.NumReceivedPackets);
+
+    // generous bound, local delivery normally takes microseconds
+    EXPECT_LT(maxLatency, std::chrono::seconds(1));
+
+    RecordProperty("packets_per_second",
+        int(double(stats.NumReceivedPackets) /
+            std::chrono::duration<double>(elapsed).count()));
+    RecordProperty("max_latency_us",
+        int(std::chrono::duration_cast<std::chrono::microseconds>(maxLatency).count()));
+}
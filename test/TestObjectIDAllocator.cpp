@@ -0,0 +1,173 @@
+#include "ObjectIDAllocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+constexpr AudioObjectID TestHintMaxID = 50;
+
+} // anonymous namespace
+
+TEST(ObjectIDAllocatorTest, Sequential)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    // reserved identifiers are skipped
+    for (AudioObjectID objectID = 2; objectID < TestHintMaxID; objectID++) {
+        ASSERT_EQ(objectID, allocator.Allocate());
+    }
+
+    EXPECT_EQ(TestHintMaxID - 2, allocator.GetAllocatedCount());
+}
+
+TEST(ObjectIDAllocatorTest, Reserved)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    EXPECT_FALSE(allocator.IsFree(kAudioObjectUnknown));
+    EXPECT_FALSE(allocator.IsFree(kAudioObjectPlugInObject));
+
+    // reserved identifiers can't be acquired or freed
+    EXPECT_FALSE(allocator.Acquire(kAudioObjectPlugInObject));
+
+    allocator.Free(kAudioObjectPlugInObject);
+    EXPECT_FALSE(allocator.IsFree(kAudioObjectPlugInObject));
+
+    EXPECT_EQ(0, allocator.GetAllocatedCount());
+
+    // and are never allocated, even after wrap around
+    for (int n = 0; n < 1000; n++) {
+        const auto objectID = allocator.Allocate();
+
+        ASSERT_NE(kAudioObjectUnknown, objectID);
+        ASSERT_NE(kAudioObjectPlugInObject, objectID);
+
+        allocator.Free(objectID);
+    }
+}
+
+TEST(ObjectIDAllocatorTest, Acquire)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    EXPECT_TRUE(allocator.Acquire(3));
+    EXPECT_FALSE(allocator.Acquire(3));
+
+    // acquired identifier is skipped by allocator
+    EXPECT_EQ(2, allocator.Allocate());
+    EXPECT_EQ(4, allocator.Allocate());
+
+    EXPECT_EQ(3, allocator.GetAllocatedCount());
+
+    allocator.Free(3);
+    allocator.Free(3);
+
+    EXPECT_TRUE(allocator.IsFree(3));
+    EXPECT_EQ(2, allocator.GetAllocatedCount());
+}
+
+TEST(ObjectIDAllocatorTest, DelayedReuse)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    const auto firstID = allocator.Allocate();
+    allocator.Free(firstID);
+
+    // freed identifiers are not reused until desired maximum is reached
+    for (AudioObjectID n = firstID + 1; n < TestHintMaxID; n++) {
+        const auto objectID = allocator.Allocate();
+        ASSERT_EQ(n, objectID);
+
+        allocator.Free(objectID);
+    }
+
+    // then the lowest free identifier is reused
+    EXPECT_EQ(firstID, allocator.Allocate());
+}
+
+TEST(ObjectIDAllocatorTest, GrowMaximum)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    // when most identifiers are in use, allocator continues after maximum
+    // instead of reusing few free identifiers below it
+    for (AudioObjectID n = 2; n < TestHintMaxID; n++) {
+        allocator.Allocate();
+    }
+
+    allocator.Free(10);
+
+    EXPECT_EQ(TestHintMaxID, allocator.Allocate());
+}
+
+TEST(ObjectIDAllocatorTest, LargeGaps)
+{
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    // fill several summary words, then free few identifiers far apart
+    constexpr AudioObjectID NumIDs = 64 * 64 * 3;
+
+    for (AudioObjectID n = 2; n < NumIDs; n++) {
+        allocator.Allocate();
+    }
+
+    const std::vector<AudioObjectID> freedIDs = {100, 5000, 9000, 12000};
+
+    for (auto objectID : freedIDs) {
+        allocator.Free(objectID);
+    }
+
+    // each allocation finds next free identifier after the last one,
+    // or continues after the end of bitmap
+    std::set<AudioObjectID> allocatedIDs;
+
+    for (size_t n = 0; n < freedIDs.size() + 1; n++) {
+        const auto objectID = allocator.Allocate();
+        ASSERT_TRUE(allocatedIDs.insert(objectID).second);
+    }
+
+    for (auto objectID : freedIDs) {
+        EXPECT_TRUE(allocatedIDs.count(objectID) || allocator.IsFree(objectID));
+    }
+}
+
+TEST(ObjectIDAllocatorTest, Churn)
+{
+    constexpr size_t NumAlive = 2000;
+    constexpr size_t NumOperations = 100000;
+
+    aspl::ObjectIDAllocator allocator(nullptr, TestHintMaxID, nullptr);
+
+    std::mt19937 rng(123);
+
+    std::vector<AudioObjectID> aliveIDs;
+    std::set<AudioObjectID> aliveSet;
+
+    for (size_t n = 0; n < NumOperations; n++) {
+        if (aliveIDs.size() < NumAlive && (aliveIDs.empty() || rng() % 2 == 0)) {
+            const auto objectID = allocator.Allocate();
+
+            ASSERT_GT(objectID, kAudioObjectPlugInObject);
+            ASSERT_TRUE(aliveSet.insert(objectID).second);
+
+            aliveIDs.push_back(objectID);
+        } else {
+            const size_t index = rng() % aliveIDs.size();
+
+            allocator.Free(aliveIDs[index]);
+            aliveSet.erase(aliveIDs[index]);
+
+            aliveIDs[index] = aliveIDs.back();
+            aliveIDs.pop_back();
+        }
+
+        ASSERT_EQ(aliveIDs.size(), allocator.GetAllocatedCount());
+    }
+
+    // identifiers are kept low
+    EXPECT_LT(*aliveSet.rbegin(), NumAlive * 4);
+}
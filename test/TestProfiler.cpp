@@ -0,0 +1,269 @@
+#include <aspl/Driver.hpp>
+#include <aspl/Profiler.hpp>
+#include <aspl/StaticDevice.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+namespace {
+
+constexpr UInt32 TestSampleRate = 48000;
+constexpr UInt32 TestBufferSize = 480;
+constexpr UInt32 TestNumClients = 2;
+constexpr UInt32 TestNumCycles = 5;
+
+// 1 tick is 1 nanosecond
+constexpr UInt64 TestHandlerTime = 500;
+
+struct EventPair
+{
+    aspl::ProfilerEvent begin;
+    aspl::ProfilerEvent end;
+};
+
+class RecordingProfiler : public aspl::Profiler
+{
+public:
+    std::vector<EventPair> events;
+    bool insideHandler = false;
+
+    void HandlerBegin(const aspl::ProfilerEvent& event) override
+    {
+        EXPECT_FALSE(insideHandler);
+        insideHandler = true;
+
+        events.push_back({event, {}});
+    }
+
+    void HandlerEnd(const aspl::ProfilerEvent& event) override
+    {
+        EXPECT_TRUE(insideHandler);
+        insideHandler = false;
+
+        ASSERT_FALSE(events.empty());
+        events.back().end = event;
+    }
+
+    std::map<aspl::ProfilerCallback, UInt32> CountCallbacks() const
+    {
+        std::map<aspl::ProfilerCallback, UInt32> counts;
+        for (const auto& pair : events) {
+            counts[pair.begin.Callback]++;
+        }
+        return counts;
+    }
+};
+
+// advances simulated clock to emulate handler time
+class SlowHandler : public aspl::IORequestHandler
+{
+public:
+    explicit SlowHandler(std::shared_ptr<aspl::SimulatedClock> clock)
+        : clock_(clock)
+    {
+    }
+
+    void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const void* bytes,
+        UInt32 bytesCount) override
+    {
+        clock_->AdvanceHostTime(TestHandlerTime);
+    }
+
+private:
+    std::shared_ptr<aspl::SimulatedClock> clock_;
+};
+
+class TestStaticDevice
+    : public aspl::StaticDevice<TestStaticDevice, Float32, 2, TestSampleRate>
+{
+public:
+    using StaticDevice::StaticDevice;
+};
+
+} // anonymous namespace
+
+struct ProfilerTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::SimulatedClock> clock =
+        std::make_shared<aspl::SimulatedClock>();
+
+    std::shared_ptr<RecordingProfiler> profiler = std::make_shared<RecordingProfiler>();
+
+    std::shared_ptr<aspl::Context> context =
+        std::make_shared<aspl::Context>(tracer, nullptr, clock, profiler);
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::DeviceParameters DeviceParams(bool enableMixing)
+    {
+        aspl::DeviceParameters params;
+        params.SampleRate = TestSampleRate;
+        params.ZeroTimeStampPeriod = TestBufferSize;
+        params.EnableMixing = enableMixing;
+
+        return params;
+    }
+
+    void RunSimulator(const std::shared_ptr<aspl::Device>& device)
+    {
+        aspl::HostSimulatorParameters params;
+        params.NumClients = TestNumClients;
+        params.BufferFrameSize = TestBufferSize;
+
+        aspl::HostSimulator simulator(driver, params);
+
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+        ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(TestNumCycles));
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+    }
+};
+
+TEST_F(ProfilerTest, Mixing)
+{
+    auto device = std::make_shared<aspl::Device>(context, DeviceParams(true));
+
+    auto inputStream = device->AddStreamWithControlsAsync(aspl::Direction::Input);
+    auto outputStream = device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    device->SetIOHandler(std::make_shared<SlowHandler>(clock));
+
+    plugin->AddDevice(device);
+
+    RunSimulator(device);
+
+    auto counts = profiler->CountCallbacks();
+
+    EXPECT_EQ(TestNumCycles, counts[aspl::ProfilerCallback::ReadClientInput]);
+    EXPECT_EQ(TestNumCycles * TestNumClients,
+        counts[aspl::ProfilerCallback::ProcessClientInput]);
+    EXPECT_EQ(0, counts[aspl::ProfilerCallback::ProcessClientOutput]);
+    EXPECT_EQ(0, counts[aspl::ProfilerCallback::WriteClientOutput]);
+    EXPECT_EQ(TestNumCycles, counts[aspl::ProfilerCallback::ProcessMixedOutput]);
+    EXPECT_EQ(TestNumCycles, counts[aspl::ProfilerCallback::WriteMixedOutput]);
+
+    EXPECT_FALSE(profiler->insideHandler);
+
+    UInt64 lastCycle = 0;
+
+    for (const auto& pair : profiler->events) {
+        const auto& begin = pair.begin;
+        const auto& end = pair.end;
+
+        // end event describes the same callback
+        EXPECT_EQ(begin.Callback, end.Callback);
+        EXPECT_EQ(begin.CycleCounter, end.CycleCounter);
+        EXPECT_EQ(begin.StreamID, end.StreamID);
+        EXPECT_EQ(begin.OperationID, end.OperationID);
+
+        EXPECT_EQ(device->GetID(), begin.DeviceID);
+        EXPECT_EQ(TestBufferSize, begin.FrameCount);
+        EXPECT_GE(begin.CycleCounter, lastCycle);
+
+        lastCycle = begin.CycleCounter;
+
+        switch (begin.Callback) {
+        case aspl::ProfilerCallback::ReadClientInput:
+        case aspl::ProfilerCallback::ProcessClientInput:
+            EXPECT_EQ(inputStream->GetID(), begin.StreamID);
+            EXPECT_EQ(begin.HostTime, end.HostTime);
+            break;
+
+        case aspl::ProfilerCallback::WriteMixedOutput:
+            EXPECT_EQ(outputStream->GetID(), begin.StreamID);
+            EXPECT_EQ(kAudioServerPlugInIOOperationWriteMix, begin.OperationID);
+            EXPECT_EQ(begin.HostTime + TestHandlerTime, end.HostTime);
+            break;
+
+        default:
+            EXPECT_EQ(outputStream->GetID(), begin.StreamID);
+            break;
+        }
+    }
+
+    EXPECT_EQ(TestNumCycles - 1, lastCycle);
+}
+
+TEST_F(ProfilerTest, NoMixing)
+{
+    auto device = std::make_shared<aspl::Device>(context, DeviceParams(false));
+
+    device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    plugin->AddDevice(device);
+
+    RunSimulator(device);
+
+    auto counts = profiler->CountCallbacks();
+
+    EXPECT_EQ(0, counts[aspl::ProfilerCallback::ReadClientInput]);
+    EXPECT_EQ(TestNumCycles * TestNumClients,
+        counts[aspl::ProfilerCallback::ProcessClientOutput]);
+    EXPECT_EQ(TestNumCycles * TestNumClients,
+        counts[aspl::ProfilerCallback::WriteClientOutput]);
+    EXPECT_EQ(0, counts[aspl::ProfilerCallback::WriteMixedOutput]);
+
+    for (const auto& pair : profiler->events) {
+        EXPECT_EQ(kAudioServerPlugInIOOperationMixOutput, pair.begin.OperationID);
+        EXPECT_NE(0, pair.begin.ClientID);
+    }
+}
+
+TEST_F(ProfilerTest, StaticDevice)
+{
+    auto device = std::make_shared<TestStaticDevice>(context, DeviceParams(true));
+
+    device->AddStaticStreamWithControlsAsync(aspl::Direction::Output);
+
+    plugin->AddDevice(device);
+
+    RunSimulator(device);
+
+    auto counts = profiler->CountCallbacks();
+
+    EXPECT_EQ(TestNumCycles, counts[aspl::ProfilerCallback::ProcessMixedOutput]);
+    EXPECT_EQ(TestNumCycles, counts[aspl::ProfilerCallback::WriteMixedOutput]);
+
+    EXPECT_FALSE(profiler->insideHandler);
+}
+
+TEST_F(ProfilerTest, Usdt)
+{
+    auto usdtProfiler = std::make_shared<aspl::UsdtProfiler>();
+
+    auto usdtContext =
+        std::make_shared<aspl::Context>(tracer, nullptr, clock, usdtProfiler);
+
+    auto usdtPlugin = std::make_shared<aspl::Plugin>(usdtContext);
+    auto usdtDriver = std::make_shared<aspl::Driver>(usdtContext, usdtPlugin);
+
+    auto device = std::make_shared<aspl::Device>(usdtContext, DeviceParams(true));
+
+    device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    usdtPlugin->AddDevice(device);
+
+    aspl::HostSimulator simulator(usdtDriver);
+
+    // probes are no-op unless attached
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(TestNumCycles));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(0, simulator.GetReport().NumFailedCalls);
+}
@@ -0,0 +1,224 @@
+#include <aspl/Driver.hpp>
+#include <aspl/RealtimeScope.hpp>
+
+#include "HostSimulator.hpp"
+#include "RealtimeChecker.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <mutex>
+
+namespace {
+
+class CheckingHandler : public aspl::IORequestHandler
+{
+public:
+    bool allocate = false;
+    bool lock = false;
+
+    UInt32 numCalls = 0;
+    UInt32 numRealtimeCalls = 0;
+
+    std::mutex mutex;
+
+    void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const void* bytes,
+        UInt32 bytesCount) override
+    {
+        numCalls++;
+
+        if (aspl::RealtimeScope::IsRealtimeThread()) {
+            numRealtimeCalls++;
+        }
+
+        if (allocate) {
+            // volatile prevents compiler from eliding the allocation
+            void* volatile ptr = malloc(bytesCount);
+            free(ptr);
+        }
+
+        if (lock) {
+            std::lock_guard guard(mutex);
+        }
+    }
+};
+
+} // anonymous namespace
+
+struct RealtimeCheckerTest : ::testing::Test
+{
+    static constexpr UInt32 NumCycles = 100;
+
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        tracer, nullptr, std::make_shared<aspl::SimulatedClock>());
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<CheckingHandler> handler = std::make_shared<CheckingHandler>();
+
+    void SetUp() override
+    {
+        if (!aspl::RealtimeChecker::IsSupported()) {
+            GTEST_SKIP() << "realtime checker is not supported on this platform";
+        }
+
+        aspl::RealtimeChecker::Reset();
+    }
+
+    void TearDown() override
+    {
+        aspl::RealtimeChecker::SetMode(aspl::RealtimeChecker::Mode::Disabled);
+        aspl::RealtimeChecker::Reset();
+    }
+
+    std::shared_ptr<aspl::Device> CreateDevice(bool enableChecks,
+        bool enableTracing = false)
+    {
+        aspl::DeviceParameters params;
+        params.EnableRealtimeChecks = enableChecks;
+        params.EnableRealtimeTracing = enableTracing;
+
+        auto device = std::make_shared<aspl::Device>(context, params);
+
+        device->AddStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStreamWithControlsAsync(aspl::Direction::Output);
+        device->SetIOHandler(handler);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+
+    void RunCycles()
+    {
+        aspl::HostSimulatorParameters params;
+        params.NumClients = 2;
+
+        aspl::HostSimulator simulator(driver, params);
+
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Start());
+
+        aspl::RealtimeChecker::SetMode(aspl::RealtimeChecker::Mode::Count);
+
+        ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+
+        aspl::RealtimeChecker::SetMode(aspl::RealtimeChecker::Mode::Disabled);
+
+        ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+    }
+};
+
+TEST_F(RealtimeCheckerTest, Scope)
+{
+    EXPECT_FALSE(aspl::RealtimeScope::IsRealtimeThread());
+
+    {
+        aspl::RealtimeScope outer;
+        EXPECT_TRUE(aspl::RealtimeScope::IsRealtimeThread());
+
+        {
+            aspl::RealtimeScope inner;
+            EXPECT_TRUE(aspl::RealtimeScope::IsRealtimeThread());
+        }
+
+        EXPECT_TRUE(aspl::RealtimeScope::IsRealtimeThread());
+
+        {
+            aspl::RealtimeScope disabled(false);
+            EXPECT_TRUE(aspl::RealtimeScope::IsRealtimeThread());
+        }
+    }
+
+    EXPECT_FALSE(aspl::RealtimeScope::IsRealtimeThread());
+
+    {
+        aspl::RealtimeScope disabled(false);
+        EXPECT_FALSE(aspl::RealtimeScope::IsRealtimeThread());
+    }
+}
+
+TEST_F(RealtimeCheckerTest, DefaultPath)
+{
+    CreateDevice(true);
+
+    RunCycles();
+
+    EXPECT_EQ(NumCycles, handler->numCalls);
+    EXPECT_EQ(NumCycles, handler->numRealtimeCalls);
+
+    // default I/O path of the library should be realtime-safe;
+    // I/O mutex is not contended here, so it's acquired without blocking
+    EXPECT_EQ(0, aspl::RealtimeChecker::GetViolationCount());
+}
+
+TEST_F(RealtimeCheckerTest, Allocation)
+{
+    CreateDevice(true);
+
+    handler->allocate = true;
+
+    RunCycles();
+
+    EXPECT_EQ(NumCycles,
+        aspl::RealtimeChecker::GetViolationCount(
+            aspl::RealtimeChecker::Violation::Malloc));
+    EXPECT_EQ(NumCycles,
+        aspl::RealtimeChecker::GetViolationCount(aspl::RealtimeChecker::Violation::Free));
+    EXPECT_EQ(0,
+        aspl::RealtimeChecker::GetViolationCount(
+            aspl::RealtimeChecker::Violation::MutexLock));
+}
+
+TEST_F(RealtimeCheckerTest, MutexLock)
+{
+    CreateDevice(true);
+
+    handler->lock = true;
+
+    RunCycles();
+
+    EXPECT_EQ(NumCycles,
+        aspl::RealtimeChecker::GetViolationCount(
+            aspl::RealtimeChecker::Violation::MutexLock));
+    EXPECT_EQ(0,
+        aspl::RealtimeChecker::GetViolationCount(
+            aspl::RealtimeChecker::Violation::Malloc));
+}
+
+TEST_F(RealtimeCheckerTest, RealtimeTracing)
+{
+    CreateDevice(true, true);
+
+    RunCycles();
+
+    // tracer formats messages into stack buffers, so with Print() that
+    // doesn't allocate or lock, realtime tracing doesn't cause violations
+    EXPECT_EQ(0, aspl::RealtimeChecker::GetViolationCount());
+}
+
+TEST_F(RealtimeCheckerTest, ChecksDisabled)
+{
+    CreateDevice(false);
+
+    handler->allocate = true;
+    handler->lock = true;
+
+    RunCycles();
+
+    // threads are not marked as realtime
+    EXPECT_EQ(NumCycles, handler->numCalls);
+    EXPECT_EQ(0, handler->numRealtimeCalls);
+
+    EXPECT_EQ(0, aspl::RealtimeChecker::GetViolationCount());
+}
@@ -0,0 +1,268 @@
+#include <aspl/Driver.hpp>
+#include <aspl/ScratchArena.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+
+namespace {
+
+class ScratchHandler : public aspl::IORequestHandler
+{
+public:
+    aspl::Device* device = nullptr;
+
+    UInt32 numCalls = 0;
+    UInt32 numFailedBorrows = 0;
+
+    UInt32 lastFrameCount = 0;
+    UInt32 lastChannelCount = 0;
+
+    void OnProcessMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount,
+        UInt32 channelCount) override
+    {
+        numCalls++;
+
+        auto buffer = device->BorrowScratchBuffer();
+
+        if (!buffer || buffer.GetFrameCount() < frameCount ||
+            buffer.GetChannelCount() < channelCount) {
+            numFailedBorrows++;
+            return;
+        }
+
+        // copy through scratch buffer
+        const UInt32 sampleCount = frameCount * channelCount;
+        for (UInt32 n = 0; n < sampleCount; n++) {
+            buffer.GetData()[n] = frames[n] * 0.5f;
+        }
+        for (UInt32 n = 0; n < sampleCount; n++) {
+            frames[n] = buffer.GetData()[n];
+        }
+
+        lastFrameCount = buffer.GetFrameCount();
+        lastChannelCount = buffer.GetChannelCount();
+    }
+};
+
+} // anonymous namespace
+
+struct ScratchArenaTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        tracer, nullptr, std::make_shared<aspl::SimulatedClock>());
+};
+
+TEST_F(ScratchArenaTest, Borrow)
+{
+    aspl::ScratchArena arena(3, 100, 2);
+
+    EXPECT_EQ(3, arena.GetBufferCount());
+    EXPECT_EQ(3, arena.GetAvailableCount());
+    EXPECT_EQ(100, arena.GetFrameCount());
+    EXPECT_EQ(2, arena.GetChannelCount());
+
+    std::set<Float32*> pointers;
+
+    {
+        auto buf1 = arena.Borrow();
+        auto buf2 = arena.Borrow();
+        auto buf3 = arena.Borrow();
+
+        for (auto* buf : {&buf1, &buf2, &buf3}) {
+            ASSERT_TRUE(*buf);
+            EXPECT_EQ(100, buf->GetFrameCount());
+            EXPECT_EQ(2, buf->GetChannelCount());
+            EXPECT_EQ(100 * 2 * sizeof(Float32), buf->GetByteCount());
+            EXPECT_EQ(0,
+                reinterpret_cast<uintptr_t>(buf->GetData()) %
+                    aspl::ScratchArena::Alignment);
+
+            pointers.insert(buf->GetData());
+        }
+
+        EXPECT_EQ(3, pointers.size());
+        EXPECT_EQ(0, arena.GetAvailableCount());
+
+        auto buf4 = arena.Borrow();
+        EXPECT_FALSE(buf4);
+        EXPECT_EQ(nullptr, buf4.GetData());
+        EXPECT_EQ(0, buf4.GetFrameCount());
+
+        buf2.Reset();
+        EXPECT_FALSE(buf2);
+        EXPECT_EQ(1, arena.GetAvailableCount());
+
+        buf4 = arena.Borrow();
+        EXPECT_TRUE(buf4);
+        EXPECT_EQ(0, arena.GetAvailableCount());
+    }
+
+    EXPECT_EQ(3, arena.GetAvailableCount());
+
+    // same buffers are reused
+    for (UInt32 n = 0; n < 10; n++) {
+        auto buf = arena.Borrow();
+        EXPECT_TRUE(pointers.count(buf.GetData()));
+    }
+
+    EXPECT_EQ(3, arena.GetAvailableCount());
+}
+
+TEST_F(ScratchArenaTest, Move)
+{
+    aspl::ScratchArena arena(2, 10, 1);
+
+    auto buf1 = arena.Borrow();
+    Float32* data = buf1.GetData();
+
+    aspl::ScratchBuffer buf2(std::move(buf1));
+    EXPECT_FALSE(buf1);
+    EXPECT_TRUE(buf2);
+    EXPECT_EQ(data, buf2.GetData());
+    EXPECT_EQ(1, arena.GetAvailableCount());
+
+    aspl::ScratchBuffer buf3 = arena.Borrow();
+    EXPECT_EQ(0, arena.GetAvailableCount());
+
+    // buf3 is returned, buf2 is moved to buf3
+    buf3 = std::move(buf2);
+    EXPECT_FALSE(buf2);
+    EXPECT_EQ(data, buf3.GetData());
+    EXPECT_EQ(1, arena.GetAvailableCount());
+
+    buf3.Reset();
+    EXPECT_EQ(2, arena.GetAvailableCount());
+}
+
+TEST_F(ScratchArenaTest, Empty)
+{
+    aspl::ScratchArena arena(0, 100, 2);
+
+    EXPECT_EQ(0, arena.GetBufferCount());
+    EXPECT_EQ(0, arena.GetFrameCount());
+    EXPECT_EQ(0, arena.GetChannelCount());
+
+    auto buf = arena.Borrow();
+    EXPECT_FALSE(buf);
+}
+
+TEST_F(ScratchArenaTest, DeviceDisabled)
+{
+    auto device = std::make_shared<aspl::Device>(context);
+
+    auto buf = device->BorrowScratchBuffer();
+    EXPECT_FALSE(buf);
+}
+
+TEST_F(ScratchArenaTest, DeviceIO)
+{
+    aspl::DeviceParameters params;
+    params.ScratchBufferCount = 2;
+    params.ZeroTimeStampPeriod = 256;
+    params.MaxIOBufferFrameSize = 512;
+
+    auto device = std::make_shared<aspl::Device>(context, params);
+    device->AddStreamWithControlsAsync(aspl::Direction::Output);
+
+    auto handler = std::make_shared<ScratchHandler>();
+    handler->device = device.get();
+    device->SetIOHandler(handler);
+
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+    plugin->AddDevice(device);
+
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(10));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(10, handler->numCalls);
+    EXPECT_EQ(0, handler->numFailedBorrows);
+    EXPECT_EQ(512, handler->lastFrameCount);
+    EXPECT_EQ(2, handler->lastChannelCount);
+
+    // period becomes larger than max buffer size, and a stream with
+    // more channels is added; buffers are reallocated when HAL performs
+    // configuration change
+    device->SetZeroTimeStampPeriodAsync(1024);
+
+    aspl::StreamParameters streamParams;
+    streamParams.Direction = aspl::Direction::Output;
+    streamParams.Format.mChannelsPerFrame = 6;
+    streamParams.Format.mBytesPerFrame = 6 * sizeof(Float32);
+    streamParams.Format.mBytesPerPacket = 6 * sizeof(Float32);
+    device->AddStreamAsync(streamParams);
+
+    EXPECT_EQ(2, simulator.GetConfigurationRequestCount());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(10));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(0, handler->numFailedBorrows);
+    EXPECT_EQ(1024, handler->lastFrameCount);
+    EXPECT_EQ(6, handler->lastChannelCount);
+}
+
+TEST_F(ScratchArenaTest, DeviceReconfigureDuringIO)
+{
+    aspl::DeviceParameters params;
+    params.ScratchBufferCount = 1;
+    params.ZeroTimeStampPeriod = 256;
+
+    auto device = std::make_shared<aspl::Device>(context, params);
+    device->AddStreamAsync(aspl::Direction::Output);
+
+    auto plugin = std::make_shared<aspl::Plugin>(context);
+    plugin->AddDevice(device);
+
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    aspl::HostSimulator simulator(driver);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start());
+
+    {
+        // buffer borrowed before reconfiguration stays valid
+        auto oldBuf = device->BorrowScratchBuffer();
+        ASSERT_TRUE(oldBuf);
+        EXPECT_EQ(256, oldBuf.GetFrameCount());
+
+        device->SetZeroTimeStampPeriodAsync(1024);
+        ASSERT_EQ(kAudioHardwareNoError, simulator.ProcessConfigurationChanges());
+
+        for (UInt32 n = 0; n < oldBuf.GetFrameCount() * oldBuf.GetChannelCount(); n++) {
+            oldBuf.GetData()[n] = 1;
+        }
+
+        // new borrows use new arena
+        auto newBuf = device->BorrowScratchBuffer();
+        ASSERT_TRUE(newBuf);
+        EXPECT_EQ(1024, newBuf.GetFrameCount());
+    }
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    auto buf = device->BorrowScratchBuffer();
+    ASSERT_TRUE(buf);
+    EXPECT_EQ(1024, buf.GetFrameCount());
+}
@@ -0,0 +1,293 @@
+#include <aspl/SharedRingReader.hpp>
+#include <aspl/SharedRingWriter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+constexpr UInt32 BytesPerFrame = 4;
+
+std::vector<UInt8> MakeFrames(UInt32 frameCount, UInt8 seed)
+{
+    std::vector<UInt8> frames(frameCount * BytesPerFrame);
+    for (size_t n = 0; n < frames.size(); n++) {
+        frames[n] = UInt8(n * 3 + seed);
+    }
+    return frames;
+}
+
+} // anonymous namespace
+
+struct SharedRingTest : ::testing::Test
+{
+    aspl::SharedRingParameters MakeParams()
+    {
+        aspl::SharedRingParameters params;
+        params.Name = "/aspl-test-" + std::to_string(getpid());
+        params.Capacity = 64;
+        params.NotifyInterval = 100;
+        return params;
+    }
+};
+
+TEST_F(SharedRingTest, OpenClose)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingReader reader(params.Name);
+
+    // no writer
+    EXPECT_NE(kAudioHardwareNoError, reader.Open());
+    EXPECT_FALSE(reader.IsOpen());
+
+    aspl::SharedRingWriter writer(params);
+
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+    EXPECT_TRUE(writer.IsOpen());
+
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+    EXPECT_TRUE(reader.IsOpen());
+    EXPECT_TRUE(reader.IsWriterActive());
+
+    // format is passed via header
+    EXPECT_EQ(params.Capacity, reader.GetCapacity());
+    EXPECT_EQ(params.Format.mSampleRate, reader.GetFormat().mSampleRate);
+    EXPECT_EQ(params.Format.mChannelsPerFrame, reader.GetFormat().mChannelsPerFrame);
+    EXPECT_EQ(params.Format.mBytesPerFrame, reader.GetFormat().mBytesPerFrame);
+
+    writer.Close();
+
+    // reader keeps mapping, but sees that writer is gone
+    EXPECT_TRUE(reader.IsOpen());
+    EXPECT_FALSE(reader.IsWriterActive());
+
+    reader.Close();
+
+    EXPECT_NE(kAudioHardwareNoError, reader.Open());
+}
+
+TEST_F(SharedRingTest, WriteRead)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    std::vector<UInt8> output(64 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+
+    EXPECT_EQ(0, reader.GetAvailableFrames());
+    EXPECT_EQ(0, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+
+    // several writes, wrapping around the end of the ring
+    UInt64 writeTime = 1000;
+
+    for (UInt8 n = 0; n < 10; n++) {
+        const auto frames = MakeFrames(20, n);
+
+        writer.Write(writeTime, frames.data(), UInt32(frames.size()));
+
+        EXPECT_EQ(20, reader.GetAvailableFrames());
+
+        // read in two parts
+        EXPECT_EQ(12, reader.Read(output.data(), 12 * BytesPerFrame, sampleTime));
+        EXPECT_EQ(writeTime, sampleTime);
+
+        EXPECT_EQ(8,
+            reader.Read(
+                output.data() + 12 * BytesPerFrame, 12 * BytesPerFrame, sampleTime));
+        EXPECT_EQ(writeTime + 12, sampleTime);
+
+        EXPECT_EQ(frames,
+            std::vector<UInt8>(output.begin(), output.begin() + frames.size()));
+
+        writeTime += 20;
+    }
+
+    EXPECT_EQ(200, writer.GetStats().NumWrittenFrames);
+    EXPECT_EQ(200, reader.GetStats().NumReadFrames);
+    EXPECT_EQ(0, reader.GetStats().NumLostFrames);
+}
+
+TEST_F(SharedRingTest, Gap)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    const auto frames1 = MakeFrames(10, 1);
+    const auto frames2 = MakeFrames(10, 2);
+
+    writer.Write(100, frames1.data(), UInt32(frames1.size()));
+    // 5 frames gap
+    writer.Write(115, frames2.data(), UInt32(frames2.size()));
+    // late, dropped
+    writer.Write(120, frames1.data(), UInt32(frames1.size()));
+
+    EXPECT_EQ(5, writer.GetStats().NumGapFrames);
+    EXPECT_EQ(5, writer.GetStats().NumLateFrames);
+
+    std::vector<UInt8> output(30 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+
+    ASSERT_EQ(30, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+    EXPECT_EQ(100, sampleTime);
+
+    std::vector<UInt8> expected = frames1;
+    expected.resize(expected.size() + 5 * BytesPerFrame);
+    expected.insert(expected.end(), frames2.begin(), frames2.end());
+    expected.insert(expected.end(), frames1.begin() + 5 * BytesPerFrame, frames1.end());
+
+    EXPECT_EQ(expected, output);
+}
+
+TEST_F(SharedRingTest, GapAtStart)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    const auto frames1 = MakeFrames(8, 1);
+    const auto frames2 = MakeFrames(8, 2);
+
+    // sample time starts from zero, and gap ends before ring capacity
+    writer.Write(0, frames1.data(), UInt32(frames1.size()));
+    // 8 frames gap
+    writer.Write(16, frames2.data(), UInt32(frames2.size()));
+
+    EXPECT_EQ(8, writer.GetStats().NumGapFrames);
+
+    std::vector<UInt8> output(24 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+
+    ASSERT_EQ(24, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+    EXPECT_EQ(0, sampleTime);
+    EXPECT_EQ(0, reader.GetStats().NumLostFrames);
+
+    std::vector<UInt8> expected = frames1;
+    expected.resize(expected.size() + 8 * BytesPerFrame);
+    expected.insert(expected.end(), frames2.begin(), frames2.end());
+
+    EXPECT_EQ(expected, output);
+}
+
+TEST_F(SharedRingTest, Overrun)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    std::vector<UInt8> output(64 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+
+    const auto frames = MakeFrames(16, 1);
+
+    writer.Write(0, frames.data(), UInt32(frames.size()));
+    ASSERT_EQ(16, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+
+    // write 100 frames while reader is sleeping, only last 64 remain
+    for (UInt32 n = 0; n < 10; n++) {
+        const auto more = MakeFrames(10, UInt8(n));
+        writer.Write(16 + n * 10, more.data(), UInt32(more.size()));
+    }
+
+    EXPECT_EQ(64, reader.GetAvailableFrames());
+
+    ASSERT_EQ(64, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+    EXPECT_EQ(116 - 64, sampleTime);
+
+    EXPECT_EQ(16 + 64, reader.GetStats().NumReadFrames);
+    EXPECT_EQ(100 - 64, reader.GetStats().NumLostFrames);
+
+    // the last frames are from the last write
+    const auto last = MakeFrames(10, 9);
+    EXPECT_EQ(last, std::vector<UInt8>(output.end() - last.size(), output.end()));
+}
+
+TEST_F(SharedRingTest, ReaderStartsFromOldestFrame)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    const auto frames = MakeFrames(40, 1);
+
+    writer.Write(500, frames.data(), UInt32(frames.size()));
+    writer.Write(540, frames.data(), UInt32(frames.size()));
+
+    // reader opened after writes
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    std::vector<UInt8> output(64 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+
+    ASSERT_EQ(64, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+    EXPECT_EQ(580 - 64, sampleTime);
+}
+
+TEST_F(SharedRingTest, Wait)
+{
+    const auto params = MakeParams();
+
+    aspl::SharedRingWriter writer(params);
+    ASSERT_EQ(kAudioHardwareNoError, writer.Open());
+
+    aspl::SharedRingReader reader(params.Name);
+    ASSERT_EQ(kAudioHardwareNoError, reader.Open());
+
+    // timeout
+    EXPECT_FALSE(reader.Wait(1000));
+
+    std::thread thread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        const auto frames = MakeFrames(8, 1);
+        writer.Write(0, frames.data(), UInt32(frames.size()));
+    });
+
+    // woken up by notifier thread
+    EXPECT_TRUE(reader.Wait(5000000));
+    EXPECT_EQ(8, reader.GetAvailableFrames());
+
+    thread.join();
+
+    EXPECT_GT(writer.GetStats().NumNotifications, 0);
+
+    std::vector<UInt8> output(8 * BytesPerFrame);
+    UInt64 sampleTime = 0;
+    EXPECT_EQ(8, reader.Read(output.data(), UInt32(output.size()), sampleTime));
+
+    // woken up by closing writer
+    std::thread closer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        writer.Close();
+    });
+
+    EXPECT_FALSE(reader.Wait(5000000));
+    EXPECT_FALSE(reader.IsWriterActive());
+
+    closer.join();
+}
@@ -0,0 +1,247 @@
+#include <aspl/Driver.hpp>
+#include <aspl/StaticDevice.hpp>
+
+#include "HostSimulator.hpp"
+
+#include "TestTracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+namespace {
+
+constexpr UInt32 TestChannels = 2;
+constexpr UInt32 TestSampleRate = 48000;
+constexpr UInt32 TestBufferSize = 480;
+constexpr UInt32 TestNumClients = 2;
+
+class TestDevice
+    : public aspl::StaticDevice<TestDevice, Float32, TestChannels, TestSampleRate>
+{
+public:
+    using StaticDevice::StaticDevice;
+
+    UInt32 numReadClientInput = 0;
+    UInt32 numProcessClientInput = 0;
+    UInt32 numProcessMixedOutput = 0;
+    UInt32 numWriteMixedOutput = 0;
+
+    UInt32 lastFrameCount = 0;
+    bool inputIsZero = true;
+
+    void OnReadClientInput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount)
+    {
+        // default implementation
+        StaticDevice::OnReadClientInput(
+            client, stream, zeroTimestamp, timestamp, frames, frameCount);
+
+        for (UInt32 n = 0; n < frameCount * Format::ChannelCount; n++) {
+            if (frames[n] != 0) {
+                inputIsZero = false;
+            }
+        }
+
+        numReadClientInput++;
+    }
+
+    void OnProcessClientInput(const std::shared_ptr<aspl::Client>& client,
+        const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        Float32* frames,
+        UInt32 frameCount)
+    {
+        numProcessClientInput++;
+    }
+
+    void OnWriteMixedOutput(const std::shared_ptr<aspl::Stream>& stream,
+        Float64 zeroTimestamp,
+        Float64 timestamp,
+        const Float32* frames,
+        UInt32 frameCount)
+    {
+        numWriteMixedOutput++;
+        lastFrameCount = frameCount;
+    }
+
+    // not overridden: OnProcessMixedOutput
+};
+
+using TestFormat = aspl::StaticFormat<Float32, TestChannels, TestSampleRate>;
+
+// format is computed at compile time
+static_assert(TestFormat::BytesPerFrame == 8);
+static_assert(TestFormat::Description.mBytesPerFrame == 8);
+static_assert(TestFormat::Description.mBitsPerChannel == 32);
+static_assert(TestFormat::Description.mFormatFlags & kAudioFormatFlagIsFloat);
+static_assert(TestFormat::FramesToBytes(10) == 80);
+
+static_assert(aspl::StaticFormat<SInt16, 1, 44100>::Description.mFormatFlags &
+              kAudioFormatFlagIsSignedInteger);
+static_assert(aspl::StaticFormat<SInt16, 1, 44100>::BytesToFrames(10) == 5);
+
+} // anonymous namespace
+
+struct StaticDeviceTest : ::testing::Test
+{
+    std::shared_ptr<aspl::Tracer> tracer = std::make_shared<TestTracer>();
+
+    std::shared_ptr<aspl::Context> context = std::make_shared<aspl::Context>(
+        tracer, nullptr, std::make_shared<aspl::SimulatedClock>());
+
+    std::shared_ptr<aspl::Plugin> plugin = std::make_shared<aspl::Plugin>(context);
+
+    std::shared_ptr<aspl::Driver> driver =
+        std::make_shared<aspl::Driver>(context, plugin);
+
+    std::shared_ptr<TestDevice> CreateDevice()
+    {
+        aspl::DeviceParameters params;
+        params.ZeroTimeStampPeriod = TestBufferSize;
+        // ignored
+        params.SampleRate = 44100;
+        params.ChannelCount = 6;
+
+        auto device = std::make_shared<TestDevice>(context, params);
+
+        device->AddStaticStreamWithControlsAsync(aspl::Direction::Input);
+        device->AddStaticStreamWithControlsAsync(aspl::Direction::Output);
+
+        plugin->AddDevice(device);
+
+        return device;
+    }
+};
+
+TEST_F(StaticDeviceTest, Properties)
+{
+    auto device = CreateDevice();
+
+    EXPECT_EQ(TestSampleRate, device->GetNominalSampleRate());
+    EXPECT_EQ(TestChannels, device->GetPreferredChannelCount());
+
+    ASSERT_EQ(1, device->GetAvailableSampleRates().size());
+    EXPECT_EQ(TestSampleRate, device->GetAvailableSampleRates()[0].mMinimum);
+    EXPECT_EQ(TestSampleRate, device->GetAvailableSampleRates()[0].mMaximum);
+
+    auto stream = device->GetStreamByIndex(aspl::Direction::Output, 0);
+    ASSERT_TRUE(stream);
+
+    EXPECT_TRUE((std::is_same_v<decltype(device->AddStaticStreamAsync(
+                                    aspl::Direction::Output)),
+        std::shared_ptr<aspl::StaticStream<Float32, TestChannels, TestSampleRate>>>));
+
+    const auto format = stream->GetPhysicalFormat();
+
+    EXPECT_EQ(TestSampleRate, format.mSampleRate);
+    EXPECT_EQ(kAudioFormatLinearPCM, format.mFormatID);
+    EXPECT_EQ(TestChannels, format.mChannelsPerFrame);
+    EXPECT_EQ(TestChannels * sizeof(Float32), format.mBytesPerFrame);
+    EXPECT_EQ(TestChannels * sizeof(Float32), format.mBytesPerPacket);
+    EXPECT_EQ(1, format.mFramesPerPacket);
+    EXPECT_EQ(32, format.mBitsPerChannel);
+
+    EXPECT_EQ(0, memcmp(&format, &TestFormat::Description, sizeof(format)));
+
+    const auto virtualFormat = stream->GetVirtualFormat();
+    EXPECT_EQ(0, memcmp(&virtualFormat, &TestFormat::Description, sizeof(format)));
+
+    ASSERT_EQ(1, stream->GetAvailablePhysicalFormats().size());
+    ASSERT_EQ(1, stream->GetAvailableVirtualFormats().size());
+
+    EXPECT_EQ(TestChannels, stream->GetChannelCount());
+    EXPECT_EQ(80, stream->ConvertFramesToBytes(10));
+    EXPECT_EQ(10, stream->ConvertBytesToFrames(80));
+
+    // the same values are reported to HAL
+    AudioObjectPropertyAddress addr = {
+        kAudioStreamPropertyPhysicalFormat,
+        kAudioObjectPropertyScopeGlobal,
+        kAudioObjectPropertyElementMain,
+    };
+
+    AudioStreamBasicDescription halFormat = {};
+    UInt32 dataSize = 0;
+
+    ASSERT_EQ(kAudioHardwareNoError,
+        stream->GetPropertyData(stream->GetID(),
+            0,
+            &addr,
+            0,
+            nullptr,
+            sizeof(halFormat),
+            &dataSize,
+            &halFormat));
+    EXPECT_EQ(sizeof(halFormat), dataSize);
+    EXPECT_EQ(0, memcmp(&halFormat, &TestFormat::Description, sizeof(halFormat)));
+
+    // second stream continues channel numbering
+    auto stream2 = device->AddStaticStreamAsync(aspl::Direction::Output);
+    EXPECT_EQ(TestChannels + 1, stream2->GetStartingChannel());
+}
+
+TEST_F(StaticDeviceTest, FixedFormat)
+{
+    auto device = CreateDevice();
+
+    auto stream = device->GetStreamByIndex(aspl::Direction::Output, 0);
+    ASSERT_TRUE(stream);
+
+    // other rates are rejected
+    EXPECT_NE(kAudioHardwareNoError, device->SetNominalSampleRateAsync(44100));
+    EXPECT_EQ(kAudioHardwareNoError, device->SetNominalSampleRateAsync(TestSampleRate));
+    EXPECT_EQ(TestSampleRate, device->GetNominalSampleRate());
+
+    // list of rates can't be changed
+    device->SetAvailableSampleRatesAsync({});
+    EXPECT_EQ(1, device->GetAvailableSampleRates().size());
+
+    // other formats are rejected
+    auto format = TestFormat::Description;
+    format.mChannelsPerFrame = 1;
+
+    EXPECT_NE(kAudioHardwareNoError, stream->SetPhysicalFormatAsync(format));
+    EXPECT_NE(kAudioHardwareNoError, stream->SetVirtualFormatAsync(format));
+    EXPECT_EQ(
+        kAudioHardwareNoError, stream->SetPhysicalFormatAsync(TestFormat::Description));
+
+    // list of formats can't be changed
+    stream->SetAvailablePhysicalFormatsAsync({});
+    EXPECT_EQ(1, stream->GetAvailablePhysicalFormats().size());
+    EXPECT_NE(kAudioHardwareNoError, stream->SetPhysicalFormatAsync(format));
+
+    EXPECT_EQ(TestChannels, stream->GetPhysicalFormat().mChannelsPerFrame);
+}
+
+TEST_F(StaticDeviceTest, IO)
+{
+    constexpr UInt32 NumCycles = 10;
+
+    auto device = CreateDevice();
+
+    aspl::HostSimulatorParameters params;
+    params.NumClients = TestNumClients;
+    params.BufferFrameSize = TestBufferSize;
+
+    aspl::HostSimulator simulator(driver, params);
+
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Initialize());
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Start(device->GetID()));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.RunCycles(NumCycles));
+    ASSERT_EQ(kAudioHardwareNoError, simulator.Stop());
+
+    EXPECT_EQ(NumCycles, device->numReadClientInput);
+    EXPECT_EQ(NumCycles * TestNumClients, device->numProcessClientInput);
+    EXPECT_EQ(NumCycles, device->numWriteMixedOutput);
+
+    EXPECT_EQ(TestBufferSize, device->lastFrameCount);
+    EXPECT_TRUE(device->inputIsZero);
+
+    EXPECT_EQ(0, simulator.GetReport().NumFailedCalls);
+}
@@ -0,0 +1,336 @@
+#include <aspl/Driver.hpp>
+#include <aspl/Tracer.hpp>
+
+#include <CoreAudio/AudioServerPlugIn.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr AudioObjectPropertySelector TestSelector = 'atrf';
+
+class RecordingTracer : public aspl::Tracer
+{
+public:
+    RecordingTracer()
+        : aspl::Tracer(aspl::Tracer::Mode::Custom, aspl::Tracer::Style::Flat)
+    {
+    }
+
+    std::vector<std::string> Lines;
+
+protected:
+    void Print(const char* message) override
+    {
+        Lines.push_back(message);
+    }
+};
+
+// Overrides deprecated string formatting hook.
+class LegacyFormatTracer : public RecordingTracer
+{
+protected:
+    std::string FormatMessage(const char* message, UInt32 depth) override
+    {
+        return std::string("legacy ") + message;
+    }
+};
+
+void RunOperation(aspl::Tracer& tracer,
+    const char* name,
+    AudioObjectID objectID,
+    AudioObjectPropertySelector selector = 0,
+    void (*nested)(aspl::Tracer&) = nullptr)
+{
+    AudioObjectPropertyAddress address = {};
+    address.mSelector = selector;
+
+    aspl::Tracer::Operation op;
+    op.Name = name;
+    op.ObjectID = objectID;
+    if (selector != 0) {
+        op.PropertyAddress = &address;
+    }
+
+    tracer.OperationBegin(op);
+    tracer.Message("inside %s", name);
+    if (nested) {
+        nested(tracer);
+    }
+    tracer.OperationEnd(op, kAudioHardwareNoError);
+}
+
+size_t CountLines(const RecordingTracer& tracer, const std::string& str)
+{
+    size_t count = 0;
+    for (const auto& line : tracer.Lines) {
+        if (line.find(str) != std::string::npos) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // anonymous namespace
+
+TEST(TraceFilterTest, NoFilter)
+{
+    RecordingTracer tracer;
+
+    RunOperation(tracer, "Op1", 1);
+    RunOperation(tracer, "Op2", 2, 'nsrt');
+    tracer.Message("outside");
+
+    EXPECT_EQ(7, tracer.Lines.size());
+}
+
+TEST(TraceFilterTest, ObjectIDs)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.ObjectIDs = {2, 100000};
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Op1", 1);
+    RunOperation(tracer, "Op2", 2);
+    RunOperation(tracer, "Op3", 3);
+    RunOperation(tracer, "Op4", 100000);
+    RunOperation(tracer, "Op5", 100001);
+
+    EXPECT_EQ(0, CountLines(tracer, "Op1"));
+    EXPECT_EQ(3, CountLines(tracer, "Op2"));
+    EXPECT_EQ(0, CountLines(tracer, "Op3"));
+    EXPECT_EQ(3, CountLines(tracer, "Op4"));
+    EXPECT_EQ(0, CountLines(tracer, "Op5"));
+}
+
+TEST(TraceFilterTest, Selectors)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.Selectors = {'nsrt'};
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Op1", 1, 'nsrt');
+    RunOperation(tracer, "Op2", 1, 'lnam');
+    RunOperation(tracer, "Op3", 1);
+
+    EXPECT_EQ(3, CountLines(tracer, "Op1"));
+    EXPECT_EQ(0, CountLines(tracer, "Op2"));
+    EXPECT_EQ(0, CountLines(tracer, "Op3"));
+}
+
+TEST(TraceFilterTest, ObjectIDsAndSelectors)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.ObjectIDs = {2};
+    filter.Selectors = {'nsrt'};
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Op1", 2, 'nsrt');
+    RunOperation(tracer, "Op2", 2, 'lnam');
+    RunOperation(tracer, "Op3", 3, 'nsrt');
+
+    EXPECT_EQ(3, CountLines(tracer, "Op1"));
+    EXPECT_EQ(0, CountLines(tracer, "Op2"));
+    EXPECT_EQ(0, CountLines(tracer, "Op3"));
+}
+
+TEST(TraceFilterTest, Nested)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.ObjectIDs = {2};
+    tracer.SetFilter(filter);
+
+    // nested operation of matching operation is traced
+    RunOperation(tracer, "Outer1", 2, 0, [](aspl::Tracer& tracer) {
+        RunOperation(tracer, "Inner1", 3);
+    });
+
+    // matching nested operation of non-matching operation is not traced
+    RunOperation(tracer, "Outer2", 3, 0, [](aspl::Tracer& tracer) {
+        RunOperation(tracer, "Inner2", 2);
+    });
+
+    EXPECT_EQ(3, CountLines(tracer, "Outer1"));
+    EXPECT_EQ(3, CountLines(tracer, "Inner1"));
+    EXPECT_EQ(0, CountLines(tracer, "Outer2"));
+    EXPECT_EQ(0, CountLines(tracer, "Inner2"));
+
+    // messages outside of operations are not traced
+    tracer.Message("outside");
+
+    EXPECT_EQ(0, CountLines(tracer, "outside"));
+}
+
+TEST(TraceFilterTest, MaxDepth)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.MaxDepth = 1;
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Outer", 1, 0, [](aspl::Tracer& tracer) {
+        RunOperation(tracer, "Inner", 1);
+    });
+    tracer.Message("outside");
+
+    EXPECT_EQ(3, CountLines(tracer, "Outer"));
+    EXPECT_EQ(0, CountLines(tracer, "Inner"));
+    EXPECT_EQ(1, CountLines(tracer, "outside"));
+}
+
+TEST(TraceFilterTest, Reconfigure)
+{
+    RecordingTracer tracer;
+
+    aspl::Tracer::Filter filter;
+    filter.ObjectIDs = {2};
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Op1", 1);
+    EXPECT_EQ(0, CountLines(tracer, "Op1"));
+
+    filter.ObjectIDs = {1};
+    tracer.SetFilter(filter);
+
+    RunOperation(tracer, "Op1", 1);
+    EXPECT_EQ(3, CountLines(tracer, "Op1"));
+
+    // filter is changed while operation is in progress
+    RunOperation(tracer, "Op2", 1, 0, [](aspl::Tracer& tracer) {
+        tracer.SetFilter({});
+        RunOperation(tracer, "Op3", 3);
+    });
+    EXPECT_EQ(3, CountLines(tracer, "Op2"));
+    EXPECT_EQ(3, CountLines(tracer, "Op3"));
+
+    EXPECT_TRUE(tracer.GetFilter().ObjectIDs.empty());
+
+    RunOperation(tracer, "Op4", 4);
+    EXPECT_EQ(3, CountLines(tracer, "Op4"));
+}
+
+TEST(TraceFilterTest, PluginProperty)
+{
+    auto tracer = std::make_shared<RecordingTracer>();
+    auto context = std::make_shared<aspl::Context>(tracer);
+
+    aspl::PluginParameters params;
+    params.EnableTraceFilterProperty = true;
+    params.TraceFilterSelector = TestSelector;
+
+    auto plugin = std::make_shared<aspl::Plugin>(context, params);
+    auto driver = std::make_shared<aspl::Driver>(context, plugin);
+
+    const auto iface = driver->GetPluginInterface();
+
+    AudioObjectPropertyAddress address = {};
+    address.mSelector = TestSelector;
+    address.mScope = kAudioObjectPropertyScopeGlobal;
+
+    CFStringRef value = CFStringCreateWithCString(kCFAllocatorDefault,
+        "objects=2,5 selectors=nsrt,1 depth=3",
+        kCFStringEncodingUTF8);
+
+    EXPECT_EQ(kAudioHardwareNoError,
+        iface.SetPropertyData(driver->GetReference(),
+            kAudioObjectPlugInObject,
+            0,
+            &address,
+            0,
+            nullptr,
+            sizeof(value),
+            &value));
+
+    CFRelease(value);
+
+    const auto filter = tracer->GetFilter();
+
+    EXPECT_EQ(std::vector<AudioObjectID>({2, 5}), filter.ObjectIDs);
+    EXPECT_EQ(std::vector<AudioObjectPropertySelector>({'nsrt', 1}), filter.Selectors);
+    EXPECT_EQ(3, filter.MaxDepth);
+
+    CFStringRef result = nullptr;
+    UInt32 size = 0;
+
+    EXPECT_EQ(kAudioHardwareNoError,
+        iface.GetPropertyData(driver->GetReference(),
+            kAudioObjectPlugInObject,
+            0,
+            &address,
+            0,
+            nullptr,
+            sizeof(result),
+            &size,
+            &result));
+
+    ASSERT_TRUE(result);
+
+    char buf[128] = {};
+    CFStringGetCString(result, buf, sizeof(buf), kCFStringEncodingUTF8);
+    CFRelease(result);
+
+    EXPECT_EQ(std::string("objects=2,5 selectors=nsrt,1 depth=3"), std::string(buf));
+
+    // invalid filter is ignored
+    value = CFStringCreateWithCString(
+        kCFAllocatorDefault, "objects=foo", kCFStringEncodingUTF8);
+
+    iface.SetPropertyData(driver->GetReference(),
+        kAudioObjectPlugInObject,
+        0,
+        &address,
+        0,
+        nullptr,
+        sizeof(value),
+        &value);
+
+    CFRelease(value);
+
+    EXPECT_EQ(std::vector<AudioObjectID>({2, 5}), tracer->GetFilter().ObjectIDs);
+
+    // empty string clears filter
+    value = CFStringCreateWithCString(kCFAllocatorDefault, "", kCFStringEncodingUTF8);
+
+    iface.SetPropertyData(driver->GetReference(),
+        kAudioObjectPlugInObject,
+        0,
+        &address,
+        0,
+        nullptr,
+        sizeof(value),
+        &value);
+
+    CFRelease(value);
+
+    EXPECT_TRUE(tracer->GetFilter().ObjectIDs.empty());
+    EXPECT_TRUE(tracer->GetFilter().Selectors.empty());
+    EXPECT_EQ(0, tracer->GetFilter().MaxDepth);
+}
+
+TEST(TraceFilterTest, LegacyFormatHooks)
+{
+    LegacyFormatTracer tracer;
+
+    // overridden hook is used on every call, other hooks use defaults
+    for (int n = 0; n < 2; n++) {
+        RunOperation(tracer, "Op1", 1);
+    }
+
+    EXPECT_EQ(6, tracer.Lines.size());
+    EXPECT_EQ(2, CountLines(tracer, "legacy inside Op1"));
+    EXPECT_EQ(2, CountLines(tracer, "Op1 begin"));
+    EXPECT_EQ(2, CountLines(tracer, "Op1 end"));
+}